@@ -22,9 +22,12 @@ layout(set = 0, binding = 0) uniform GlobalUBO {
     int hasShadows;
     int hasIBL;
     Light lights[4];
+    mat4 cascadeViewProj[4];
+    vec4 cascadeSplits; // View-space far distance of each cascade
+    int cascadeCount;
 } global;
 
-layout(set = 0, binding = 1) uniform sampler2D shadowMap;
+layout(set = 0, binding = 1) uniform sampler2D shadowMap; // Cascades side by side
 layout(set = 0, binding = 2) uniform samplerCube irradianceMap;
 layout(set = 0, binding = 3) uniform samplerCube prefilterMap;
 layout(set = 0, binding = 4) uniform sampler2D brdfLUT;
@@ -60,7 +63,9 @@ const float PI = 3.14159265359;
 vec3 getNormalFromMap() {
     if (material.useNormalMap == 0) return normalize(fragNormal);
     
-    vec3 tangentNormal = texture(normalMap, fragTexCoord).xyz * 2.0 - 1.0;
+    // Normal maps are cooked to two channels (BC5); rebuild z from x and y
+    vec2 xy = texture(normalMap, fragTexCoord).rg * 2.0 - 1.0;
+    vec3 tangentNormal = vec3(xy, sqrt(max(1.0 - dot(xy, xy), 0.0)));
     return normalize(TBN * tangentNormal);
 }
 
@@ -104,29 +109,47 @@ vec3 fresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness) {
     return F0 + (max(vec3(1.0 - roughness), F0) - F0) * pow(clamp(1.0 - cosTheta, 0.0, 1.0), 5.0);
 }
 
-float ShadowCalculation(vec4 fragPosLightSpace, vec3 normal, vec3 lightDir) {
-    if (global.hasShadows == 0) return 0.0;
-    
+int SelectCascade(vec3 worldPos) {
+    float viewDepth = -(global.view * vec4(worldPos, 1.0)).z;
+    int cascade = 0;
+    for (int i = 0; i < global.cascadeCount - 1; ++i) {
+        if (viewDepth > global.cascadeSplits[i]) cascade = i + 1;
+    }
+    return cascade;
+}
+
+float ShadowCalculation(vec3 worldPos, vec3 normal, vec3 lightDir) {
+    if (global.hasShadows == 0 || global.cascadeCount == 0) return 0.0;
+
+    int cascade = SelectCascade(worldPos);
+    vec4 fragPosLightSpace = global.cascadeViewProj[cascade] * vec4(worldPos, 1.0);
     vec3 projCoords = fragPosLightSpace.xyz / fragPosLightSpace.w;
-    projCoords = projCoords * 0.5 + 0.5;
-    
-    if (projCoords.z > 1.0) return 0.0;
-    
-    float closestDepth = texture(shadowMap, projCoords.xy).r; 
+    vec2 uv = projCoords.xy * 0.5 + 0.5;
+
+    // Depth is already [0, 1] (zero-to-one ortho projection)
+    if (projCoords.z > 1.0 || any(lessThan(uv, vec2(0.0))) || any(greaterThan(uv, vec2(1.0)))) return 0.0;
+
+    // Map into this cascade's tile of the atlas
+    float tileWidth = 1.0 / float(global.cascadeCount);
+    vec2 texelSize = 1.0 / vec2(textureSize(shadowMap, 0));
+    vec2 atlasUV = vec2((float(cascade) + uv.x) * tileWidth, uv.y);
+    vec2 tileMin = vec2(float(cascade) * tileWidth, 0.0) + texelSize * 0.5;
+    vec2 tileMax = vec2(float(cascade + 1) * tileWidth, 1.0) - texelSize * 0.5;
+
     float currentDepth = projCoords.z;
-    
     float bias = max(0.05 * (1.0 - dot(normal, lightDir)), 0.005);
-    
+
+    // PCF, clamped so samples never bleed into a neighbouring cascade
     float shadow = 0.0;
-    vec2 texelSize = 1.0 / textureSize(shadowMap, 0);
     for(int x = -1; x <= 1; ++x) {
         for(int y = -1; y <= 1; ++y) {
-            float pcfDepth = texture(shadowMap, projCoords.xy + vec2(x, y) * texelSize).r; 
-            shadow += currentDepth - bias > pcfDepth  ? 1.0 : 0.0;        
-        }    
+            vec2 sampleUV = clamp(atlasUV + vec2(x, y) * texelSize, tileMin, tileMax);
+            float pcfDepth = texture(shadowMap, sampleUV).r;
+            shadow += currentDepth - bias > pcfDepth  ? 1.0 : 0.0;
+        }
     }
     shadow /= 9.0;
-    
+
     return shadow;
 }
 
@@ -190,8 +213,7 @@ void main() {
 
         float shadow = 0.0;
         if(light.position.w == 0.0) { // Directional shadows for now
-            vec4 fragPosLightSpace = global.lightSpaceMatrix * vec4(fragFragPos, 1.0);
-            shadow = ShadowCalculation(fragPosLightSpace, N, L);
+            shadow = ShadowCalculation(fragFragPos, N, L);
         }
 
         Lo += (kD * albedo / PI + specular) * radiance * NdotL * (1.0 - shadow);
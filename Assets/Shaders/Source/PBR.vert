@@ -12,9 +12,13 @@ layout(set = 0, binding = 0) uniform GlobalUBO {
 
 layout(push_constant) uniform PushConstants {
     mat4 model;
+    vec4 positionScale;  // w > 0.5: packed vertex layout (see PackedVertex)
+    vec4 positionOffset;
 } pc;
 
-layout(location = 0) in vec3 inPosition;
+// Standard: float attributes. Packed: unorm16 position (w = bitangent sign),
+// octahedral snorm16 normal/tangent in .xy, half-float UV; location 4 unused.
+layout(location = 0) in vec4 inPosition;
 layout(location = 1) in vec3 inNormal;
 layout(location = 2) in vec2 inTexCoord;
 layout(location = 3) in vec3 inTangent;
@@ -26,8 +30,25 @@ layout(location = 2) out vec3 fragViewPos;
 layout(location = 3) out vec3 fragFragPos;
 layout(location = 4) out mat3 TBN;
 
+vec3 OctDecode(vec2 e) {
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+    return normalize(n);
+}
+
 void main() {
-    vec4 worldPos = pc.model * vec4(inPosition, 1.0);
+    vec3 position = inPosition.xyz * pc.positionScale.xyz + pc.positionOffset.xyz;
+    vec3 normal = inNormal;
+    vec3 tangent = inTangent;
+    vec3 bitangent = inBitangent;
+    if (pc.positionScale.w > 0.5) {
+        normal = OctDecode(inNormal.xy);
+        tangent = OctDecode(inTangent.xy);
+        bitangent = cross(normal, tangent) * (inPosition.w * 2.0 - 1.0);
+    }
+
+    vec4 worldPos = pc.model * vec4(position, 1.0);
     gl_Position = ubo.proj * ubo.view * worldPos;
     
     fragFragPos = worldPos.xyz;
@@ -36,11 +57,11 @@ void main() {
     
     // Normal Matrix
     mat3 normalMatrix = mat3(transpose(inverse(pc.model)));
-    fragNormal = normalize(normalMatrix * inNormal);
+    fragNormal = normalize(normalMatrix * normal);
     
     // TBN Matrix for Normal Mapping
-    vec3 T = normalize(normalMatrix * inTangent);
-    vec3 B = normalize(normalMatrix * inBitangent);
-    vec3 N = normalize(normalMatrix * inNormal);
+    vec3 T = normalize(normalMatrix * tangent);
+    vec3 B = normalize(normalMatrix * bitangent);
+    vec3 N = normalize(normalMatrix * normal);
     TBN = mat3(T, B, N);
 }
@@ -1,21 +1,13 @@
 #version 450
 
-layout(set = 0, binding = 0) uniform GlobalUBO {
-    mat4 view;
-    mat4 proj;
-    mat4 lightSpaceMatrix;
-    vec4 viewPos;
-    int lightCount;
-    int hasShadows;
-    int hasIBL;
-} global;
-
+// Each cascade is drawn with its own light matrix, so it comes in with the model
 layout(push_constant) uniform PushConstants {
     mat4 model;
+    mat4 lightViewProj;
 } pc;
 
 layout(location = 0) in vec3 inPosition;
 
 void main() {
-    gl_Position = global.lightSpaceMatrix * pc.model * vec4(inPosition, 1.0);
+    gl_Position = pc.lightViewProj * pc.model * vec4(inPosition, 1.0);
 }
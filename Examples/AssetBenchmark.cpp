@@ -0,0 +1,442 @@
+// Asset pipeline benchmarks.
+// Usage: AssetBenchmark <benchmark> [asset directory] [asset path] [iterations]
+//   mesh    - Assimp import (serial and parallel) vs memory-mapped cooked mesh load
+//   meshopt - ACMR/ATVR before and after the MeshOptimizer stages
+//   registry - GetAsset throughput on loaded assets from 1 to 16 threads
+//              (iterations = seconds per thread count)
+//   packed  - Cold-start time to load every asset from loose files vs a
+//             packed archive (page cache dropped before each run on Linux)
+
+#include "Core/Logger.h"
+#include "Core/ThreadPool.h"
+#include "Subsystems/Asset/AssetArchive.h"
+#include "Subsystems/Asset/AssetData.h"
+#include "Subsystems/Asset/AssetManager.h"
+#include "Subsystems/Asset/MeshCooker.h"
+#include "Subsystems/Asset/MeshOptimizer.h"
+#include "Subsystems/Asset/ModelImporter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace AstralEngine;
+
+namespace {
+
+struct BenchmarkArgs {
+    std::string assetDirectory = "Assets";
+    std::string assetPath;
+    int iterations = 5;
+};
+
+template <typename F>
+double TimeMs(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Reads every page of the mesh so the mmap path pays for its I/O like the
+// upload to a staging buffer would
+uint64_t TouchModel(const ModelData& model) {
+    uint64_t sum = 0;
+    for (uint32_t index : model.GetIndices()) {
+        sum += index;
+    }
+    // One read per cache line covers either vertex layout
+    auto vertexData = model.GetVertexData();
+    for (size_t offset = 0; offset < vertexData.size(); offset += 64) {
+        sum += static_cast<uint64_t>(vertexData[offset]);
+    }
+    return sum;
+}
+
+int RunMeshBenchmark(const BenchmarkArgs& args) {
+    std::string relativePath = args.assetPath.empty() ? "3DObjects/bmw_m5_e34/scene.gltf" : args.assetPath;
+    std::string sourcePath = (std::filesystem::path(args.assetDirectory) / relativePath).string();
+    std::string cookedPath = (std::filesystem::temp_directory_path() / "AssetBenchmark.amesh").string();
+
+    if (!std::filesystem::exists(sourcePath)) {
+        std::printf("Source model not found: %s\n", sourcePath.c_str());
+        return 1;
+    }
+
+    ModelImporter importer;
+    std::shared_ptr<ModelData> imported;
+    uint64_t checksum = 0;
+
+    double assimpMs = 0.0;
+    for (int i = 0; i < args.iterations; ++i) {
+        assimpMs += TimeMs([&] { imported = importer.ImportSource(sourcePath); });
+    }
+    if (!imported) {
+        std::printf("Assimp import failed: %s\n", sourcePath.c_str());
+        return 1;
+    }
+
+    // Same import with the per-mesh conversion spread over a pool
+    ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()));
+    ModelImporter parallelImporter(MeshOptimizerSettings{}, &pool);
+    double parallelMs = 0.0;
+    for (int i = 0; i < args.iterations; ++i) {
+        parallelMs += TimeMs([&] { parallelImporter.ImportSource(sourcePath); });
+    }
+
+    double cookMs = TimeMs([&] { MeshCooker::Write(*imported, cookedPath); });
+
+    double mapMs = 0.0;
+    double touchMs = 0.0;
+    for (int i = 0; i < args.iterations; ++i) {
+        std::shared_ptr<ModelData> cooked;
+        mapMs += TimeMs([&] { cooked = MeshCooker::Load(cookedPath); });
+        if (!cooked) {
+            std::printf("Cooked load failed: %s\n", cookedPath.c_str());
+            return 1;
+        }
+        touchMs += TimeMs([&] { checksum += TouchModel(*cooked); });
+    }
+
+    std::printf("Model:           %s\n", relativePath.c_str());
+    std::printf("Vertices/Indices: %zu / %zu (%.2f MB)\n", imported->GetVertexCount(), imported->GetIndexCount(),
+                imported->GetMemoryUsage() / (1024.0 * 1024.0));
+    std::printf("Submeshes:       %zu\n", imported->GetSubmeshes().size());
+    std::printf("Assimp import:   %8.2f ms (avg of %d)\n", assimpMs / args.iterations, args.iterations);
+    std::printf("Parallel import: %8.2f ms (avg of %d, %zu threads)\n", parallelMs / args.iterations,
+                args.iterations, pool.GetThreadCount());
+    std::printf("Cook (write):    %8.2f ms\n", cookMs);
+    std::printf("Cooked map:      %8.3f ms (avg of %d)\n", mapMs / args.iterations, args.iterations);
+    std::printf("Cooked map+read: %8.3f ms (avg of %d)\n", (mapMs + touchMs) / args.iterations, args.iterations);
+    std::printf("Speedup:         %8.1fx\n", assimpMs / std::max(mapMs + touchMs, 1e-3));
+    std::printf("(checksum %llu)\n", static_cast<unsigned long long>(checksum));
+
+    std::error_code ec;
+    std::filesystem::remove(cookedPath, ec);
+    return 0;
+}
+
+int RunMeshOptimizerBenchmark(const BenchmarkArgs& args) {
+    std::string relativePath = args.assetPath.empty() ? "3DObjects/bmw_m5_e34/scene.gltf" : args.assetPath;
+    std::string sourcePath = (std::filesystem::path(args.assetDirectory) / relativePath).string();
+
+    // Raw Assimp output: every stage off
+    MeshOptimizerSettings rawSettings;
+    rawSettings.vertexCache = false;
+    rawSettings.overdraw = false;
+    rawSettings.meshlets = false;
+    rawSettings.vertexFetch = false;
+    rawSettings.lodCount = 1;
+    ModelImporter importer(rawSettings);
+    auto raw = importer.ImportSource(sourcePath);
+    if (!raw) {
+        std::printf("Assimp import failed: %s\n", sourcePath.c_str());
+        return 1;
+    }
+
+    struct Stage {
+        const char* name;
+        MeshOptimizerSettings settings;
+    };
+    std::vector<Stage> stages(5, {"", rawSettings});
+    stages[0].name = "vertex cache";
+    stages[0].settings.vertexCache = true;
+    stages[1].name = "+ overdraw";
+    stages[1].settings = stages[0].settings;
+    stages[1].settings.overdraw = true;
+    stages[2].name = "+ meshlets";
+    stages[2].settings = stages[1].settings;
+    stages[2].settings.meshlets = true;
+    stages[3].name = "+ vertex fetch";
+    stages[3].settings = stages[2].settings;
+    stages[3].settings.vertexFetch = true;
+    stages[4].name = "+ LODs";
+    stages[4].settings = stages[3].settings;
+    stages[4].settings.lodCount = MeshOptimizerSettings{}.lodCount;
+
+    std::printf("Model: %s (%zu vertices, %zu triangles)\n", relativePath.c_str(), raw->GetVertexCount(),
+                raw->GetIndexCount() / 3);
+    std::printf("%-16s %8s %8s %8s %8s %10s\n", "Stages", "ACMR", "->", "ATVR", "->", "Time (ms)");
+    ModelData model;
+    for (const auto& stage : stages) {
+        model = *raw;
+        MeshOptimizationReport report = MeshOptimizer::Optimize(model, stage.settings);
+        std::printf("%-16s %8.3f %8.3f %8.3f %8.3f %10.2f\n", stage.name, report.before.acmr, report.after.acmr,
+                    report.before.atvr, report.after.atvr, report.timeMs);
+    }
+
+    // LOD chain of the last (full) stage
+    std::printf("\n%-6s %10s %8s %10s\n", "LOD", "Triangles", "Ratio", "Error");
+    for (size_t i = 0; i < model.lods.size(); ++i) {
+        const MeshLod& lod = model.lods[i];
+        std::printf("%-6zu %10u %7.1f%% %10.5f\n", i, lod.indexCount / 3,
+                    100.0 * lod.indexCount / model.lods.front().indexCount, lod.error);
+    }
+    return 0;
+}
+
+int RunRegistryBenchmark(const BenchmarkArgs& args) {
+    constexpr size_t MAX_ASSETS = 64;
+
+    AssetManager assetManager;
+    if (!assetManager.Initialize(args.assetDirectory)) {
+        std::printf("Asset directory not found: %s\n", args.assetDirectory.c_str());
+        return 1;
+    }
+
+    // The smallest files of known types; only lookups are measured, so the
+    // assets just need to be loaded
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(args.assetDirectory)) {
+        if (entry.is_regular_file()) {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end(), [](const auto& a, const auto& b) {
+        return std::filesystem::file_size(a) < std::filesystem::file_size(b);
+    });
+
+    std::vector<AssetHandle> handles;
+    for (const auto& file : files) {
+        if (handles.size() == MAX_ASSETS) {
+            break;
+        }
+        AssetHandle handle = assetManager.RegisterAsset(
+            std::filesystem::relative(file, args.assetDirectory).generic_string());
+        if (handle.IsValid()) {
+            assetManager.GetAsset<void>(handle);
+            handles.push_back(handle);
+        }
+    }
+
+    auto pending = [&]() {
+        return std::any_of(handles.begin(), handles.end(), [&](const AssetHandle& handle) {
+            AssetLoadState state = assetManager.GetAssetState(handle);
+            return state == AssetLoadState::Queued || state == AssetLoadState::Loading;
+        });
+    };
+    while (pending()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    handles.erase(std::remove_if(handles.begin(), handles.end(),
+                                 [&](const AssetHandle& handle) { return !assetManager.IsAssetLoaded(handle); }),
+                  handles.end());
+    if (handles.empty()) {
+        std::printf("No assets could be loaded from %s\n", args.assetDirectory.c_str());
+        return 1;
+    }
+
+    std::printf("Assets: %zu loaded, %d s per run\n", handles.size(), args.iterations);
+    std::printf("%-8s %14s %14s\n", "Threads", "Lookups/s", "Per thread");
+    const auto duration = std::chrono::seconds(args.iterations);
+    for (unsigned threadCount : {1u, 2u, 4u, 8u, 16u}) {
+        std::atomic<bool> stop{false};
+        std::atomic<uint64_t> lookups{0};
+        std::atomic<uint64_t> misses{0};
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&, t]() {
+                uint64_t count = 0;
+                uint64_t missed = 0;
+                // Offset start so threads do not walk the handles in lockstep
+                for (size_t i = t * 7; !stop.load(std::memory_order_relaxed); ++i) {
+                    if (!assetManager.GetAsset<void>(handles[i % handles.size()])) {
+                        ++missed;
+                    }
+                    ++count;
+                }
+                lookups += count;
+                misses += missed;
+            });
+        }
+
+        const double elapsedMs = TimeMs([&]() {
+            std::this_thread::sleep_for(duration);
+            stop = true;
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        });
+        const double perSecond = lookups.load() * 1000.0 / elapsedMs;
+        std::printf("%-8u %14.0f %14.0f\n", threadCount, perSecond, perSecond / threadCount);
+        if (misses.load() > 0) {
+            std::printf("  %llu lookups returned null\n", static_cast<unsigned long long>(misses.load()));
+        }
+    }
+
+    assetManager.Shutdown();
+    return 0;
+}
+
+// Drops the files' cached pages, so the next run reads from the disk.
+// Clean pages only; works without root, unlike drop_caches.
+bool EvictFromPageCache(const std::filesystem::path& root) {
+#ifdef __linux__
+    std::error_code ec;
+    auto evict = [](const std::filesystem::path& path) {
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd >= 0) {
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fd);
+        }
+    };
+    if (!std::filesystem::is_directory(root, ec)) {
+        evict(root);
+        return true;
+    }
+    for (auto it = std::filesystem::recursive_directory_iterator(root, ec);
+         !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        if (it->is_regular_file(ec)) {
+            evict(it->path());
+        }
+    }
+    return true;
+#else
+    (void)root;
+    return false;
+#endif
+}
+
+// Registers and loads every path, then waits for all of them to settle;
+// returns the number that loaded
+size_t LoadAll(AssetManager& assetManager, const std::vector<std::string>& paths) {
+    std::vector<AssetHandle> handles;
+    for (const auto& path : paths) {
+        AssetHandle handle = assetManager.RegisterAsset(path);
+        if (handle.IsValid()) {
+            assetManager.GetAsset<void>(handle);
+            handles.push_back(handle);
+        }
+    }
+    for (const auto& handle : handles) {
+        assetManager.LoadWithDependencies(handle).wait();
+    }
+    return std::count_if(handles.begin(), handles.end(),
+                         [&](const AssetHandle& handle) { return assetManager.IsAssetLoaded(handle); });
+}
+
+int RunPackedBenchmark(const BenchmarkArgs& args) {
+    const std::filesystem::path archivePath = std::filesystem::temp_directory_path() / "AssetBenchmark.apak";
+
+    std::vector<std::string> paths;
+    size_t archiveEntries = 0;
+    {
+        AssetManager assetManager;
+        if (!assetManager.Initialize(args.assetDirectory)) {
+            std::printf("Asset directory not found: %s\n", args.assetDirectory.c_str());
+            return 1;
+        }
+        // It would be mounted by the loose runs too
+        if (std::filesystem::exists(assetManager.GetDefaultArchivePath())) {
+            std::printf("Move %s away first; the loose runs would read it\n",
+                        assetManager.GetDefaultArchivePath().c_str());
+            return 1;
+        }
+
+        // Also warms the derived data cache, so loose runs read cooked data
+        // like packed ones instead of importing sources
+        double packMs = TimeMs([&] { assetManager.BuildArchive(archivePath.string()); });
+        auto archive = AssetArchive::Open(archivePath.string());
+        if (!archive) {
+            std::printf("Packing failed: %s\n", archivePath.string().c_str());
+            return 1;
+        }
+        archiveEntries = archive->GetEntryCount();
+        std::printf("Packed %zu assets in %.1f s (%.1f MB)\n", archiveEntries, packMs / 1000.0,
+                    std::filesystem::file_size(archivePath) / (1024.0 * 1024.0));
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(args.assetDirectory)) {
+            std::string relative = std::filesystem::relative(entry.path(), args.assetDirectory).generic_string();
+            if (entry.is_regular_file() && relative.rfind("Cooked/", 0) != 0 &&
+                archive->Find(AssetArchive::NormalizePath(relative))) {
+                paths.push_back(relative);
+            }
+        }
+    }
+    if (paths.empty()) {
+        std::printf("No assets to load in %s\n", args.assetDirectory.c_str());
+        return 1;
+    }
+
+    auto run = [&](bool packed) {
+        EvictFromPageCache(args.assetDirectory);
+        EvictFromPageCache(archivePath);
+        AssetManager assetManager;
+        size_t loaded = 0;
+        double ms = TimeMs([&] {
+            assetManager.Initialize(args.assetDirectory);
+            if (packed) {
+                assetManager.MountArchive(archivePath.string());
+            }
+            loaded = LoadAll(assetManager, paths);
+        });
+        if (loaded != paths.size()) {
+            std::printf("  %s run loaded %zu of %zu assets\n", packed ? "Packed" : "Loose", loaded, paths.size());
+        }
+        return ms;
+    };
+
+    // Interleaved, so drift in disk or CPU state hits both alike
+    std::vector<double> looseMs;
+    std::vector<double> packedMs;
+    for (int i = 0; i < args.iterations; ++i) {
+        looseMs.push_back(run(false));
+        packedMs.push_back(run(true));
+    }
+    auto median = [](std::vector<double> values) {
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    };
+
+    std::printf("Assets:  %zu (%s cache)\n", paths.size(),
+                EvictFromPageCache(archivePath) ? "cold page" : "warm page, eviction unsupported");
+    std::printf("Loose:   %8.1f ms (median of %d)\n", median(looseMs), args.iterations);
+    std::printf("Packed:  %8.1f ms (median of %d)\n", median(packedMs), args.iterations);
+    std::printf("Speedup: %8.2fx\n", median(looseMs) / std::max(median(packedMs), 1e-3));
+
+    std::error_code ec;
+    std::filesystem::remove(archivePath, ec);
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::map<std::string, std::function<int(const BenchmarkArgs&)>> benchmarks = {
+        {"mesh", RunMeshBenchmark},
+        {"meshopt", RunMeshOptimizerBenchmark},
+        {"packed", RunPackedBenchmark},
+        {"registry", RunRegistryBenchmark},
+    };
+
+    if (argc < 2 || !benchmarks.count(argv[1])) {
+        std::printf("Usage: AssetBenchmark <benchmark> [asset directory] [asset path] [iterations]\n");
+        std::printf("Benchmarks:");
+        for (const auto& [name, fn] : benchmarks) {
+            std::printf(" %s", name.c_str());
+        }
+        std::printf("\n");
+        return 1;
+    }
+
+    BenchmarkArgs args;
+    if (argc > 2) args.assetDirectory = argv[2];
+    if (argc > 3) args.assetPath = argv[3];
+    if (argc > 4) args.iterations = std::max(1, std::atoi(argv[4]));
+
+    Logger::SetLogLevel(Logger::LogLevel::Warning);
+    return benchmarks.at(argv[1])(args);
+}
@@ -0,0 +1,451 @@
+// AsyncFileIO.cpp
+// inkbytefo - AstralEngine
+#include "AsyncFileIO.h"
+#include "Logger.h"
+#include "MappedFile.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <new>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define ASTRAL_IO_URING 1
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace AstralEngine {
+
+namespace {
+
+// Blocking reads only wait on the disk, so a few threads cover it
+constexpr size_t FALLBACK_THREADS = 4;
+// Same alignment mapped files get for free, for readers that cast in place
+constexpr size_t BUFFER_ALIGNMENT = 64;
+// Tries for a submission the kernel refused as busy while none of our reads
+// were in it to complete and make room, 1 ms apart
+constexpr int BUSY_SUBMIT_RETRIES = 16;
+
+} // namespace
+
+struct AsyncFileIO::Operation {
+    ReadRequest request;
+    size_t done = 0; // Bytes read so far; short reads are continued
+    int fd = -1;
+};
+
+#ifdef ASTRAL_IO_URING
+
+struct AsyncFileIO::Ring {
+    int fd = -1;
+    unsigned entries = 0;
+    unsigned inFlight = 0; // Operations in the kernel; at most entries
+
+    void* sqRing = nullptr;
+    size_t sqRingSize = 0;
+    void* cqRing = nullptr;
+    size_t cqRingSize = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqesSize = 0;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned sqMask = 0;
+    unsigned* sqArray = nullptr;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned cqMask = 0;
+    io_uring_cqe* cqes = nullptr;
+
+    ~Ring() {
+        if (sqes) {
+            munmap(sqes, sqesSize);
+        }
+        if (cqRing && cqRing != sqRing) {
+            munmap(cqRing, cqRingSize);
+        }
+        if (sqRing) {
+            munmap(sqRing, sqRingSize);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+
+    // nullptr if the kernel has no usable io_uring
+    static std::unique_ptr<Ring> Create(uint32_t depth) {
+        io_uring_params params{};
+        int fd = static_cast<int>(syscall(__NR_io_uring_setup, depth, &params));
+        if (fd < 0) {
+            Logger::Info("AsyncFileIO", "io_uring unavailable ({}); using blocking I/O threads", std::strerror(errno));
+            return nullptr;
+        }
+        auto ring = std::make_unique<Ring>();
+        ring->fd = fd;
+        // IORING_OP_READ arrived in the same kernel (5.6) as this flag
+        if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+            Logger::Info("AsyncFileIO", "io_uring is too old for plain reads; using blocking I/O threads");
+            return nullptr;
+        }
+
+        ring->entries = params.sq_entries;
+        ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap) {
+            ring->sqRingSize = ring->cqRingSize = std::max(ring->sqRingSize, ring->cqRingSize);
+        }
+
+        void* sqRing = mmap(nullptr, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                            IORING_OFF_SQ_RING);
+        if (sqRing == MAP_FAILED) {
+            return nullptr;
+        }
+        ring->sqRing = sqRing;
+        if (singleMap) {
+            ring->cqRing = sqRing;
+        } else {
+            void* cqRing = mmap(nullptr, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                                IORING_OFF_CQ_RING);
+            if (cqRing == MAP_FAILED) {
+                return nullptr;
+            }
+            ring->cqRing = cqRing;
+        }
+        ring->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = mmap(nullptr, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                          IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            return nullptr;
+        }
+        ring->sqes = static_cast<io_uring_sqe*>(sqes);
+
+        auto* sq = static_cast<uint8_t*>(ring->sqRing);
+        ring->sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        ring->sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        ring->sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        ring->sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        auto* cq = static_cast<uint8_t*>(ring->cqRing);
+        ring->cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        ring->cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        ring->cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        ring->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return ring;
+    }
+
+    // Only one thread pushes at a time (AsyncFileIO::m_mutex)
+    void Push(uint8_t opcode, int file, void* buffer, uint32_t length, uint64_t offset, uint64_t userData) {
+        unsigned tail = *sqTail;
+        unsigned index = tail & sqMask;
+        io_uring_sqe& sqe = sqes[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = opcode;
+        sqe.fd = file;
+        sqe.addr = reinterpret_cast<uint64_t>(buffer);
+        sqe.len = length;
+        sqe.off = offset;
+        sqe.user_data = userData;
+        sqArray[index] = index;
+        std::atomic_ref<unsigned>(*sqTail).store(tail + 1, std::memory_order_release);
+    }
+
+    // Pushed entries the kernel has not consumed yet
+    unsigned GetUnsubmitted() const {
+        return *sqTail - std::atomic_ref<unsigned>(*sqHead).load(std::memory_order_acquire);
+    }
+
+    // Hands everything pushed so far to the kernel; same locking as Push.
+    // Returns 0, or the errno that left entries unsubmitted in the ring.
+    int Submit() {
+        for (unsigned toSubmit = GetUnsubmitted(); toSubmit > 0; toSubmit = GetUnsubmitted()) {
+            long submitted = syscall(__NR_io_uring_enter, fd, toSubmit, 0, 0, nullptr, 0);
+            if (submitted < 0 && errno != EINTR) {
+                return errno;
+            }
+            if (submitted == 0) {
+                return EAGAIN;
+            }
+        }
+        return 0;
+    }
+
+    // Takes back the entries Submit left behind; returns their user data
+    std::vector<uint64_t> Unpush() {
+        std::vector<uint64_t> userData;
+        unsigned head = std::atomic_ref<unsigned>(*sqHead).load(std::memory_order_acquire);
+        for (unsigned tail = head; tail != *sqTail; ++tail) {
+            userData.push_back(sqes[sqArray[tail & sqMask]].user_data);
+        }
+        std::atomic_ref<unsigned>(*sqTail).store(head, std::memory_order_release);
+        return userData;
+    }
+
+    // Blocks until at least one completion is posted
+    void Wait() {
+        while (syscall(__NR_io_uring_enter, fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno == EINTR) {
+        }
+    }
+};
+
+#else
+
+struct AsyncFileIO::Ring {};
+
+#endif
+
+AsyncFileIO::AsyncFileIO(uint32_t queueDepth) {
+#ifdef ASTRAL_IO_URING
+    m_ring = Ring::Create(queueDepth);
+    if (m_ring) {
+        m_completionThread = std::thread(&AsyncFileIO::RunCompletions, this);
+        return;
+    }
+#else
+    (void)queueDepth;
+#endif
+    m_fallbackPool = std::make_unique<ThreadPool>(FALLBACK_THREADS);
+}
+
+AsyncFileIO::~AsyncFileIO() {
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idleCondition.wait(lock, [this]() { return m_pending == 0; });
+    }
+#ifdef ASTRAL_IO_URING
+    if (m_ring) {
+        // A no-op with no operation attached tells the completion thread to exit.
+        // Nothing else is in flight, so a busy ring only clears with time; the
+        // lock is dropped between tries so the completion thread can drain.
+        bool pushed = false;
+        for (;;) {
+            int error = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!pushed) {
+                    m_ring->Push(IORING_OP_NOP, -1, nullptr, 0, 0, 0);
+                    pushed = true;
+                }
+                error = m_ring->Submit();
+            }
+            if (error != EAGAIN && error != EBUSY) {
+                if (error != 0) {
+                    Logger::Error("AsyncFileIO", "Cannot stop the io_uring completion thread: {}", std::strerror(error));
+                }
+                break;
+            }
+            std::this_thread::yield();
+        }
+    }
+#endif
+    if (m_completionThread.joinable()) {
+        m_completionThread.join();
+    }
+    m_fallbackPool.reset();
+}
+
+void AsyncFileIO::Read(ReadRequest request) {
+    std::vector<ReadRequest> requests;
+    requests.push_back(std::move(request));
+    Submit(std::move(requests));
+}
+
+void AsyncFileIO::Submit(std::vector<ReadRequest> requests) {
+    std::vector<Operation*> operations;
+    operations.reserve(requests.size());
+    for (auto& request : requests) {
+        auto operation = std::make_unique<Operation>();
+        operation->request = std::move(request);
+#ifdef ASTRAL_IO_URING
+        if (m_ring) {
+            operation->fd = open(operation->request.path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (operation->fd < 0) {
+                operation->request.callback(-static_cast<int64_t>(errno));
+                continue;
+            }
+        }
+#endif
+        operations.push_back(operation.release());
+    }
+    if (operations.empty()) {
+        return;
+    }
+
+    std::vector<std::pair<Operation*, int64_t>> failed;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending += operations.size();
+        if (!m_ring) {
+            for (Operation* operation : operations) {
+                m_fallbackPool->Submit([this, operation]() { RunBlockingRead(operation); });
+            }
+            return;
+        }
+        m_queued.insert(m_queued.end(), operations.begin(), operations.end());
+        FlushQueue(failed);
+    }
+    for (auto& [operation, result] : failed) {
+        Complete(operation, result);
+    }
+}
+
+void AsyncFileIO::ReadFile(const std::string& path, FileCallback callback) {
+    std::error_code ec;
+    uint64_t size = std::filesystem::file_size(path, ec);
+    if (ec || size == 0) {
+        // MappedFile::Open fails on empty files too
+        callback(nullptr);
+        return;
+    }
+
+    std::shared_ptr<uint8_t> buffer(
+        static_cast<uint8_t*>(::operator new(size, std::align_val_t(BUFFER_ALIGNMENT))),
+        [](uint8_t* p) { ::operator delete(p, std::align_val_t(BUFFER_ALIGNMENT)); });
+
+    ReadRequest request;
+    request.path = path;
+    request.buffer = buffer.get();
+    request.size = size;
+    request.callback = [buffer, size, path, callback = std::move(callback)](int64_t result) {
+        if (result != static_cast<int64_t>(size)) {
+            Logger::Warning("AsyncFileIO", "Failed to read '{}': {}", path,
+                            result < 0 ? std::strerror(static_cast<int>(-result)) : "file changed size");
+            callback(nullptr);
+            return;
+        }
+        callback(MappedFile::FromMemory(buffer.get(), size, buffer));
+    };
+    Read(std::move(request));
+}
+
+void AsyncFileIO::FlushQueue(std::vector<std::pair<Operation*, int64_t>>& failed) {
+#ifdef ASTRAL_IO_URING
+    for (;;) {
+        while (!m_queued.empty() && m_ring->inFlight < m_ring->entries) {
+            Operation* operation = m_queued.front();
+            m_queued.pop_front();
+            const ReadRequest& request = operation->request;
+            // One read moves at most 1 GB; larger requests continue on completion
+            size_t length = std::min<size_t>(request.size - operation->done, 1u << 30);
+            m_ring->Push(IORING_OP_READ, operation->fd, static_cast<uint8_t*>(request.buffer) + operation->done,
+                         static_cast<uint32_t>(length), request.offset + operation->done,
+                         reinterpret_cast<uint64_t>(operation));
+            ++m_ring->inFlight;
+        }
+
+        // Also retries entries an earlier call left in the ring
+        int error = m_ring->Submit();
+        // A full completion queue (EBUSY) or a short kernel allocation (EAGAIN)
+        // clears once completions are drained, and the completion thread calls
+        // back here after each drain. That only happens while some read is still
+        // in the kernel; otherwise the queue is already drained, so retry a few
+        // times before failing the reads, as for any other error.
+        for (int attempt = 0; (error == EAGAIN || error == EBUSY) && attempt < BUSY_SUBMIT_RETRIES; ++attempt) {
+            if (m_ring->inFlight > m_ring->GetUnsubmitted()) {
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            error = m_ring->Submit();
+        }
+        if (error == 0) {
+            return;
+        }
+        Logger::Warning("AsyncFileIO", "io_uring rejected reads: {}", std::strerror(error));
+        for (uint64_t userData : m_ring->Unpush()) {
+            --m_ring->inFlight;
+            failed.emplace_back(reinterpret_cast<Operation*>(userData), -static_cast<int64_t>(error));
+        }
+        // Nothing is left in the kernel to call back here, so the rest of the
+        // queue gets its own attempt now
+        if (m_queued.empty()) {
+            return;
+        }
+    }
+#else
+    (void)failed;
+#endif
+}
+
+void AsyncFileIO::RunCompletions() {
+#ifdef ASTRAL_IO_URING
+    for (;;) {
+        m_ring->Wait();
+
+        std::vector<std::pair<Operation*, int64_t>> completed;
+        bool stop = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            unsigned head = *m_ring->cqHead;
+            unsigned tail = std::atomic_ref<unsigned>(*m_ring->cqTail).load(std::memory_order_acquire);
+            for (; head != tail; ++head) {
+                const io_uring_cqe& cqe = m_ring->cqes[head & m_ring->cqMask];
+                auto* operation = reinterpret_cast<Operation*>(cqe.user_data);
+                if (!operation) {
+                    stop = true;
+                    continue;
+                }
+                --m_ring->inFlight;
+                if (cqe.res > 0) {
+                    operation->done += static_cast<size_t>(cqe.res);
+                    if (operation->done < operation->request.size) {
+                        // Short read; the rest goes back in front of the queue
+                        m_queued.push_front(operation);
+                        continue;
+                    }
+                }
+                completed.emplace_back(operation, cqe.res < 0 ? cqe.res : static_cast<int64_t>(operation->done));
+            }
+            std::atomic_ref<unsigned>(*m_ring->cqHead).store(head, std::memory_order_release);
+            FlushQueue(completed);
+        }
+
+        for (auto& [operation, result] : completed) {
+            Complete(operation, result);
+        }
+        if (stop) {
+            return;
+        }
+    }
+#endif
+}
+
+void AsyncFileIO::RunBlockingRead(Operation* operation) {
+    const ReadRequest& request = operation->request;
+    std::ifstream file(request.path, std::ios::binary);
+    if (!file) {
+        Complete(operation, -static_cast<int64_t>(ENOENT));
+        return;
+    }
+    file.seekg(static_cast<std::streamoff>(request.offset));
+    file.read(static_cast<char*>(request.buffer), static_cast<std::streamsize>(request.size));
+    if (file.bad()) {
+        Complete(operation, -static_cast<int64_t>(EIO));
+        return;
+    }
+    Complete(operation, static_cast<int64_t>(file.gcount()));
+}
+
+void AsyncFileIO::Complete(Operation* operation, int64_t result) {
+#ifdef ASTRAL_IO_URING
+    if (operation->fd >= 0) {
+        close(operation->fd);
+    }
+#endif
+    operation->request.callback(result);
+    delete operation;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (--m_pending == 0) {
+        m_idleCondition.notify_all();
+    }
+}
+
+} // namespace AstralEngine
@@ -0,0 +1,89 @@
+// AsyncFileIO.h
+// inkbytefo - AstralEngine
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace AstralEngine {
+
+class MappedFile;
+class ThreadPool;
+
+/**
+ * @brief Asynchronous file reads, so threads that need file data do not
+ *        block on the disk while it arrives.
+ *
+ * Reads go into caller-owned buffers and report through a callback. On
+ * Linux, requests are batched into an io_uring and complete on a single
+ * completion thread. Elsewhere, or where io_uring is unavailable (old
+ * kernels, seccomp filters), a few dedicated I/O threads run blocking reads.
+ * Callbacks run on those I/O threads: keep them short and hand decoding to a
+ * worker pool.
+ */
+class AsyncFileIO {
+public:
+    // Bytes read (fewer than asked only at end of file), or a negative errno value
+    using ReadCallback = std::function<void(int64_t result)>;
+    // The whole file, or nullptr if it could not be read
+    using FileCallback = std::function<void(std::shared_ptr<MappedFile> file)>;
+
+    struct ReadRequest {
+        std::string path;
+        uint64_t offset = 0;
+        void* buffer = nullptr; // Caller-owned; must stay valid until the callback has run
+        size_t size = 0;
+        ReadCallback callback;
+    };
+
+    // queueDepth bounds the reads in flight at once; more are queued
+    explicit AsyncFileIO(uint32_t queueDepth = 64);
+    // Waits for every submitted read and runs its callback
+    ~AsyncFileIO();
+
+    // Non-copyable
+    AsyncFileIO(const AsyncFileIO&) = delete;
+    AsyncFileIO& operator=(const AsyncFileIO&) = delete;
+
+    // Starts all the reads with one system call where the backend allows it.
+    // A file that cannot be opened reports its error before this returns.
+    void Submit(std::vector<ReadRequest> requests);
+    void Read(ReadRequest request);
+
+    // Reads a whole file into a new buffer, aligned like a mapping; callers
+    // that used MappedFile::Open can take the result as is
+    void ReadFile(const std::string& path, FileCallback callback);
+
+    bool IsUsingIoUring() const { return m_ring != nullptr; }
+
+private:
+    struct Operation;
+    struct Ring; // io_uring state, Linux only
+
+    // With m_mutex held; moves queued operations into free ring slots. Reads
+    // the kernel refused are added to failed, to complete once the lock is released.
+    void FlushQueue(std::vector<std::pair<Operation*, int64_t>>& failed);
+    void RunCompletions();
+    void RunBlockingRead(Operation* operation);
+    void Complete(Operation* operation, int64_t result);
+
+    std::unique_ptr<Ring> m_ring;
+    std::thread m_completionThread;
+    std::unique_ptr<ThreadPool> m_fallbackPool;
+
+    std::mutex m_mutex;
+    std::condition_variable m_idleCondition;
+    size_t m_pending = 0;                // Submitted and not completed yet
+    std::deque<Operation*> m_queued;     // Waiting for a ring slot
+};
+
+} // namespace AstralEngine
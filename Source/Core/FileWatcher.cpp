@@ -0,0 +1,249 @@
+// FileWatcher.cpp
+// inkbytefo - AstralEngine
+#include "FileWatcher.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <set>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace AstralEngine {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+#ifdef __linux__
+constexpr uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR;
+#else
+constexpr std::chrono::seconds SCAN_INTERVAL{1};
+#endif
+
+} // namespace
+
+FileWatcher::~FileWatcher() {
+    Stop();
+}
+
+bool FileWatcher::Start(const std::string& directory, Callback callback, std::chrono::milliseconds coalesceDelay) {
+    if (IsRunning()) {
+        Logger::Warning("FileWatcher", "Already watching '{}'", m_directory);
+        return false;
+    }
+    std::error_code ec;
+    if (!std::filesystem::is_directory(directory, ec)) {
+        Logger::Error("FileWatcher", "Not a directory: '{}'", directory);
+        return false;
+    }
+
+    m_directory = directory;
+    m_callback = std::move(callback);
+    m_coalesceDelay = coalesceDelay;
+    m_stop = false;
+
+#ifdef __linux__
+    m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_inotifyFd < 0 || m_wakeFd < 0) {
+        Logger::Error("FileWatcher", "Cannot create inotify instance: {}", std::strerror(errno));
+        Stop();
+        return false;
+    }
+    // Files that exist now are not changes
+    std::vector<std::string> existing;
+    AddWatchRecursive(m_directory, existing);
+#else
+    std::vector<std::string> existing;
+    Scan(existing);
+#endif
+
+    m_thread = std::thread(&FileWatcher::Run, this);
+    Logger::Info("FileWatcher", "Watching '{}' for changes", m_directory);
+    return true;
+}
+
+void FileWatcher::Stop() {
+    m_stop = true;
+#ifdef __linux__
+    if (m_wakeFd >= 0) {
+        uint64_t one = 1;
+        [[maybe_unused]] ssize_t written = write(m_wakeFd, &one, sizeof(one));
+    }
+#else
+    {
+        std::lock_guard<std::mutex> lock(m_stopMutex);
+    }
+    m_stopCondition.notify_all();
+#endif
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+#ifdef __linux__
+    if (m_inotifyFd >= 0) {
+        close(m_inotifyFd); // Removes every watch
+        m_inotifyFd = -1;
+    }
+    if (m_wakeFd >= 0) {
+        close(m_wakeFd);
+        m_wakeFd = -1;
+    }
+    m_watchDirectories.clear();
+#else
+    m_timestamps.clear();
+#endif
+}
+
+#ifdef __linux__
+
+void FileWatcher::AddWatchRecursive(const std::string& directory, std::vector<std::string>& found) {
+    int wd = inotify_add_watch(m_inotifyFd, directory.c_str(), WATCH_MASK);
+    if (wd < 0) {
+        // Usually fs.inotify.max_user_watches; changes below are missed
+        Logger::Warning("FileWatcher", "Cannot watch '{}': {}", directory, std::strerror(errno));
+        return;
+    }
+    m_watchDirectories[wd] = directory;
+
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        if (entry.is_directory(ec)) {
+            AddWatchRecursive(entry.path().string(), found);
+        } else {
+            found.push_back(entry.path().string());
+        }
+    }
+}
+
+void FileWatcher::Run() {
+    std::set<std::string> pending;
+    Clock::time_point lastChange;
+    alignas(inotify_event) char buffer[16 * 1024];
+
+    while (!m_stop) {
+        // Sleeps until something happens; with changes pending, only until
+        // they have been quiet for the coalesce delay
+        int timeout = -1;
+        if (!pending.empty()) {
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                lastChange + m_coalesceDelay - Clock::now());
+            timeout = static_cast<int>(std::max<int64_t>(0, remaining.count()));
+        }
+
+        pollfd fds[2] = {{m_inotifyFd, POLLIN, 0}, {m_wakeFd, POLLIN, 0}};
+        if (poll(fds, 2, timeout) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            Logger::Error("FileWatcher", "poll failed: {}", std::strerror(errno));
+            break;
+        }
+        if (fds[1].revents & POLLIN) {
+            break;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            ssize_t length;
+            while ((length = read(m_inotifyFd, buffer, sizeof(buffer))) > 0) {
+                for (char* ptr = buffer; ptr < buffer + length;) {
+                    const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+                    ptr += sizeof(inotify_event) + event->len;
+
+                    if (event->mask & IN_Q_OVERFLOW) {
+                        Logger::Warning("FileWatcher", "Event queue overflowed; some changes were missed");
+                        continue;
+                    }
+                    if (event->mask & IN_IGNORED) {
+                        m_watchDirectories.erase(event->wd);
+                        continue;
+                    }
+                    auto it = m_watchDirectories.find(event->wd);
+                    if (it == m_watchDirectories.end() || event->len == 0) {
+                        continue;
+                    }
+
+                    std::string path = it->second + "/" + event->name;
+                    if (event->mask & IN_ISDIR) {
+                        std::vector<std::string> found;
+                        AddWatchRecursive(path, found);
+                        pending.insert(found.begin(), found.end());
+                    } else if (event->mask & IN_CREATE) {
+                        // Reported by the IN_CLOSE_WRITE that follows the write
+                        continue;
+                    } else {
+                        pending.insert(std::move(path));
+                    }
+                    lastChange = Clock::now();
+                }
+            }
+        }
+
+        if (!pending.empty() && Clock::now() - lastChange >= m_coalesceDelay) {
+            std::vector<std::string> changed(pending.begin(), pending.end());
+            pending.clear();
+            m_callback(changed);
+        }
+    }
+}
+
+#else
+
+void FileWatcher::Scan(std::vector<std::string>& changed) {
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(m_directory, ec);
+         !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        if (!it->is_regular_file(ec)) {
+            continue;
+        }
+        auto time = it->last_write_time(ec);
+        auto [entry, inserted] = m_timestamps.try_emplace(it->path().string(), time);
+        if (!inserted && entry->second != time) {
+            entry->second = time;
+            changed.push_back(entry->first);
+        } else if (inserted) {
+            changed.push_back(entry->first);
+        }
+    }
+}
+
+void FileWatcher::Run() {
+    std::set<std::string> pending;
+    Clock::time_point lastChange;
+
+    while (!m_stop) {
+        {
+            std::unique_lock<std::mutex> lock(m_stopMutex);
+            m_stopCondition.wait_for(lock, SCAN_INTERVAL, [this]() { return m_stop.load(); });
+        }
+        if (m_stop) {
+            break;
+        }
+
+        std::vector<std::string> changed;
+        Scan(changed);
+        if (!changed.empty()) {
+            pending.insert(changed.begin(), changed.end());
+            lastChange = Clock::now();
+        }
+
+        if (!pending.empty() && Clock::now() - lastChange >= m_coalesceDelay) {
+            std::vector<std::string> batch(pending.begin(), pending.end());
+            pending.clear();
+            m_callback(batch);
+        }
+    }
+}
+
+#endif
+
+} // namespace AstralEngine
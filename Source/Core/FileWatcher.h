@@ -0,0 +1,74 @@
+// FileWatcher.h
+// inkbytefo - AstralEngine
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifndef __linux__
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#endif
+
+namespace AstralEngine {
+
+/**
+ * @brief Watches a directory tree for changed files on a background thread.
+ *
+ * On Linux the watcher blocks on inotify; elsewhere it rescans modification
+ * times once a second. Bursts of changes (an editor saving through a
+ * temporary file, a tool exporting many files) are coalesced: the callback
+ * runs once no new change has arrived for the coalesce delay.
+ */
+class FileWatcher {
+public:
+    // Full paths of the files written, created or moved in since the last call
+    using Callback = std::function<void(const std::vector<std::string>& changedFiles)>;
+
+    FileWatcher() = default;
+    ~FileWatcher();
+
+    // Non-copyable
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // Watches directory and its subdirectories; callback runs on the watcher thread
+    bool Start(const std::string& directory, Callback callback,
+               std::chrono::milliseconds coalesceDelay = std::chrono::milliseconds(250));
+    // Joins the watcher thread; no callback runs after this returns
+    void Stop();
+    bool IsRunning() const { return m_thread.joinable(); }
+
+private:
+    void Run();
+
+    std::string m_directory;
+    Callback m_callback;
+    std::chrono::milliseconds m_coalesceDelay{0};
+    std::thread m_thread;
+    std::atomic<bool> m_stop{false};
+
+#ifdef __linux__
+    // Adds a watch for directory and every directory below it; files already
+    // inside are reported, since they may have arrived with the directory
+    void AddWatchRecursive(const std::string& directory, std::vector<std::string>& found);
+
+    int m_inotifyFd = -1;
+    int m_wakeFd = -1; // eventfd that interrupts the poll on Stop
+    std::unordered_map<int, std::string> m_watchDirectories;
+#else
+    void Scan(std::vector<std::string>& changed);
+
+    std::mutex m_stopMutex;
+    std::condition_variable m_stopCondition;
+    std::unordered_map<std::string, std::filesystem::file_time_type> m_timestamps;
+#endif
+};
+
+} // namespace AstralEngine
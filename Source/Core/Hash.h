@@ -0,0 +1,115 @@
+// Hash.h
+// inkbytefo - AstralEngine
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace AstralEngine {
+
+/**
+ * @brief Stable, non-cryptographic hashing (XXH64).
+ *
+ * Output is identical across platforms, compilers and runs, so it is safe
+ * to persist (cache keys, asset IDs), unlike std::hash.
+ */
+class Hash {
+public:
+    static uint64_t XXH64(const void* data, size_t size, uint64_t seed = 0) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        const uint8_t* end = p + size;
+        uint64_t h;
+
+        if (size >= 32) {
+            uint64_t v1 = seed + P1 + P2;
+            uint64_t v2 = seed + P2;
+            uint64_t v3 = seed;
+            uint64_t v4 = seed - P1;
+            const uint8_t* limit = end - 32;
+            do {
+                v1 = Round(v1, Read64(p));
+                v2 = Round(v2, Read64(p + 8));
+                v3 = Round(v3, Read64(p + 16));
+                v4 = Round(v4, Read64(p + 24));
+                p += 32;
+            } while (p <= limit);
+
+            h = Rotl(v1, 1) + Rotl(v2, 7) + Rotl(v3, 12) + Rotl(v4, 18);
+            h = MergeRound(h, v1);
+            h = MergeRound(h, v2);
+            h = MergeRound(h, v3);
+            h = MergeRound(h, v4);
+        } else {
+            h = seed + P5;
+        }
+
+        h += static_cast<uint64_t>(size);
+
+        while (p + 8 <= end) {
+            h ^= Round(0, Read64(p));
+            h = Rotl(h, 27) * P1 + P4;
+            p += 8;
+        }
+        if (p + 4 <= end) {
+            h ^= static_cast<uint64_t>(Read32(p)) * P1;
+            h = Rotl(h, 23) * P2 + P3;
+            p += 4;
+        }
+        while (p < end) {
+            h ^= static_cast<uint64_t>(*p) * P5;
+            h = Rotl(h, 11) * P1;
+            ++p;
+        }
+
+        h ^= h >> 33;
+        h *= P2;
+        h ^= h >> 29;
+        h *= P3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    static uint64_t XXH64(std::string_view text, uint64_t seed = 0) {
+        return XXH64(text.data(), text.size(), seed);
+    }
+
+    // Order-dependent combination of two hashes
+    static uint64_t Combine(uint64_t seed, uint64_t value) {
+        return XXH64(&value, sizeof(value), seed);
+    }
+
+private:
+    static constexpr uint64_t P1 = 11400714785074694791ull;
+    static constexpr uint64_t P2 = 14029467366897019727ull;
+    static constexpr uint64_t P3 = 1609587929392839161ull;
+    static constexpr uint64_t P4 = 9650029242287828579ull;
+    static constexpr uint64_t P5 = 2870177450012600261ull;
+
+    static uint64_t Rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+    // Little-endian reads; every platform we target is little-endian
+    static uint64_t Read64(const uint8_t* p) {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    static uint32_t Read32(const uint8_t* p) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    static uint64_t Round(uint64_t acc, uint64_t input) {
+        acc += input * P2;
+        acc = Rotl(acc, 31);
+        return acc * P1;
+    }
+    static uint64_t MergeRound(uint64_t acc, uint64_t value) {
+        acc ^= Round(0, value);
+        return acc * P1 + P4;
+    }
+};
+
+} // namespace AstralEngine
@@ -0,0 +1,132 @@
+// MappedFile.cpp
+// inkbytefo - AstralEngine
+#include "MappedFile.h"
+#include "Logger.h"
+
+#include <algorithm>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace AstralEngine {
+
+std::shared_ptr<MappedFile> MappedFile::Open(const std::string& filePath, bool prefetch) {
+    std::shared_ptr<MappedFile> file(new MappedFile());
+
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, prefetch ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+    file->m_fileHandle = fileHandle;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fileHandle, &size) || size.QuadPart == 0) {
+        return nullptr;
+    }
+
+    HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mappingHandle) {
+        Logger::Error("MappedFile", "CreateFileMapping failed for '{}'", filePath);
+        return nullptr;
+    }
+    file->m_mappingHandle = mappingHandle;
+
+    void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        Logger::Error("MappedFile", "MapViewOfFile failed for '{}'", filePath);
+        return nullptr;
+    }
+    file->m_data = static_cast<const uint8_t*>(data);
+    file->m_size = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        Logger::Error("MappedFile", "mmap failed for '{}'", filePath);
+        return nullptr;
+    }
+
+    // Whole-file consumers read it front to back right away; partial readers
+    // should not pull in pages they never touch
+    madvise(data, static_cast<size_t>(st.st_size), prefetch ? MADV_WILLNEED : MADV_RANDOM);
+
+    file->m_data = static_cast<const uint8_t*>(data);
+    file->m_size = static_cast<size_t>(st.st_size);
+#endif
+
+    return file;
+}
+
+std::shared_ptr<MappedFile> MappedFile::FromMemory(const uint8_t* data, size_t size, std::shared_ptr<const void> owner) {
+    std::shared_ptr<MappedFile> file(new MappedFile());
+    file->m_data = data;
+    file->m_size = size;
+    file->m_owner = std::move(owner);
+    return file;
+}
+
+void MappedFile::Prefetch(size_t offset, size_t size) const {
+    if (!m_data || offset >= m_size) {
+        return;
+    }
+    size = std::min(size, m_size - offset);
+
+#ifdef _WIN32
+    WIN32_MEMORY_RANGE_ENTRY range{const_cast<uint8_t*>(m_data) + offset, size};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    // madvise needs a page-aligned address; a view's data starts anywhere in
+    // its parent's mapping, so align the address rather than the offset
+    const uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t start = reinterpret_cast<uintptr_t>(m_data) + offset;
+    const uintptr_t alignedStart = start & ~(pageSize - 1);
+    madvise(reinterpret_cast<void*>(alignedStart), size + (start - alignedStart), MADV_WILLNEED);
+#endif
+}
+
+MappedFile::~MappedFile() {
+    if (m_owner) {
+        return;
+    }
+#ifdef _WIN32
+    if (m_data) {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mappingHandle) {
+        CloseHandle(m_mappingHandle);
+    }
+    if (m_fileHandle) {
+        CloseHandle(m_fileHandle);
+    }
+#else
+    if (m_data) {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+}
+
+} // namespace AstralEngine
@@ -0,0 +1,71 @@
+// MappedFile.h
+// inkbytefo - AstralEngine
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace AstralEngine {
+
+/**
+ * @brief Read-only memory-mapped view of a whole file.
+ *
+ * The mapping lives as long as the object; share it through a shared_ptr to
+ * keep pointers into the file valid while other objects still use them.
+ */
+class MappedFile {
+public:
+    ~MappedFile();
+
+    // Non-copyable
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Maps the file at the given path.
+     * @param prefetch Read the whole file ahead; pass false when only parts
+     *        of it are used (e.g. texture mips), then call Prefetch for those.
+     * @return The mapping, or nullptr if the file can't be opened or is empty.
+     */
+    static std::shared_ptr<MappedFile> Open(const std::string& filePath, bool prefetch = true);
+
+    /**
+     * @brief Wraps memory that something else owns, e.g. one entry of a
+     *        mapped archive or a decompressed buffer, as a file.
+     * @param owner Kept alive as long as the view; nothing is unmapped or
+     *        freed by the view itself.
+     */
+    static std::shared_ptr<MappedFile> FromMemory(const uint8_t* data, size_t size, std::shared_ptr<const void> owner);
+
+    const uint8_t* GetData() const { return m_data; }
+    size_t GetSize() const { return m_size; }
+
+    // Asks the OS to start reading [offset, offset + size) in the background
+    void Prefetch(size_t offset, size_t size) const;
+
+    /**
+     * @brief True if count elements of elementSize bytes starting at offset
+     *        lie within total bytes.
+     *
+     * For offsets and counts read from a file: written as a subtraction and a
+     * division, so hostile values cannot wrap around and pass.
+     */
+    static bool RangeFits(uint64_t offset, uint64_t count, uint64_t elementSize, uint64_t total) {
+        return offset <= total && (elementSize == 0 || count <= (total - offset) / elementSize);
+    }
+
+private:
+    MappedFile() = default;
+
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    std::shared_ptr<const void> m_owner; // Set for views made by FromMemory
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#endif
+};
+
+} // namespace AstralEngine
@@ -42,6 +42,18 @@ struct AABB {
     void Extend(const AABB& other) {
         Merge(other);
     }
+
+    // Bounds of this box after an affine transform (all 8 corners)
+    AABB Transformed(const glm::mat4& matrix) const {
+        AABB result;
+        for (int i = 0; i < 8; ++i) {
+            glm::vec3 corner((i & 1) ? max.x : min.x,
+                             (i & 2) ? max.y : min.y,
+                             (i & 4) ? max.z : min.z);
+            result.Merge(glm::vec3(matrix * glm::vec4(corner, 1.0f)));
+        }
+        return result;
+    }
 };
 
 } // namespace AstralEngine
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Bounds.h"
+#include <glm/glm.hpp>
+
+namespace AstralEngine {
+
+// View frustum as six inward-facing planes (xyz = normal, w = distance)
+struct Frustum {
+    glm::vec4 planes[6];
+
+    // Extracts planes from a view-projection matrix with [-1, 1] depth, which
+    // is what glm::perspective builds unless GLM_FORCE_DEPTH_ZERO_TO_ONE is
+    // set. Planes are in whatever space the matrix maps from.
+    static Frustum FromMatrix(const glm::mat4& m) {
+        glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+        Frustum frustum;
+        frustum.planes[0] = row3 + row0; // Left
+        frustum.planes[1] = row3 - row0; // Right
+        frustum.planes[2] = row3 + row1; // Bottom
+        frustum.planes[3] = row3 - row1; // Top
+        frustum.planes[4] = row3 + row2; // Near
+        frustum.planes[5] = row3 - row2; // Far
+
+        for (auto& plane : frustum.planes) {
+            float length = glm::length(glm::vec3(plane));
+            if (length > 0.0f) {
+                plane /= length;
+            }
+        }
+        return frustum;
+    }
+
+    bool IntersectsSphere(const glm::vec3& center, float radius) const {
+        for (const auto& plane : planes) {
+            if (glm::dot(glm::vec3(plane), center) + plane.w < -radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool IntersectsAABB(const AABB& box) const {
+        for (const auto& plane : planes) {
+            // Corner furthest along the plane normal
+            glm::vec3 positive(plane.x >= 0.0f ? box.max.x : box.min.x,
+                               plane.y >= 0.0f ? box.max.y : box.min.y,
+                               plane.z >= 0.0f ? box.max.z : box.min.z);
+            if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace AstralEngine
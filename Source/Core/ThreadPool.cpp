@@ -2,6 +2,9 @@
 // inkbytefo - AstralEngine
 #include "ThreadPool.h"
 
+#include <algorithm>
+#include <exception>
+
 namespace AstralEngine {
 
 ThreadPool::ThreadPool(size_t num_threads) : m_stop(false) {
@@ -52,4 +55,68 @@ ThreadPool::~ThreadPool() {
     }
 }
 
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+
+    // Shared with helper tasks, which may only start after this call returned;
+    // they never touch body once every item has been claimed
+    struct State {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::exception_ptr error; // First exception thrown by body, guarded by mutex
+    };
+    auto state = std::make_shared<State>();
+
+    auto work = [state, count, &body]() {
+        size_t completed = 0;
+        for (size_t i = state->next.fetch_add(1); i < count; i = state->next.fetch_add(1)) {
+            try {
+                body(i);
+            } catch (...) {
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    if (!state->error) {
+                        state->error = std::current_exception();
+                    }
+                }
+                // Claim every item nobody has started so the others stop early;
+                // the skipped items count as done so the caller can still wait
+                size_t claimed = state->next.exchange(count);
+                if (claimed < count) {
+                    completed += count - claimed;
+                }
+            }
+            completed++;
+        }
+        if (completed > 0 && state->done.fetch_add(completed) + completed == count) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->finished.notify_all();
+        }
+    };
+
+    size_t helpers = std::min(count - 1, m_workers.size());
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        if (!m_stop) {
+            for (size_t i = 0; i < helpers; ++i) {
+                m_tasks.emplace(work);
+            }
+        }
+    }
+    m_condition.notify_all();
+
+    work();
+
+    // Wait even if body threw here: helpers still running items reference body
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&state, count] { return state->done == count; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
 } // namespace AstralEngine
@@ -49,6 +49,23 @@ public:
     template<class F, class... Args>
     auto Submit(F&& f, Args&&... args) -> std::future<decltype(f(args...))>;
 
+    /**
+     * @brief Runs body(i) for every i in [0, count) on the pool and blocks until all are done.
+     *
+     * The calling thread takes items too, so this is safe to call from a task
+     * already running on the pool: if every worker is busy the caller simply
+     * does all the work itself.
+     *
+     * If body throws, items not yet started are skipped and the first exception
+     * is rethrown here once every running item has finished.
+     *
+     * @param count Number of items.
+     * @param body Called once per item, from any thread.
+     */
+    void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+
+    size_t GetThreadCount() const { return m_workers.size(); }
+
 private:
     // Worker threads
     std::vector<std::thread> m_workers;
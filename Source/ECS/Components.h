@@ -63,12 +63,18 @@ struct TransformComponent {
 struct RenderComponent {
     AssetHandle materialHandle;
     AssetHandle modelHandle;
+    std::vector<AssetHandle> materialSlots; // Submesh materialIndex başına override; boş/geçersizse materialHandle
     bool visible = true;
     int renderLayer = 0; // Lower values render first
     
     // Render özellikleri
     bool castsShadows = true;
     bool receivesShadows = true;
+
+    // LOD seçimi
+    float lodBias = 1.0f;  // >1 daha erken kaba LOD'a geçer, <1 detayı daha uzun tutar
+    int forcedLod = -1;    // -1: otomatik, aksi halde sabit LOD
+    uint32_t currentLod = 0; // Son seçilen LOD (runtime, kaydedilmez)
     
     RenderComponent() = default;
     
@@ -85,6 +91,14 @@ struct RenderComponent {
     AssetHandle GetMaterialHandle() const {
         return materialHandle;
     }
+
+    // Submesh material slot'u için handle (override yoksa materialHandle)
+    AssetHandle GetMaterialHandle(uint32_t slot) const {
+        if (slot < materialSlots.size() && materialSlots[slot].IsValid()) {
+            return materialSlots[slot];
+        }
+        return materialHandle;
+    }
     
     // Model asset handle'ını al
     AssetHandle GetModelHandle() const {
@@ -0,0 +1,384 @@
+#include "AssetArchive.h"
+#include "../../Core/Hash.h"
+#include "../../Core/Logger.h"
+#include "../../Core/MappedFile.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <system_error>
+
+#ifdef ASTRAL_HAS_LZ4
+#include <lz4.h>
+#include <lz4hc.h>
+#endif
+#ifdef ASTRAL_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace AstralEngine {
+
+	namespace {
+
+		struct ArchiveHeader {
+			uint32_t magic;
+			uint32_t version;
+			uint32_t entryCount;
+			uint32_t flags;
+			uint64_t entryTableOffset;
+			uint64_t pathTableOffset;
+			uint64_t pathTableSize;
+			uint64_t reserved[3];
+		};
+		static_assert(sizeof(ArchiveHeader) == 64);
+
+		// Packing is offline, so both codecs trade encode time for ratio
+		constexpr int LZ4_HC_LEVEL = 9;
+		constexpr int ZSTD_LEVEL = 15;
+
+		const char* GetCompressionName(ArchiveCompression compression) {
+			switch (compression) {
+			case ArchiveCompression::None: return "none";
+			case ArchiveCompression::LZ4: return "LZ4";
+			case ArchiveCompression::Zstd: return "Zstd";
+			}
+			return "unknown";
+		}
+
+		// Empty if the codec is unavailable or the data does not fit its limits
+		std::vector<uint8_t> Compress(ArchiveCompression compression, const uint8_t* data, size_t size) {
+			std::vector<uint8_t> out;
+			switch (compression) {
+#ifdef ASTRAL_HAS_LZ4
+			case ArchiveCompression::LZ4: {
+				if (size > LZ4_MAX_INPUT_SIZE) {
+					break;
+				}
+				out.resize(LZ4_compressBound(static_cast<int>(size)));
+				int written = LZ4_compress_HC(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out.data()),
+											  static_cast<int>(size), static_cast<int>(out.size()), LZ4_HC_LEVEL);
+				out.resize(written > 0 ? static_cast<size_t>(written) : 0);
+				break;
+			}
+#endif
+#ifdef ASTRAL_HAS_ZSTD
+			case ArchiveCompression::Zstd: {
+				out.resize(ZSTD_compressBound(size));
+				size_t written = ZSTD_compress(out.data(), out.size(), data, size, ZSTD_LEVEL);
+				out.resize(ZSTD_isError(written) ? 0 : written);
+				break;
+			}
+#endif
+			default:
+				break;
+			}
+			return out;
+		}
+
+		bool Decompress(ArchiveCompression compression, const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+			switch (compression) {
+#ifdef ASTRAL_HAS_LZ4
+			case ArchiveCompression::LZ4:
+				return srcSize <= LZ4_MAX_INPUT_SIZE && dstSize <= LZ4_MAX_INPUT_SIZE &&
+					   LZ4_decompress_safe(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dst),
+										   static_cast<int>(srcSize), static_cast<int>(dstSize)) == static_cast<int>(dstSize);
+#endif
+#ifdef ASTRAL_HAS_ZSTD
+			case ArchiveCompression::Zstd:
+				return ZSTD_decompress(dst, dstSize, src, srcSize) == dstSize;
+#endif
+			default:
+				return false;
+			}
+		}
+
+		// Rejects a decompressed size the stored bytes cannot produce. LZ4 expands
+		// at most 255:1; Zstd frames record their size, which Read checks instead.
+		bool IsPlausibleSize(ArchiveCompression compression, uint64_t storedSize, uint64_t size) {
+			switch (compression) {
+			case ArchiveCompression::None: return storedSize == size;
+			case ArchiveCompression::LZ4: return storedSize > 0 && size <= AssetArchive::MAX_DECOMPRESSED_SIZE && size / 255 <= storedSize;
+			case ArchiveCompression::Zstd: return storedSize > 0 && size <= AssetArchive::MAX_DECOMPRESSED_SIZE;
+			}
+			return false;
+		}
+
+		uint64_t AlignUp(uint64_t value) {
+			return (value + AssetArchive::ENTRY_ALIGNMENT - 1) & ~(AssetArchive::ENTRY_ALIGNMENT - 1);
+		}
+
+	} // namespace
+
+	std::shared_ptr<AssetArchive> AssetArchive::Open(const std::string& archivePath) {
+		// Only the header and index are touched up front; entries are paged in
+		// as importers read them
+		auto file = MappedFile::Open(archivePath, false);
+		if (!file) {
+			Logger::Error("AssetArchive", "Cannot open archive '{}'", archivePath);
+			return nullptr;
+		}
+
+		const uint8_t* base = file->GetData();
+		size_t size = file->GetSize();
+		if (size < sizeof(ArchiveHeader)) {
+			Logger::Error("AssetArchive", "Archive '{}' is truncated", archivePath);
+			return nullptr;
+		}
+
+		ArchiveHeader header;
+		std::memcpy(&header, base, sizeof(header));
+		if (header.magic != MAGIC || header.version != FORMAT_VERSION) {
+			Logger::Error("AssetArchive", "Archive '{}' has an incompatible format", archivePath);
+			return nullptr;
+		}
+		uint64_t entryBytes = static_cast<uint64_t>(header.entryCount) * sizeof(Entry);
+		if (header.entryTableOffset % alignof(Entry) != 0 ||
+			!MappedFile::RangeFits(header.entryTableOffset, header.entryCount, sizeof(Entry), size) ||
+			!MappedFile::RangeFits(header.pathTableOffset, header.pathTableSize, 1, size)) {
+			Logger::Error("AssetArchive", "Archive '{}' has a corrupt index", archivePath);
+			return nullptr;
+		}
+
+		std::shared_ptr<AssetArchive> archive(new AssetArchive());
+		archive->m_filePath = archivePath;
+		archive->m_entries = reinterpret_cast<const Entry*>(base + header.entryTableOffset);
+		archive->m_entryCount = header.entryCount;
+		archive->m_paths = reinterpret_cast<const char*>(base + header.pathTableOffset);
+		archive->m_pathsSize = header.pathTableSize;
+		file->Prefetch(header.entryTableOffset, entryBytes);
+		file->Prefetch(header.pathTableOffset, header.pathTableSize);
+
+		// Checked once here, so Find and Read can trust the table. Importers
+		// read uncompressed entries in place and rely on their alignment.
+		for (size_t i = 0; i < archive->m_entryCount; ++i) {
+			const Entry& entry = archive->m_entries[i];
+			if (entry.offset % ENTRY_ALIGNMENT != 0 ||
+				!MappedFile::RangeFits(entry.offset, entry.storedSize, 1, size) ||
+				!MappedFile::RangeFits(entry.pathOffset, entry.pathLength, 1, header.pathTableSize) ||
+				entry.compression > static_cast<uint32_t>(ArchiveCompression::Zstd) ||
+				!IsPlausibleSize(static_cast<ArchiveCompression>(entry.compression), entry.storedSize, entry.size) ||
+				(i > 0 && archive->m_entries[i - 1].pathHash > entry.pathHash)) {
+				Logger::Error("AssetArchive", "Archive '{}' has a corrupt entry table", archivePath);
+				return nullptr;
+			}
+			// Failing here beats failing on whichever asset is loaded first
+			auto compression = static_cast<ArchiveCompression>(entry.compression);
+			if (!IsCompressionSupported(compression)) {
+				Logger::Error("AssetArchive", "Archive '{}' uses {} compression, which this build cannot decode",
+							  archivePath, GetCompressionName(compression));
+				return nullptr;
+			}
+		}
+
+		archive->m_file = std::move(file);
+		Logger::Info("AssetArchive", "Opened archive '{}' ({} entries)", archivePath, archive->m_entryCount);
+		return archive;
+	}
+
+	std::string AssetArchive::NormalizePath(const std::string& relativePath) {
+		std::string path = std::filesystem::path(relativePath).lexically_normal().generic_string();
+		std::transform(path.begin(), path.end(), path.begin(),
+					   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return path;
+	}
+
+	bool AssetArchive::IsCompressionSupported(ArchiveCompression compression) {
+		switch (compression) {
+		case ArchiveCompression::None:
+			return true;
+		case ArchiveCompression::LZ4:
+#ifdef ASTRAL_HAS_LZ4
+			return true;
+#else
+			return false;
+#endif
+		case ArchiveCompression::Zstd:
+#ifdef ASTRAL_HAS_ZSTD
+			return true;
+#else
+			return false;
+#endif
+		}
+		return false;
+	}
+
+	const AssetArchive::Entry* AssetArchive::Find(std::string_view path) const {
+		uint64_t hash = Hash::XXH64(path);
+		const Entry* end = m_entries + m_entryCount;
+		const Entry* it = std::lower_bound(m_entries, end, hash,
+										   [](const Entry& entry, uint64_t value) { return entry.pathHash < value; });
+		for (; it != end && it->pathHash == hash; ++it) {
+			if (GetPath(*it) == path) {
+				return it;
+			}
+		}
+		return nullptr;
+	}
+
+	std::shared_ptr<MappedFile> AssetArchive::Read(const Entry& entry) const {
+		const uint8_t* stored = m_file->GetData() + entry.offset;
+		auto compression = static_cast<ArchiveCompression>(entry.compression);
+		if (compression == ArchiveCompression::None) {
+			m_file->Prefetch(entry.offset, entry.size);
+			return MappedFile::FromMemory(stored, entry.size, m_file);
+		}
+
+#ifdef ASTRAL_HAS_ZSTD
+		// Check the size the frame declares before allocating for it
+		if (compression == ArchiveCompression::Zstd && ZSTD_getFrameContentSize(stored, entry.storedSize) != entry.size) {
+			Logger::Error("AssetArchive", "Entry '{}' in '{}' does not match its Zstd frame", GetPath(entry), m_filePath);
+			return nullptr;
+		}
+#endif
+
+		// Aligned like a mapped entry, for importers that use the blob in place
+		std::shared_ptr<uint8_t> buffer(
+			static_cast<uint8_t*>(::operator new(entry.size, std::align_val_t(ENTRY_ALIGNMENT))),
+			[](uint8_t* p) { ::operator delete(p, std::align_val_t(ENTRY_ALIGNMENT)); });
+		if (!Decompress(compression, stored, entry.storedSize, buffer.get(), entry.size)) {
+			Logger::Error("AssetArchive", "Cannot decompress '{}' ({}) in '{}'", GetPath(entry),
+						  GetCompressionName(compression), m_filePath);
+			return nullptr;
+		}
+		return MappedFile::FromMemory(buffer.get(), entry.size, buffer);
+	}
+
+	std::string_view AssetArchive::GetPath(const Entry& entry) const {
+		return std::string_view(m_paths + entry.pathOffset, entry.pathLength);
+	}
+
+	AssetArchiveWriter::AssetArchiveWriter(const std::string& archivePath, ArchiveCompression compression)
+		: m_archivePath(archivePath), m_tempPath(archivePath + ".tmp"), m_compression(compression) {
+		if (!AssetArchive::IsCompressionSupported(compression)) {
+			Logger::Warning("AssetArchive", "{} compression is not available in this build; storing entries as is",
+							GetCompressionName(compression));
+			m_compression = ArchiveCompression::None;
+		}
+
+		std::error_code ec;
+		std::filesystem::path path(archivePath);
+		if (path.has_parent_path()) {
+			std::filesystem::create_directories(path.parent_path(), ec);
+		}
+
+		m_file.open(m_tempPath, std::ios::binary | std::ios::trunc);
+		if (!m_file) {
+			Logger::Error("AssetArchive", "Cannot create archive '{}'", m_tempPath);
+			return;
+		}
+		// Rewritten by Finish once the index is known
+		ArchiveHeader header{};
+		WriteAligned(&header, sizeof(header));
+	}
+
+	AssetArchiveWriter::~AssetArchiveWriter() {
+		if (m_file.is_open()) {
+			m_file.close();
+			std::error_code ec;
+			std::filesystem::remove(m_tempPath, ec);
+		}
+	}
+
+	bool AssetArchiveWriter::WriteAligned(const void* data, size_t size) {
+		static const char padding[AssetArchive::ENTRY_ALIGNMENT] = {};
+		uint64_t aligned = AlignUp(m_offset);
+		m_file.write(padding, static_cast<std::streamsize>(aligned - m_offset));
+		m_file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+		m_offset = aligned + size;
+		return m_file.good();
+	}
+
+	bool AssetArchiveWriter::Add(const std::string& relativePath, const uint8_t* data, size_t size, const EntryInfo& info) {
+		std::string path = AssetArchive::NormalizePath(relativePath);
+
+		AssetArchive::Entry entry{};
+		entry.pathHash = Hash::XXH64(path);
+		entry.size = size;
+		entry.settingsHash = info.settingsHash;
+		entry.assetType = info.assetType;
+		entry.importerVersion = info.importerVersion;
+
+		// Data that is already compressed (block-compressed textures) often
+		// does not shrink enough to pay for decoding it at load time
+		std::vector<uint8_t> compressed;
+		if (m_compression != ArchiveCompression::None && size <= AssetArchive::MAX_DECOMPRESSED_SIZE) {
+			compressed = Compress(m_compression, data, size);
+		}
+		if (!compressed.empty() && compressed.size() <= size * (1.0 - MIN_COMPRESSION_SAVING)) {
+			entry.compression = static_cast<uint32_t>(m_compression);
+			data = compressed.data();
+			entry.storedSize = compressed.size();
+		} else {
+			entry.compression = static_cast<uint32_t>(ArchiveCompression::None);
+			entry.storedSize = size;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (!m_file.is_open()) {
+			return false;
+		}
+		entry.offset = AlignUp(m_offset);
+		entry.pathOffset = static_cast<uint32_t>(m_paths.size());
+		entry.pathLength = static_cast<uint32_t>(path.size());
+		if (!WriteAligned(data, entry.storedSize)) {
+			Logger::Error("AssetArchive", "Failed to write '{}' to '{}'", path, m_tempPath);
+			return false;
+		}
+		m_paths += path;
+		m_entries.push_back(entry);
+		m_storedBytes += entry.storedSize;
+		m_rawBytes += size;
+		return true;
+	}
+
+	bool AssetArchiveWriter::Finish() {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (!m_file.is_open()) {
+			return false;
+		}
+
+		std::sort(m_entries.begin(), m_entries.end(),
+				  [](const auto& a, const auto& b) { return a.pathHash < b.pathHash; });
+		for (size_t i = 1; i < m_entries.size(); ++i) {
+			if (m_entries[i - 1].pathHash == m_entries[i].pathHash) {
+				// Same path twice, or two paths that collide; either way Find
+				// could not tell them apart reliably
+				Logger::Error("AssetArchive", "'{}' and '{}' map to the same archive path hash",
+							  m_paths.substr(m_entries[i - 1].pathOffset, m_entries[i - 1].pathLength),
+							  m_paths.substr(m_entries[i].pathOffset, m_entries[i].pathLength));
+				return false;
+			}
+		}
+
+		ArchiveHeader header{};
+		header.magic = AssetArchive::MAGIC;
+		header.version = AssetArchive::FORMAT_VERSION;
+		header.entryCount = static_cast<uint32_t>(m_entries.size());
+		header.entryTableOffset = AlignUp(m_offset);
+		WriteAligned(m_entries.data(), m_entries.size() * sizeof(AssetArchive::Entry));
+		header.pathTableOffset = m_offset;
+		header.pathTableSize = m_paths.size();
+		m_file.write(m_paths.data(), static_cast<std::streamsize>(m_paths.size()));
+		m_file.seekp(0);
+		m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		m_file.close();
+		if (!m_file) {
+			Logger::Error("AssetArchive", "Failed to write archive '{}'", m_tempPath);
+			std::error_code ec;
+			std::filesystem::remove(m_tempPath, ec);
+			return false;
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(m_tempPath, m_archivePath, ec);
+		if (ec) {
+			Logger::Error("AssetArchive", "Failed to move archive into place '{}': {}", m_archivePath, ec.message());
+			std::filesystem::remove(m_tempPath, ec);
+			return false;
+		}
+		return true;
+	}
+
+} // namespace AstralEngine
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AstralEngine {
+
+	class MappedFile;
+
+	enum class ArchiveCompression : uint32_t {
+		None = 0,
+		LZ4 = 1,  // Fast to decode; for data read at load time
+		Zstd = 2, // Smaller; for data that is read rarely or over slow storage
+	};
+
+	/**
+	 * @class AssetArchive
+	 * @brief Varlıkların importer çıktılarını tek dosyada tutan paket (.apak).
+	 *
+	 * Arşiv açılışta bir kez map edilir. Dizin, normalize edilmiş göreli
+	 * yolların hash'ine göre sıralıdır; arama ikili aramadır ve dosya
+	 * sistemine dokunmaz. Sıkıştırılmamış girdiler hizalıdır, importer'lar
+	 * arşiv belleğini kopyalamadan kullanır.
+	 *
+	 * Dosya düzeni: ArchiveHeader | girdi verileri | Entry tablosu | yol tablosu
+	 */
+	class AssetArchive {
+	public:
+		static constexpr uint32_t MAGIC = 0x4B415041; // "APAK"
+		static constexpr uint32_t FORMAT_VERSION = 1;
+		// Same as the cooked formats' blob alignment, so mapped entries keep it
+		static constexpr uint64_t ENTRY_ALIGNMENT = 64;
+		// Largest compressed entry; Read allocates the decompressed size, so a
+		// corrupt index must not be able to ask for more. Bigger entries are stored as is.
+		static constexpr uint64_t MAX_DECOMPRESSED_SIZE = uint64_t(1) << 31;
+		static constexpr const char* EXTENSION = ".apak";
+
+		struct Entry {
+			uint64_t pathHash;      // XXH64 of the normalized path; the table is sorted by it
+			uint64_t offset;        // From the start of the archive
+			uint64_t storedSize;    // Bytes in the archive
+			uint64_t size;          // Bytes once decompressed
+			uint64_t settingsHash;  // XXH64 of the importer's settings key
+			uint32_t pathOffset;    // Into the path table; rules out hash collisions
+			uint32_t pathLength;
+			uint32_t compression;   // ArchiveCompression
+			uint32_t assetType;     // AssetHandle::Type
+			uint32_t importerVersion;
+			uint32_t reserved;
+		};
+		static_assert(sizeof(Entry) == 64);
+
+		// Maps the archive and checks its index; nullptr if it is missing or corrupt
+		static std::shared_ptr<AssetArchive> Open(const std::string& archivePath);
+
+		// Lowercase, '/'-separated and lexically normal, relative to the asset directory.
+		// Asset paths are case-insensitive on every platform, so IDs and archive
+		// lookups match what Windows sees: Foo.png and foo.png are one asset,
+		// and two files that differ only in case are not supported.
+		static std::string NormalizePath(const std::string& relativePath);
+		static bool IsCompressionSupported(ArchiveCompression compression);
+
+		// path must be normalized; nullptr if the archive does not have it
+		const Entry* Find(std::string_view path) const;
+
+		// A view into the mapping for entries stored as is, a decompressed copy
+		// otherwise; nullptr if the entry cannot be decompressed
+		std::shared_ptr<MappedFile> Read(const Entry& entry) const;
+
+		std::string_view GetPath(const Entry& entry) const;
+		size_t GetEntryCount() const { return m_entryCount; }
+		const std::string& GetFilePath() const { return m_filePath; }
+
+	private:
+		AssetArchive() = default;
+
+		std::string m_filePath;
+		std::shared_ptr<MappedFile> m_file;
+		const Entry* m_entries = nullptr;
+		size_t m_entryCount = 0;
+		const char* m_paths = nullptr;
+		size_t m_pathsSize = 0;
+	};
+
+	/**
+	 * @class AssetArchiveWriter
+	 * @brief AssetArchive dosyası oluşturur; girdiler eklendikçe diske yazılır.
+	 *
+	 * Add birden fazla thread'den çağrılabilir, sıkıştırma kilit dışında
+	 * yapılır. Dizin Finish'te yazılır; arşiv geçici dosyadan yeniden
+	 * adlandırılır, okuyucular asla yarım dosya görmez.
+	 */
+	class AssetArchiveWriter {
+	public:
+		// Entries are stored as is unless compressing saves at least this much
+		static constexpr double MIN_COMPRESSION_SAVING = 0.125;
+
+		struct EntryInfo {
+			uint32_t assetType = 0;
+			uint32_t importerVersion = 0;
+			uint64_t settingsHash = 0;
+		};
+
+		AssetArchiveWriter(const std::string& archivePath, ArchiveCompression compression);
+		~AssetArchiveWriter(); // Removes the temp file if Finish was not reached
+
+		// Non-copyable
+		AssetArchiveWriter(const AssetArchiveWriter&) = delete;
+		AssetArchiveWriter& operator=(const AssetArchiveWriter&) = delete;
+
+		bool IsOpen() const { return m_file.is_open(); }
+
+		// relativePath is normalized here; false on a write error. A path added
+		// twice makes Finish fail.
+		bool Add(const std::string& relativePath, const uint8_t* data, size_t size, const EntryInfo& info);
+
+		// Writes the index and moves the archive into place
+		bool Finish();
+
+		size_t GetEntryCount() const { return m_entries.size(); }
+		uint64_t GetStoredBytes() const { return m_storedBytes; }
+		uint64_t GetRawBytes() const { return m_rawBytes; }
+
+	private:
+		bool WriteAligned(const void* data, size_t size);
+
+		std::string m_archivePath;
+		std::string m_tempPath;
+		ArchiveCompression m_compression;
+
+		std::mutex m_mutex;
+		std::ofstream m_file;
+		uint64_t m_offset = 0;
+		std::vector<AssetArchive::Entry> m_entries;
+		std::string m_paths;
+		uint64_t m_storedBytes = 0;
+		uint64_t m_rawBytes = 0;
+	};
+
+} // namespace AstralEngine
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "../../Core/Math/Bounds.h"
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <glm/glm.hpp>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -40,6 +44,85 @@ struct Vertex {
   }
 };
 
+/**
+ * @brief GPU vertex düzeni; model başına import sırasında seçilir
+ */
+enum class VertexFormat : uint32_t {
+  Standard = 0, ///< Vertex: tam float (56 byte)
+  Packed = 1,   ///< PackedVertex: quantize edilmiş (20 byte)
+};
+
+constexpr uint32_t VERTEX_FORMAT_COUNT = 2;
+
+/**
+ * @struct PackedVertex
+ * @brief Quantize edilmiş vertex; shader'da açılır (bkz. VertexQuantizer)
+ *
+ * Pozisyon modelin sınırlayıcı kutusuna göre unorm16, normal ve tangent
+ * octahedral snorm16, UV half float. Bitangent normal x tangent ile
+ * yeniden kurulur; işareti position[3] içindedir.
+ */
+struct PackedVertex {
+  uint16_t position[4]; ///< xyz: unorm16 (bounds'a göre), w: bitangent işareti (0 / 65535)
+  int16_t normal[2];    ///< Octahedral snorm16
+  int16_t tangent[2];   ///< Octahedral snorm16
+  uint16_t texCoord[2]; ///< Half float
+};
+
+static_assert(sizeof(PackedVertex) == 20, "PackedVertex layout is shared with shaders");
+
+/**
+ * @struct Meshlet
+ * @brief Küme (cluster) bazında culling için üçgen grubu
+ *
+ * Üçgenleri index buffer'da ardışıktır: [indexOffset, indexOffset +
+ * triangleCount * 3). Sınırlar model uzayındadır.
+ */
+struct Meshlet {
+  uint32_t indexOffset = 0;   ///< İlk index (index buffer içinde)
+  uint32_t triangleCount = 0; ///< Üçgen sayısı
+  uint32_t vertexCount = 0;   ///< Benzersiz vertex sayısı
+  uint32_t padding = 0;
+  glm::vec3 center = glm::vec3(0.0f); ///< Sınırlayıcı küre merkezi
+  float radius = 0.0f;                ///< Sınırlayıcı küre yarıçapı
+  glm::vec3 coneAxis = glm::vec3(0.0f, 0.0f, 1.0f); ///< Normal konisi ekseni
+  float coneCutoff = 1.0f; ///< sin(koni yarı açısı); 1 ise koni culling yapılmaz
+};
+
+/**
+ * @struct MeshLod
+ * @brief Bir detay seviyesinin (LOD) index ve meshlet aralığı
+ *
+ * Tüm LOD'lar aynı vertex buffer'ı paylaşır; index buffer'da LOD0'dan
+ * başlayarak art arda dururlar.
+ */
+struct MeshLod {
+  uint32_t indexOffset = 0;   ///< İlk index
+  uint32_t indexCount = 0;    ///< Index sayısı
+  uint32_t meshletOffset = 0; ///< İlk meshlet
+  uint32_t meshletCount = 0;  ///< Meshlet sayısı
+  float error = 0.0f; ///< Sadeleştirme hatası (model boyutuna oranla, LOD0 için 0)
+};
+
+constexpr uint32_t MAX_MESH_LODS = 8;
+
+/**
+ * @struct Submesh
+ * @brief Tek materyal slotu kullanan geometri parçası (import edilen her aiMesh)
+ *
+ * Vertex'leri [vertexOffset, vertexOffset + vertexCount) aralığındadır. Her
+ * LOD için index/meshlet aralığı lods[] içindedir; ilk GetLodCount() kadarı
+ * geçerlidir. Index buffer önce LOD'a, sonra submesh'e göre sıralıdır.
+ */
+struct Submesh {
+  uint32_t materialIndex = 0; ///< Materyal slotu (kaynak dosyadaki materyal sırası)
+  uint32_t vertexOffset = 0;  ///< İlk vertex
+  uint32_t vertexCount = 0;   ///< Vertex sayısı
+  uint32_t padding = 0;
+  AABB bounds;                ///< Model uzayında sınırlayıcı kutu
+  MeshLod lods[MAX_MESH_LODS] = {}; ///< LOD başına index/meshlet aralığı
+};
+
 /**
  * @struct ModelData
  * @brief CPU-side model verisi
@@ -50,11 +133,25 @@ struct Vertex {
 struct ModelData {
   std::vector<Vertex> vertices;  ///< Vertex verileri
   std::vector<uint32_t> indices; ///< Index verileri
+  std::vector<Meshlet> meshlets; ///< Index verilerini bölen kümeler
+  std::vector<MeshLod> lods;     ///< LOD zinciri; boşsa tek LOD (tüm index'ler)
+  std::vector<Submesh> submeshes; ///< Submesh tablosu; boş olabilir (tek parça)
+  std::vector<PackedVertex> packedVertices; ///< Packed formatta vertex verileri
+  VertexFormat vertexFormat = VertexFormat::Standard; ///< Hangi vertex dizisi kullanılıyor
   AABB boundingBox;              ///< Modelin sınırlayıcı kutusu
   std::string filePath;          ///< Model dosyasının yolu
   std::string name;              ///< Model adı
   bool isValid = false;          ///< Veri geçerli mi?
 
+  /// Cooked modeller vektör yerine map edilmiş dosyayı gösterir (zero-copy)
+  std::shared_ptr<const void> mappedStorage; ///< Mapping'i canlı tutar
+  std::span<const Vertex> mappedVertices;    ///< Dosya içindeki vertex blob'u
+  std::span<const uint32_t> mappedIndices;   ///< Dosya içindeki index blob'u
+  std::span<const Meshlet> mappedMeshlets;   ///< Dosya içindeki meshlet tablosu
+  std::span<const MeshLod> mappedLods;       ///< Dosya içindeki LOD tablosu
+  std::span<const Submesh> mappedSubmeshes;  ///< Dosya içindeki submesh tablosu
+  std::span<const PackedVertex> mappedPackedVertices; ///< Dosya içindeki packed vertex blob'u
+
   ModelData() = default;
 
   /**
@@ -63,12 +160,89 @@ struct ModelData {
    */
   explicit ModelData(const std::string &path) : filePath(path) {}
 
+  /**
+   * @brief Vertex verisine salt okunur erişim (sahip olunan veya map edilmiş)
+   * @return Vertex dizisi
+   */
+  std::span<const Vertex> GetVertices() const {
+    return mappedStorage ? mappedVertices : std::span<const Vertex>(vertices);
+  }
+
+  /**
+   * @brief Index verisine salt okunur erişim (sahip olunan veya map edilmiş)
+   * @return Index dizisi
+   */
+  std::span<const uint32_t> GetIndices() const {
+    return mappedStorage ? mappedIndices : std::span<const uint32_t>(indices);
+  }
+
+  /**
+   * @brief Packed vertex verisine salt okunur erişim (Packed formatta)
+   * @return PackedVertex dizisi
+   */
+  std::span<const PackedVertex> GetPackedVertices() const {
+    return mappedStorage ? mappedPackedVertices
+                         : std::span<const PackedVertex>(packedVertices);
+  }
+
+  /**
+   * @brief Aktif formattaki vertex verisinin baytları (GPU upload için)
+   * @return Ham vertex baytları
+   */
+  std::span<const std::byte> GetVertexData() const {
+    return vertexFormat == VertexFormat::Packed
+               ? std::as_bytes(GetPackedVertices())
+               : std::as_bytes(GetVertices());
+  }
+
+  /**
+   * @brief Aktif formatın vertex boyutu (byte)
+   * @return Vertex stride
+   */
+  uint32_t GetVertexStride() const {
+    return vertexFormat == VertexFormat::Packed ? sizeof(PackedVertex)
+                                                : sizeof(Vertex);
+  }
+
+  /**
+   * @brief Meshlet tablosuna salt okunur erişim (boş olabilir)
+   * @return Meshlet dizisi
+   */
+  std::span<const Meshlet> GetMeshlets() const {
+    return mappedStorage ? mappedMeshlets : std::span<const Meshlet>(meshlets);
+  }
+
+  /**
+   * @brief LOD tablosuna salt okunur erişim (boşsa tek LOD)
+   * @return LOD dizisi
+   */
+  std::span<const MeshLod> GetLods() const {
+    return mappedStorage ? mappedLods : std::span<const MeshLod>(lods);
+  }
+
+  /**
+   * @brief LOD sayısı (LOD zinciri yoksa 1)
+   * @return LOD sayısı
+   */
+  uint32_t GetLodCount() const {
+    return std::max<uint32_t>(static_cast<uint32_t>(GetLods().size()), 1);
+  }
+
+  /**
+   * @brief Submesh tablosuna salt okunur erişim (boş olabilir)
+   * @return Submesh dizisi
+   */
+  std::span<const Submesh> GetSubmeshes() const {
+    return mappedStorage ? mappedSubmeshes
+                         : std::span<const Submesh>(submeshes);
+  }
+
   /**
    * @brief Model verisinin geçerli olup olmadığını kontrol et
    * @return Geçerli ise true
    */
   bool IsValid() const {
-    return isValid && !vertices.empty() && !indices.empty();
+    return isValid && GetVertexCount() > 0 && !GetIndices().empty();
   }
 
   /**
@@ -78,39 +252,85 @@ struct ModelData {
     isValid = false;
     vertices.clear();
     indices.clear();
+    meshlets.clear();
+    lods.clear();
+    submeshes.clear();
+    packedVertices.clear();
+    vertexFormat = VertexFormat::Standard;
+    mappedVertices = {};
+    mappedPackedVertices = {};
+    mappedIndices = {};
+    mappedMeshlets = {};
+    mappedLods = {};
+    mappedSubmeshes = {};
+    mappedStorage.reset();
   }
 
   /**
    * @brief Vertex sayısını döndür
    * @return Vertex sayısı
    */
-  size_t GetVertexCount() const { return vertices.size(); }
+  size_t GetVertexCount() const {
+    return vertexFormat == VertexFormat::Packed ? GetPackedVertices().size()
+                                                : GetVertices().size();
+  }
 
   /**
    * @brief Index sayısını döndür
    * @return Index sayısı
    */
-  size_t GetIndexCount() const { return indices.size(); }
+  size_t GetIndexCount() const { return GetIndices().size(); }
 
   /**
    * @brief Modelin bellek kullanımını hesapla (bytes)
    * @return Bellek kullanımı
    */
   size_t GetMemoryUsage() const {
-    return (vertices.size() * sizeof(Vertex)) +
-           (indices.size() * sizeof(uint32_t));
+    return GetVertexData().size() +
+           (GetIndexCount() * sizeof(uint32_t)) +
+           (GetMeshlets().size() * sizeof(Meshlet)) +
+           (GetLods().size() * sizeof(MeshLod)) +
+           (GetSubmeshes().size() * sizeof(Submesh));
   }
 };
 
+/// Block compression of a texture's pixel data (4x4 blocks)
+enum class TextureCompression : uint32_t {
+  None, ///< RGBA8 or RGBA32F (isHDR)
+  BC1,  ///< RGB, 8 bytes/block
+  BC3,  ///< RGBA (BC1 color + BC4 alpha), 16 bytes/block
+  BC5,  ///< Two channels (normal map XY), 16 bytes/block
+  BC6H, ///< HDR RGB (unsigned half), 16 bytes/block
+  BC7   ///< RGBA, 16 bytes/block
+};
+
+/// One mip level inside TextureData::data
+struct TextureMip {
+  uint64_t offset;
+  uint64_t size;
+  uint32_t width;
+  uint32_t height;
+};
+
+/// Largest texture a loaded file may describe (maxImageDimension2D on desktop
+/// GPUs); files are checked against it before any level size is computed
+constexpr uint32_t MAX_TEXTURE_DIMENSION = 16384;
+constexpr uint32_t MAX_TEXTURE_MIPS = 15; ///< Full mip chain of MAX_TEXTURE_DIMENSION
+
 /**
  * @struct TextureData
  * @brief CPU-side texture verisi
  *
  * Texture'ların ham pixel verilerini içerir.
- * GPU'ya göndermeden önceki ara formattır.
+ * GPU'ya göndermeden önceki ara formattır. Pişirilmiş (cooked) texture'larda
+ * data tüm mip zincirini tutar; seviyeler mips'te tanımlıdır (mips[0] en
+ * büyük seviye, dosyadaki sıra farklı olabilir). Cooked/KTX2/DDS dosyalarında
+ * data map edilmiş dosyayı gösterir ve salt okunurdur. Decode edilen
+ * görüntüler decoder'ın tamponunu kopyalamadan sahiplenir (Adopt).
  */
 struct TextureData {
   void *data = nullptr;  ///< Pixel verisi (stbi_uc* veya benzeri)
+  size_t dataSize = 0;   ///< data'nın bayt boyutu
   uint32_t width = 0;    ///< Genişlik
   uint32_t height = 0;   ///< Yükseklik
   uint32_t channels = 0; ///< Kanal sayısı (1-4)
@@ -119,6 +339,10 @@ struct TextureData {
   std::string name;      ///< Texture adı
   bool isValid = false;  ///< Veri geçerli mi?
   bool isHDR = false;    ///< HDR (float) verisi mi?
+  bool isSRGB = true;    ///< Renk verisi mi (sRGB örneklenir)? Normal/ORM haritalarında false
+  TextureCompression compression = TextureCompression::None;
+  std::vector<TextureMip> mips; ///< Boşsa data tek seviyedir (width x height)
+  std::shared_ptr<const void> storage; ///< Set ise data'nın sahibidir (map edilmiş dosya, decoder tamponu)
 
   TextureData() = default;
 
@@ -145,6 +369,7 @@ struct TextureData {
       Free();
 
       data = other.data;
+      dataSize = other.dataSize;
       width = other.width;
       height = other.height;
       channels = other.channels;
@@ -153,8 +378,13 @@ struct TextureData {
       name = std::move(other.name);
       isValid = other.isValid;
       isHDR = other.isHDR;
+      isSRGB = other.isSRGB;
+      compression = other.compression;
+      mips = std::move(other.mips);
+      storage = std::move(other.storage);
 
       other.data = nullptr;
+      other.dataSize = 0;
       other.width = 0;
       other.height = 0;
       other.channels = 0;
@@ -181,10 +411,11 @@ struct TextureData {
     channels = c;
     bytesPerChannel = bpc;
 
-    size_t dataSize = (size_t)width * height * channels * bytesPerChannel;
+    dataSize = (size_t)width * height * channels * bytesPerChannel;
     data = malloc(dataSize);
 
     if (!data) {
+      dataSize = 0;
       isValid = false;
       return false;
     }
@@ -193,14 +424,65 @@ struct TextureData {
     return true;
   }
 
+  /**
+   * @brief Sıkıştırılmış/mip'li veri için ham bellek tahsis et
+   * @param w Genişlik (mip 0)
+   * @param h Yükseklik (mip 0)
+   * @param c Kanal sayısı
+   * @param size Tüm seviyelerin toplam bayt boyutu
+   * @return Başarılı ise true
+   */
+  bool AllocateBytes(uint32_t w, uint32_t h, uint32_t c, size_t size) {
+    Free();
+
+    width = w;
+    height = h;
+    channels = c;
+    data = malloc(size);
+    if (!data) {
+      isValid = false;
+      return false;
+    }
+    dataSize = size;
+    isValid = true;
+    return true;
+  }
+
+  /**
+   * @brief Başka bir tamponu kopyalamadan sahiplen
+   * @param pixels Piksel verisi (owner'ın içinde)
+   * @param size Bayt boyutu
+   * @param w Genişlik
+   * @param h Yükseklik
+   * @param c Kanal sayısı
+   * @param bpc Kanal başına bayt sayısı
+   * @param owner Tamponu serbest bırakan sahip (ör. stbi_image_free deleter'lı)
+   */
+  void Adopt(void *pixels, size_t size, uint32_t w, uint32_t h, uint32_t c,
+             uint32_t bpc, std::shared_ptr<const void> owner) {
+    Free();
+
+    data = pixels;
+    dataSize = size;
+    width = w;
+    height = h;
+    channels = c;
+    bytesPerChannel = bpc;
+    storage = std::move(owner);
+    isValid = data != nullptr;
+  }
+
   /**
    * @brief Belleği serbest bırak
    */
   void Free() {
-    if (data) {
+    if (data && !storage) {
       free(data);
-      data = nullptr;
     }
+    data = nullptr;
+    storage.reset();
+    dataSize = 0;
+    mips.clear();
     width = 0;
     height = 0;
     channels = 0;
@@ -225,7 +507,9 @@ struct TextureData {
    * @brief Texture'in bellek kullanımını hesapla (bytes)
    * @return Bellek kullanımı
    */
-  size_t GetMemoryUsage() const { return width * height * channels; }
+  size_t GetMemoryUsage() const { return dataSize; }
+
+  uint32_t GetMipCount() const { return mips.empty() ? 1u : static_cast<uint32_t>(mips.size()); }
 };
 
 /**
@@ -1,20 +1,28 @@
 #pragma once
 
 #include <cstdint>
-#include <string>
+#include <cstddef>
 #include <functional>
+#include <string_view>
+#include <type_traits>
 
 namespace AstralEngine {
 
 /**
  * @brief Asset'leri benzersiz şekilde tanımlamak için kullanılan handle
- * 
+ *
  * String path yerine daha verimli ve type-safe bir asset referans sistemi sağlar.
+ * Handle tek bir 64-bit değerdir: üst 8 bit asset tipi, kalanı normalize
+ * edilmiş yolun XXH64 hash'i. ID platformlar ve çalıştırmalar arasında
+ * aynıdır, sahne dosyalarına yazılabilir. Kopyalamak ve hash'lemek bedavadır;
+ * yol gerekiyorsa AssetManager::GetAssetPath ile registry'den alınır.
+ * Normalizasyon küçük harfe çevirir (AssetArchive::NormalizePath): Foo.png ve
+ * foo.png Linux'ta da aynı ID'yi alır.
  */
 class AssetHandle {
 public:
     // Asset tipleri
-    enum class Type {
+    enum class Type : uint8_t {
         Model,
         Texture,
         Shader,
@@ -23,36 +31,38 @@ public:
         Unknown
     };
 
-    AssetHandle();
-    explicit AssetHandle(uint64_t id, Type type = Type::Unknown);
-    explicit AssetHandle(const std::string& path, Type type = Type::Unknown);
-    
-    // Comparison operators
-    bool operator==(const AssetHandle& other) const;
-    bool operator!=(const AssetHandle& other) const;
-    bool operator<(const AssetHandle& other) const;
-    
+    constexpr AssetHandle() = default;
+    // id as returned by GetID(); it carries the type
+    constexpr explicit AssetHandle(uint64_t id) : m_id(id) {}
+    // path is hashed as given; AssetManager::RegisterAsset passes it normalized
+    // and relative to the asset directory, so every spelling gets the same ID
+    AssetHandle(std::string_view path, Type type);
+
+    // Comparison operators; ordered by type, then hash
+    bool operator==(const AssetHandle& other) const { return m_id == other.m_id; }
+    bool operator!=(const AssetHandle& other) const { return m_id != other.m_id; }
+    bool operator<(const AssetHandle& other) const { return m_id < other.m_id; }
+
     // Utility functions
-    bool IsValid() const;
-    uint64_t GetID() const;
-    Type GetType() const;
-    const std::string& GetPath() const;
-    
-    // Hash function support
-    size_t GetHash() const;
+    bool IsValid() const { return (m_id & HASH_MASK) != 0; }
+    uint64_t GetID() const { return m_id; }
+    Type GetType() const { return static_cast<Type>(m_id >> TYPE_SHIFT); }
+
+    // Hash function support; the ID is already a well-mixed hash
+    size_t GetHash() const { return static_cast<size_t>(m_id); }
 
 private:
-    uint64_t m_id;
-    Type m_type;
-    std::string m_path;
-    
-    // Path'ten ID üretmek için
-    static uint64_t GenerateID(const std::string& path);
+    static constexpr uint32_t TYPE_SHIFT = 56;
+    static constexpr uint64_t HASH_MASK = (uint64_t(1) << TYPE_SHIFT) - 1;
+
+    uint64_t m_id = 0;
 };
 
+static_assert(sizeof(AssetHandle) == 8 && std::is_trivially_copyable_v<AssetHandle>);
+
 // Hash function for std::unordered_map
 struct AssetHandleHash {
-    size_t operator()(const AssetHandle& handle) const;
+    size_t operator()(const AssetHandle& handle) const { return handle.GetHash(); }
 };
 
 } // namespace AstralEngine
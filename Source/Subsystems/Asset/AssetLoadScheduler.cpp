@@ -0,0 +1,246 @@
+#include "AssetLoadScheduler.h"
+#include "../../Core/Logger.h"
+#include "../../Core/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace AstralEngine {
+
+	void LoadHistogram::Record(double value) {
+		size_t bucket = 0;
+		if (value >= 1.0) {
+			bucket = std::min(BUCKET_COUNT - 1, static_cast<size_t>(std::log2(value)) + 1);
+		}
+		++counts[bucket];
+		++total;
+	}
+
+	double LoadHistogram::Percentile(double fraction) const {
+		if (total == 0) {
+			return 0.0;
+		}
+		const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * total)));
+		uint64_t seen = 0;
+		for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+			seen += counts[i];
+			if (seen >= target) {
+				// The open-ended last bucket reports its lower bound
+				return std::ldexp(1.0, static_cast<int>(std::min(i, BUCKET_COUNT - 2)));
+			}
+		}
+		return std::ldexp(1.0, static_cast<int>(BUCKET_COUNT - 2));
+	}
+
+	AssetLoadScheduler::AssetLoadScheduler(ThreadPool* threadPool) : m_threadPool(threadPool) {
+		// Reads mostly wait on the disk, so a few are enough; decoding gets the rest of the pool
+		const uint32_t threads = threadPool ? static_cast<uint32_t>(threadPool->GetThreadCount()) : 1;
+		const uint32_t ioLimit = std::max(1u, threads / 4);
+		SetConcurrency(ioLimit, std::max(1u, threads - ioLimit));
+	}
+
+	AssetLoadScheduler::~AssetLoadScheduler() {
+		Shutdown();
+	}
+
+	void AssetLoadScheduler::SetConcurrency(uint32_t ioLimit, uint32_t cpuLimit) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_limits[static_cast<size_t>(AssetLoadKind::IO)] = std::max(1u, ioLimit);
+		m_limits[static_cast<size_t>(AssetLoadKind::CPU)] = std::max(1u, cpuLimit);
+		Dispatch();
+	}
+
+	bool AssetLoadScheduler::Enqueue(const AssetHandle& handle, AssetLoadPriority priority, AssetLoadKind kind,
+									 std::function<void()> run, std::function<void()> onCancel) {
+		return EnqueueAsync(
+			handle, priority, kind,
+			[run = std::move(run)](std::function<void()> finish) {
+				run();
+				finish();
+			},
+			std::move(onCancel));
+	}
+
+	bool AssetLoadScheduler::EnqueueAsync(const AssetHandle& handle, AssetLoadPriority priority, AssetLoadKind kind,
+										  AsyncRun run, std::function<void()> onCancel) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (!m_stopped && m_requests.find(handle) == m_requests.end()) {
+				Request& request = m_requests[handle];
+				request.priority = priority;
+				request.kind = kind;
+				request.sequence = m_nextSequence++;
+				request.enqueueTime = Clock::now();
+				request.run = std::move(run);
+				request.onCancel = std::move(onCancel);
+				m_queues[static_cast<size_t>(kind)].emplace(QueueKey(priority, request.sequence), handle);
+
+				size_t depth = 0;
+				for (const auto& queue : m_queues) {
+					depth += queue.size();
+				}
+				m_stats.queueDepth.Record(static_cast<double>(depth));
+
+				Dispatch();
+				return true;
+			}
+		}
+
+		Raise(handle, priority);
+		return false;
+	}
+
+	bool AssetLoadScheduler::SetPriority(const AssetHandle& handle, AssetLoadPriority priority) {
+		return Reprioritize(handle, priority, false);
+	}
+
+	bool AssetLoadScheduler::Raise(const AssetHandle& handle, AssetLoadPriority priority) {
+		return Reprioritize(handle, priority, true);
+	}
+
+	bool AssetLoadScheduler::Reprioritize(const AssetHandle& handle, AssetLoadPriority priority, bool raiseOnly) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_requests.find(handle);
+		if (it == m_requests.end() || it->second.running) {
+			return false;
+		}
+
+		Request& request = it->second;
+		if (request.priority == priority || (raiseOnly && request.priority < priority)) {
+			return true;
+		}
+
+		// The sequence is kept, so it stays ahead of later requests at its new priority
+		auto& queue = m_queues[static_cast<size_t>(request.kind)];
+		queue.erase(QueueKey(request.priority, request.sequence));
+		request.priority = priority;
+		queue.emplace(QueueKey(priority, request.sequence), handle);
+		return true;
+	}
+
+	bool AssetLoadScheduler::Cancel(const AssetHandle& handle) {
+		std::function<void()> onCancel;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto it = m_requests.find(handle);
+			if (it == m_requests.end() || it->second.running) {
+				return false;
+			}
+			m_queues[static_cast<size_t>(it->second.kind)].erase(QueueKey(it->second.priority, it->second.sequence));
+			onCancel = std::move(it->second.onCancel);
+			m_requests.erase(it);
+			++m_stats.cancelled;
+		}
+
+		// Outside the lock; the callback may call back into the scheduler
+		if (onCancel) {
+			onCancel();
+		}
+		return true;
+	}
+
+	bool AssetLoadScheduler::IsPending(const AssetHandle& handle) const {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_requests.find(handle) != m_requests.end();
+	}
+
+	void AssetLoadScheduler::Shutdown() {
+		std::vector<std::function<void()>> cancelled;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stopped = true;
+			for (auto& queue : m_queues) {
+				for (const auto& [key, handle] : queue) {
+					auto it = m_requests.find(handle);
+					cancelled.push_back(std::move(it->second.onCancel));
+					m_requests.erase(it);
+				}
+				queue.clear();
+			}
+			m_stats.cancelled += cancelled.size();
+		}
+
+		for (auto& onCancel : cancelled) {
+			if (onCancel) {
+				onCancel();
+			}
+		}
+	}
+
+	void AssetLoadScheduler::WaitForIdle() {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_idleCondition.wait(lock, [this]() {
+			for (uint32_t running : m_stats.running) {
+				if (running > 0) {
+					return false;
+				}
+			}
+			return true;
+		});
+	}
+
+	AssetLoadScheduler::Stats AssetLoadScheduler::GetStats() const {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		Stats stats = m_stats;
+		for (const auto& queue : m_queues) {
+			for (const auto& [key, handle] : queue) {
+				++stats.queued[static_cast<size_t>(std::get<0>(key))];
+			}
+		}
+		return stats;
+	}
+
+	void AssetLoadScheduler::Dispatch() {
+		if (m_stopped || !m_threadPool) {
+			return;
+		}
+
+		for (size_t kind = 0; kind < m_queues.size(); ++kind) {
+			auto& queue = m_queues[kind];
+			while (!queue.empty() && m_stats.running[kind] < m_limits[kind]) {
+				AssetHandle handle = queue.begin()->second;
+				queue.erase(queue.begin());
+
+				Request& request = m_requests[handle];
+				request.running = true;
+				++m_stats.running[kind];
+
+				const Clock::time_point startTime = Clock::now();
+				m_stats.queueWaitMs.Record(std::chrono::duration<double, std::milli>(startTime - request.enqueueTime).count());
+
+				m_threadPool->Submit([this, handle, run = std::move(request.run)]() {
+					const Clock::time_point start = Clock::now();
+					// A load that throws may already have handed finish on; it still counts once
+					auto finished = std::make_shared<std::atomic<bool>>(false);
+					auto finish = [this, handle, start, finished]() {
+						if (!finished->exchange(true)) {
+							Finish(handle, start);
+						}
+					};
+					try {
+						run(finish);
+					} catch (const std::exception& e) {
+						Logger::Error("AssetLoadScheduler", "Load of asset {} threw: {}", handle.GetID(), e.what());
+						finish();
+					}
+				});
+			}
+		}
+	}
+
+	void AssetLoadScheduler::Finish(const AssetHandle& handle, Clock::time_point startTime) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_requests.find(handle);
+		if (it != m_requests.end()) {
+			--m_stats.running[static_cast<size_t>(it->second.kind)];
+			m_requests.erase(it);
+		}
+		++m_stats.completed;
+		m_stats.loadTimeMs.Record(std::chrono::duration<double, std::milli>(Clock::now() - startTime).count());
+		Dispatch();
+		m_idleCondition.notify_all();
+	}
+
+} // namespace AstralEngine
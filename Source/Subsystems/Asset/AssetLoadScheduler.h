@@ -0,0 +1,135 @@
+#pragma once
+
+#include "AssetHandle.h"
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+namespace AstralEngine {
+
+	class ThreadPool;
+
+	/// How soon a load is needed; lower values are served first
+	enum class AssetLoadPriority : uint8_t {
+		Visible,  ///< Needed for the frame being drawn
+		Nearby,   ///< Likely needed soon (near the camera, next level section)
+		Prefetch, ///< Background warm-up
+		Count
+	};
+
+	/// Which resource a load mostly waits on; each kind has its own concurrency limit
+	enum class AssetLoadKind : uint8_t {
+		IO,  ///< Reads ready-to-use data (cooked files, containers, shaders, materials)
+		CPU, ///< Decodes and cooks source files
+		Count
+	};
+
+	/// Counts per power-of-two bucket: [0,1), [1,2), [2,4), ... the last bucket is open-ended
+	struct LoadHistogram {
+		static constexpr size_t BUCKET_COUNT = 16;
+		std::array<uint64_t, BUCKET_COUNT> counts{};
+		uint64_t total = 0;
+
+		void Record(double value);
+		// Upper bound of the bucket holding the given fraction (0-1) of samples
+		double Percentile(double fraction) const;
+	};
+
+	/**
+	 * @class AssetLoadScheduler
+	 * @brief Asset yüklemelerini önceliğe göre thread pool'a dağıtır.
+	 *
+	 * İstekler pool'a hemen gönderilmez; her tür (I/O, CPU) için ayrı
+	 * eşzamanlılık sınırı dolana kadar en yüksek öncelikli ve en eski istek
+	 * seçilir. Böylece büyük bir arka plan modeli ekranda gereken bir
+	 * texture'ı bekletmez. Kuyruktaki istekler yeniden önceliklendirilebilir
+	 * veya iptal edilebilir; çalışmaya başlamış yükler iptal edilemez.
+	 * Thread-safe'tir.
+	 */
+	class AssetLoadScheduler {
+	public:
+		struct Stats {
+			std::array<uint32_t, static_cast<size_t>(AssetLoadPriority::Count)> queued{};
+			std::array<uint32_t, static_cast<size_t>(AssetLoadKind::Count)> running{};
+			uint64_t completed = 0;
+			uint64_t cancelled = 0;
+			LoadHistogram queueDepth;  // Sampled on every enqueue
+			LoadHistogram queueWaitMs; // Enqueue to start
+			LoadHistogram loadTimeMs;  // Start to finish
+		};
+
+		explicit AssetLoadScheduler(ThreadPool* threadPool);
+		~AssetLoadScheduler();
+
+		// Limits must leave room in the pool, or started loads wait in its FIFO queue again
+		void SetConcurrency(uint32_t ioLimit, uint32_t cpuLimit);
+
+		// Queues run on the pool; onCancel runs instead if the load is cancelled while
+		// queued. Returns false (and only raises the priority) if handle is already pending.
+		bool Enqueue(const AssetHandle& handle, AssetLoadPriority priority, AssetLoadKind kind,
+					 std::function<void()> run, std::function<void()> onCancel);
+
+		// Like Enqueue, for loads that wait on asynchronous reads: the load holds its
+		// lane's slot until it calls finish, from any thread, and frees its pool thread
+		// as soon as run returns
+		using AsyncRun = std::function<void(std::function<void()> finish)>;
+		bool EnqueueAsync(const AssetHandle& handle, AssetLoadPriority priority, AssetLoadKind kind,
+						  AsyncRun run, std::function<void()> onCancel);
+
+		// Moves a queued load to the given priority; false if it is not queued
+		bool SetPriority(const AssetHandle& handle, AssetLoadPriority priority);
+		// Like SetPriority, but never lowers it
+		bool Raise(const AssetHandle& handle, AssetLoadPriority priority);
+
+		// Drops a queued load and runs its onCancel; false if it is not queued
+		bool Cancel(const AssetHandle& handle);
+
+		// Queued or running
+		bool IsPending(const AssetHandle& handle) const;
+
+		// Cancels everything queued and stops dispatching; running loads finish
+		void Shutdown();
+		// Blocks until no load is running, including asynchronous ones
+		void WaitForIdle();
+
+		Stats GetStats() const;
+
+	private:
+		using Clock = std::chrono::steady_clock;
+		// (priority, sequence) orders a lane; sequence keeps FIFO within a priority
+		using QueueKey = std::tuple<AssetLoadPriority, uint64_t>;
+
+		struct Request {
+			AssetLoadPriority priority = AssetLoadPriority::Prefetch;
+			AssetLoadKind kind = AssetLoadKind::CPU;
+			uint64_t sequence = 0;
+			bool running = false;
+			Clock::time_point enqueueTime;
+			AsyncRun run;
+			std::function<void()> onCancel;
+		};
+
+		bool Reprioritize(const AssetHandle& handle, AssetLoadPriority priority, bool raiseOnly);
+		// Starts queued loads while their lane has capacity; call with m_mutex held
+		void Dispatch();
+		void Finish(const AssetHandle& handle, Clock::time_point startTime);
+
+		ThreadPool* m_threadPool;
+		mutable std::mutex m_mutex;
+		std::condition_variable m_idleCondition;
+		bool m_stopped = false;
+		uint64_t m_nextSequence = 0;
+
+		std::unordered_map<AssetHandle, Request> m_requests;
+		std::array<std::map<QueueKey, AssetHandle>, static_cast<size_t>(AssetLoadKind::Count)> m_queues;
+		std::array<uint32_t, static_cast<size_t>(AssetLoadKind::Count)> m_limits{};
+		Stats m_stats;
+	};
+
+} // namespace AstralEngine
@@ -1,4 +1,8 @@
 #include "AssetManager.h"
+#include "../../Core/AsyncFileIO.h"
+#include "../../Core/FileUtils.h"
+#include "../../Core/FileWatcher.h"
+#include "../../Core/Hash.h"
 #include "../../Core/Logger.h"
 #include "MaterialImporter.h"
 #include "ModelImporter.h"
@@ -7,11 +11,24 @@
 
 // Other importers will be included as they are created
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
 #include <filesystem>
+#include <unordered_set>
 
 namespace AstralEngine {
 
-AssetManager::AssetManager() : m_initialized(false) {}
+AssetManager::AssetManager() : m_initialized(false) {
+  // CPU-side copies; GPU resources are budgeted by the renderer
+  constexpr size_t MB = 1024 * 1024;
+  SetMemoryBudget(AssetHandle::Type::Texture, 1024 * MB);
+  SetMemoryBudget(AssetHandle::Type::Model, 1024 * MB);
+  SetMemoryBudget(AssetHandle::Type::Audio, 256 * MB);
+  SetMemoryBudget(AssetHandle::Type::Shader, 64 * MB);
+  SetMemoryBudget(AssetHandle::Type::Material, 16 * MB);
+}
 
 AssetManager::~AssetManager() {
   if (m_initialized) {
@@ -26,7 +43,11 @@ bool AssetManager::Initialize(const std::string &assetDirectory) {
   }
 
   m_assetDirectory = assetDirectory;
-  if (!std::filesystem::exists(m_assetDirectory)) {
+  // A shipped build may have only the packed archive
+  const std::string defaultArchive = GetDefaultArchivePath();
+  const bool hasArchive = std::filesystem::exists(defaultArchive);
+  const bool hasDirectory = std::filesystem::exists(m_assetDirectory);
+  if (!hasDirectory && !hasArchive) {
     Logger::Error("AssetManager", "Asset directory does not exist: '{}'",
                   m_assetDirectory);
     return false;
@@ -34,10 +55,26 @@ bool AssetManager::Initialize(const std::string &assetDirectory) {
 
   size_t num_threads = std::max(1u, std::thread::hardware_concurrency());
   m_threadPool = std::make_unique<ThreadPool>(num_threads);
+  m_loadScheduler = std::make_unique<AssetLoadScheduler>(m_threadPool.get());
+  m_fileIO = std::make_unique<AsyncFileIO>();
 
   RegisterImporters();
+  m_derivedDataCache.Initialize(GetCookedDirectory("DDC"));
 
   m_initialized = true;
+
+  if (hasArchive) {
+    MountArchive(defaultArchive);
+  }
+
+  m_fileWatcher = std::make_unique<FileWatcher>();
+  if (!hasDirectory ||
+      !m_fileWatcher->Start(m_assetDirectory,
+                            [this](const std::vector<std::string> &files) {
+                              OnFilesChanged(files);
+                            })) {
+    Logger::Warning("AssetManager", "Hot reload is disabled");
+  }
   Logger::Info("AssetManager", "AssetManager initialized with directory: '{}'",
                m_assetDirectory);
   return true;
@@ -48,12 +85,53 @@ void AssetManager::Shutdown() {
     return;
   }
   Logger::Info("AssetManager", "Shutting down AssetManager...");
+  // Stopped first, so no reload is queued behind the shutdown
+  m_fileWatcher.reset();
+  // Queued loads are dropped; running ones may still be waiting on reads,
+  // whose callbacks use the pool
+  m_loadScheduler->Shutdown();
+  m_loadScheduler->WaitForIdle();
+  m_fileIO.reset();
   m_threadPool.reset(); // Shuts down the thread pool
 
+  AssetLoadScheduler::Stats loadStats = m_loadScheduler->GetStats();
+  Logger::Info("AssetManager",
+               "Asset loads: {} completed, {} cancelled, queue wait p50 {} ms / "
+               "p95 {} ms, load time p50 {} ms / p95 {} ms",
+               loadStats.completed, loadStats.cancelled,
+               loadStats.queueWaitMs.Percentile(0.5),
+               loadStats.queueWaitMs.Percentile(0.95),
+               loadStats.loadTimeMs.Percentile(0.5),
+               loadStats.loadTimeMs.Percentile(0.95));
+  m_loadScheduler.reset();
+
+  if (m_derivedDataCache.IsEnabled()) {
+    DerivedDataCache::Stats stats = m_derivedDataCache.GetStats();
+    Logger::Info("AssetManager",
+                 "Derived data cache: {} hits, {} misses, {} evictions, {} "
+                 "entries ({:.1f} MB)",
+                 stats.hits, stats.misses, stats.evictions, stats.entryCount,
+                 stats.sizeBytes / (1024.0 * 1024.0));
+  }
+
   {
     std::lock_guard<std::mutex> lock(m_cacheMutex);
     m_assetCache.clear();
   }
+  {
+    std::lock_guard<std::mutex> lock(m_completionMutex);
+    m_completionCallbacks.clear();
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_reloadMutex);
+    m_reloadedAssets.clear();
+    m_dependents.clear();
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_archiveMutex);
+    m_archives.clear();
+    m_looseOverrides.clear();
+  }
   m_registry.ClearAll();
   m_importers.clear();
 
@@ -62,8 +140,12 @@ void AssetManager::Shutdown() {
 }
 
 void AssetManager::RegisterImporters() {
-  RegisterImporter<TextureImporter>(AssetHandle::Type::Texture);
-  RegisterImporter<ModelImporter>(AssetHandle::Type::Model);
+  // Texture cooking and model import split their work across the same pool
+  // they run on
+  m_importers[AssetHandle::Type::Texture] =
+      std::make_unique<TextureImporter>(m_threadPool.get());
+  m_importers[AssetHandle::Type::Model] =
+      std::make_unique<ModelImporter>(MeshOptimizerSettings{}, m_threadPool.get());
   RegisterImporter<ShaderImporter>(AssetHandle::Type::Shader);
   m_importers[AssetHandle::Type::Material] =
       std::make_unique<MaterialImporter>(this);
@@ -86,7 +168,8 @@ AssetHandle AssetManager::RegisterAsset(const std::string &filePath) {
     return AssetHandle();
   }
 
-  AssetHandle handle(filePath, type);
+  // Every spelling of the path ("Assets/X.png", "x.png") gets the same ID
+  AssetHandle handle(GetNormalizedPath(GetFullPath(filePath)), type);
   if (!m_registry.RegisterAsset(handle, filePath, type)) {
     // Already registered is not an error, just return the existing handle.
   }
@@ -99,6 +182,10 @@ bool AssetManager::UnloadAsset(const AssetHandle &handle) {
   }
   std::lock_guard<std::mutex> lock(m_cacheMutex);
   if (m_assetCache.erase(handle) > 0) {
+    if (AssetMetadata *metadata = m_registry.GetMetadata(handle)) {
+      metadata->data.store(nullptr, std::memory_order_release);
+    }
+    m_registry.SetMemorySize(handle, 0);
     m_registry.SetAssetState(handle, AssetLoadState::Unloaded);
     Logger::Debug("AssetManager", "Unloaded asset '{}' from cache.",
                   handle.GetID());
@@ -107,8 +194,9 @@ bool AssetManager::UnloadAsset(const AssetHandle &handle) {
   return false;
 }
 
-void AssetManager::LoadAssetAsync(const AssetHandle &handle) {
-  if (!m_initialized || !m_threadPool || !handle.IsValid()) {
+void AssetManager::LoadAssetAsync(const AssetHandle &handle,
+                                  AssetLoadPriority priority) {
+  if (!m_initialized || !m_loadScheduler || !handle.IsValid()) {
     return;
   }
 
@@ -120,45 +208,532 @@ void AssetManager::LoadAssetAsync(const AssetHandle &handle) {
     return;
   }
 
-  m_registry.SetAssetState(handle, AssetLoadState::Queued);
-
-  // Create a promise and store its future in the cache
-  std::promise<std::shared_ptr<void>> assetPromise;
-  {
-    std::lock_guard<std::mutex> lock(m_cacheMutex);
-    m_assetCache[handle] = assetPromise.get_future().share();
-  }
+  // Create a promise and store its future in the cache. Shared, since both
+  // the load and its cancellation may fulfill it.
+  auto assetPromise = std::make_shared<std::promise<std::shared_ptr<void>>>();
 
-  // Submit the loading task to the thread pool
-  m_threadPool->Submit([this, handle, metadata,
-                        promise = std::move(assetPromise)]() mutable {
+  auto load = [this, handle, metadata, priority,
+               assetPromise](std::function<void()> finishLoad) {
+    // A change that arrived while this load was running is picked up here
+    auto finish = [this, handle, finishLoad]() {
+      finishLoad();
+      ReloadIfDirty(handle);
+    };
     m_registry.SetAssetState(handle, AssetLoadState::Loading);
 
     auto it = m_importers.find(metadata->type);
     if (it == m_importers.end()) {
       Logger::Error("AssetManager", "No importer registered for asset type: {}",
                     (int)metadata->type);
-      m_registry.SetAssetState(handle, AssetLoadState::Failed);
-      promise.set_value(nullptr); // Fulfill the promise with null
+      FinishLoad(handle, *assetPromise, nullptr, AssetLoadState::Failed);
+      finish();
       return;
     }
 
-    std::string fullPath = GetFullPath(metadata->filePath);
-    std::shared_ptr<void> cpuData = it->second->Import(fullPath);
+    IAssetImporter *importer = it->second.get();
+    ImportAsset(handle, *metadata, *importer,
+                [this, handle, importer, priority, assetPromise,
+                 finish](std::shared_ptr<void> cpuData) {
+                  if (!cpuData) {
+                    FinishLoad(handle, *assetPromise, nullptr,
+                               AssetLoadState::Failed);
+                    finish();
+                    return;
+                  }
+
+                  // Dependencies load in parallel at this asset's priority.
+                  // The load ends now; whichever dependency settles last
+                  // publishes the asset.
+                  WhenAllLoaded(RegisterDependencies(handle, *importer, cpuData),
+                                priority, [this, handle, assetPromise, cpuData]() {
+                                  FinishLoad(handle, *assetPromise, cpuData,
+                                             AssetLoadState::Loaded_CPU);
+                                });
+                  finish();
+                });
+  };
 
+  auto cancel = [this, handle, assetPromise]() {
+    {
+      std::lock_guard<std::mutex> lock(m_cacheMutex);
+      m_assetCache.erase(handle);
+    }
+    FinishLoad(handle, *assetPromise, nullptr, AssetLoadState::NotLoaded);
+  };
+
+  // Held across the check and the enqueue, so two callers that both saw
+  // NotLoaded cannot both replace the cached future
+  std::lock_guard<std::mutex> lock(m_cacheMutex);
+  if (m_loadScheduler->IsPending(handle)) {
+    m_loadScheduler->Raise(handle, priority);
+    return;
+  }
+
+  m_assetCache[handle] = assetPromise->get_future().share();
+  m_registry.SetAssetState(handle, AssetLoadState::Queued);
+  if (!m_loadScheduler->EnqueueAsync(handle, priority, GetLoadKind(*metadata),
+                                     std::move(load), std::move(cancel))) {
+    // Shutting down
+    m_assetCache.erase(handle);
+    m_registry.SetAssetState(handle, AssetLoadState::NotLoaded);
+  }
+}
+
+void AssetManager::ImportAsset(const AssetHandle &handle,
+                               const AssetMetadata &metadata,
+                               IAssetImporter &importer, ImportCallback done) {
+  std::string fullPath = GetFullPath(metadata.filePath);
+  auto start = std::chrono::steady_clock::now();
+  auto record = [this, handle, &importer, fullPath, start,
+                 done = std::move(done)](std::shared_ptr<void> cpuData) {
     if (!cpuData) {
       Logger::Error("AssetManager", "Importer failed to load asset: {}",
                     fullPath);
-      m_registry.SetAssetState(handle, AssetLoadState::Failed);
-      promise.set_value(nullptr); // Fulfill the promise with null
+      done(nullptr);
       return;
     }
 
-    m_registry.SetAssetState(handle, AssetLoadState::Loaded_CPU);
-    promise.set_value(cpuData); // Fulfill the promise with the loaded data
+    // Accounted before the asset is published, so eviction never sees it
+    // loaded at size zero; the load time is what evicting it would cost
+    m_registry.SetMemorySize(handle, importer.GetMemoryUsage(cpuData));
+    m_registry.SetLoadTime(handle,
+                           std::chrono::duration<double, std::milli>(
+                               std::chrono::steady_clock::now() - start)
+                               .count());
+    done(std::move(cpuData));
+  };
+
+  if (auto packed = ImportPacked(importer, metadata.type, fullPath)) {
+    record(std::move(packed));
+    return;
+  }
+
+  if (importer.SupportsMemoryImport(fullPath)) {
+    ReadAndDecode(
+        fullPath,
+        [&importer, fullPath](std::shared_ptr<MappedFile> data) {
+          return data ? importer.ImportFromMemory(fullPath, data) : nullptr;
+        },
+        std::move(record));
+    return;
+  }
+
+  std::optional<uint64_t> key =
+      GetDerivedDataKey(importer, metadata.type, fullPath);
+  if (key) {
+    if (auto cachedPath = m_derivedDataCache.Find(*key)) {
+      if (importer.SupportsDerivedDataReadAhead()) {
+        ReadAndDecode(
+            *cachedPath,
+            [this, &importer, fullPath, key](std::shared_ptr<MappedFile> blob) {
+              auto cached = AcceptDerivedData(
+                  blob ? importer.ReadDerivedBlob(blob, fullPath) : nullptr,
+                  *key, fullPath);
+              return cached ? cached : ImportAndCache(importer, fullPath, key);
+            },
+            std::move(record));
+        return;
+      }
+      if (auto cached = AcceptDerivedData(
+              importer.ReadDerivedData(*cachedPath, fullPath), *key, fullPath)) {
+        record(std::move(cached));
+        return;
+      }
+    }
+  }
+  record(ImportAndCache(importer, fullPath, key));
+}
+
+void AssetManager::ReadAndDecode(
+    const std::string &path,
+    std::function<std::shared_ptr<void>(std::shared_ptr<MappedFile>)> decode,
+    ImportCallback done) {
+  // The read callback runs on the I/O thread, which must not decode
+  m_fileIO->ReadFile(path, [this, decode = std::move(decode),
+                            done = std::move(done)](
+                               std::shared_ptr<MappedFile> data) mutable {
+    m_threadPool->Submit([decode = std::move(decode), done = std::move(done),
+                          data = std::move(data)]() {
+      done(decode(data));
+    });
   });
 }
 
+std::vector<AssetHandle>
+AssetManager::RegisterDependencies(const AssetHandle &handle,
+                                   const IAssetImporter &importer,
+                                   const std::shared_ptr<void> &data) {
+  std::vector<AssetHandle> dependencies;
+  for (const auto &path : importer.GetDependencies(data)) {
+    AssetHandle dependency = RegisterAsset(path);
+    if (dependency.IsValid() && dependency != handle) {
+      dependencies.push_back(dependency);
+    }
+  }
+
+  // Remembered for hot reload, which tells dependents their inputs changed
+  std::lock_guard<std::mutex> lock(m_reloadMutex);
+  for (const auto &dependency : dependencies) {
+    auto &dependents = m_dependents[dependency];
+    if (std::find(dependents.begin(), dependents.end(), handle) ==
+        dependents.end()) {
+      dependents.push_back(handle);
+    }
+  }
+  return dependencies;
+}
+
+void AssetManager::WhenAllLoaded(const std::vector<AssetHandle> &handles,
+                                 AssetLoadPriority priority,
+                                 std::function<void()> callback) {
+  if (handles.empty()) {
+    callback();
+    return;
+  }
+
+  auto remaining = std::make_shared<std::atomic<size_t>>(handles.size());
+  auto shared = std::make_shared<std::function<void()>>(std::move(callback));
+  for (const auto &handle : handles) {
+    Prefetch(handle, priority);
+    WhenLoaded(handle, [remaining, shared]() {
+      if (remaining->fetch_sub(1) == 1) {
+        (*shared)();
+      }
+    });
+  }
+}
+
+AssetLoadKind AssetManager::GetLoadKind(const AssetMetadata &metadata) const {
+  if (metadata.type != AssetHandle::Type::Texture &&
+      metadata.type != AssetHandle::Type::Model) {
+    return AssetLoadKind::IO;
+  }
+  // Packed entries are already cooked
+  std::shared_ptr<AssetArchive> archive;
+  if (FindPacked(GetFullPath(metadata.filePath), archive)) {
+    return AssetLoadKind::IO;
+  }
+
+  // Cooked and container files are mapped as is; sources are decoded and
+  // cooked unless the derived data cache has them, which the load finds out
+  std::string extension =
+      std::filesystem::path(metadata.filePath).extension().string();
+  std::transform(extension.begin(), extension.end(), extension.begin(),
+                 ::tolower);
+  if (extension == ".atex" || extension == ".amesh" || extension == ".ktx2" ||
+      extension == ".dds") {
+    return AssetLoadKind::IO;
+  }
+  return AssetLoadKind::CPU;
+}
+
+void AssetManager::FinishLoad(const AssetHandle &handle,
+                              std::promise<std::shared_ptr<void>> &promise,
+                              std::shared_ptr<void> data,
+                              AssetLoadState state) {
+  // Data and future are ready before the state says so, so GetAsset never
+  // sees a loaded state without its data
+  if (AssetMetadata *metadata = m_registry.GetMetadata(handle)) {
+    metadata->data.store(data, std::memory_order_release);
+  }
+  promise.set_value(std::move(data));
+
+  std::vector<std::function<void()>> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(m_completionMutex);
+    m_registry.SetAssetState(handle, state);
+    auto it = m_completionCallbacks.find(handle);
+    if (it != m_completionCallbacks.end()) {
+      callbacks = std::move(it->second);
+      m_completionCallbacks.erase(it);
+    }
+  }
+
+  for (auto &callback : callbacks) {
+    callback();
+  }
+
+  // The asset may have changed while its dependencies loaded
+  ReloadIfDirty(handle);
+}
+
+void AssetManager::WhenLoaded(const AssetHandle &handle,
+                              std::function<void()> callback) {
+  {
+    // Settled states are only set under this lock, so the callback is either
+    // queued before FinishLoad takes the list or runs here. Loading includes
+    // an asset waiting on its own dependencies.
+    std::lock_guard<std::mutex> lock(m_completionMutex);
+    AssetLoadState state = GetAssetState(handle);
+    if (state == AssetLoadState::Queued || state == AssetLoadState::Loading) {
+      m_completionCallbacks[handle].push_back(std::move(callback));
+      return;
+    }
+  }
+  callback();
+}
+
+std::shared_future<std::shared_ptr<void>>
+AssetManager::LoadWithDependencies(const AssetHandle &handle,
+                                   AssetLoadPriority priority) {
+  Prefetch(handle, priority);
+
+  std::lock_guard<std::mutex> lock(m_cacheMutex);
+  auto it = m_assetCache.find(handle);
+  if (it != m_assetCache.end()) {
+    return it->second;
+  }
+
+  // Unregistered handle, or the manager is shutting down
+  std::promise<std::shared_ptr<void>> none;
+  none.set_value(nullptr);
+  return none.get_future().share();
+}
+
+void AssetManager::Prefetch(const AssetHandle &handle,
+                            AssetLoadPriority priority) {
+  AssetLoadState state = GetAssetState(handle);
+  if (state == AssetLoadState::NotLoaded || state == AssetLoadState::Unloaded) {
+    LoadAssetAsync(handle, priority);
+  } else if (state == AssetLoadState::Queued && m_loadScheduler) {
+    m_loadScheduler->Raise(handle, priority);
+  }
+}
+
+bool AssetManager::SetLoadPriority(const AssetHandle &handle,
+                                   AssetLoadPriority priority) {
+  return m_loadScheduler && m_loadScheduler->SetPriority(handle, priority);
+}
+
+bool AssetManager::CancelLoad(const AssetHandle &handle) {
+  return m_loadScheduler && m_loadScheduler->Cancel(handle);
+}
+
+void AssetManager::SetLoadConcurrency(uint32_t ioLimit, uint32_t cpuLimit) {
+  if (m_loadScheduler) {
+    m_loadScheduler->SetConcurrency(ioLimit, cpuLimit);
+  }
+}
+
+AssetLoadScheduler::Stats AssetManager::GetLoadStats() const {
+  return m_loadScheduler ? m_loadScheduler->GetStats()
+                         : AssetLoadScheduler::Stats{};
+}
+
+bool AssetManager::MountArchive(const std::string &archivePath) {
+  auto archive = AssetArchive::Open(archivePath);
+  if (!archive) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(m_archiveMutex);
+  m_archives.push_back(std::move(archive));
+  return true;
+}
+
+std::string AssetManager::GetDefaultArchivePath() const {
+  std::filesystem::path directory =
+      std::filesystem::path(m_assetDirectory).lexically_normal();
+  if (!directory.has_filename()) {
+    directory = directory.parent_path(); // "Assets/"
+  }
+  return directory.string() + AssetArchive::EXTENSION;
+}
+
+std::string AssetManager::GetNormalizedPath(const std::string &fullPath) const {
+  std::filesystem::path relative =
+      std::filesystem::path(fullPath).lexically_normal().lexically_relative(
+          std::filesystem::path(m_assetDirectory).lexically_normal());
+  // Empty if only one of them is absolute; such a path still needs an ID
+  return AssetArchive::NormalizePath(relative.empty() ? fullPath
+                                                      : relative.string());
+}
+
+const AssetArchive::Entry *
+AssetManager::FindPacked(const std::string &fullPath,
+                         std::shared_ptr<AssetArchive> &archive) const {
+  std::string path = GetNormalizedPath(fullPath);
+  std::lock_guard<std::mutex> lock(m_archiveMutex);
+  if (m_archives.empty() || m_looseOverrides.count(path)) {
+    return nullptr;
+  }
+  for (auto it = m_archives.rbegin(); it != m_archives.rend(); ++it) {
+    if (const AssetArchive::Entry *entry = (*it)->Find(path)) {
+      archive = *it;
+      return entry;
+    }
+  }
+  return nullptr;
+}
+
+std::shared_ptr<void> AssetManager::ImportPacked(IAssetImporter &importer,
+                                                 AssetHandle::Type type,
+                                                 const std::string &fullPath) {
+  std::shared_ptr<AssetArchive> archive;
+  const AssetArchive::Entry *entry = FindPacked(fullPath, archive);
+  if (!entry) {
+    return nullptr;
+  }
+
+  // Packed by another engine version or with other import settings; the
+  // loose file, if there is one, is up to date
+  if (entry->assetType != static_cast<uint32_t>(type) ||
+      entry->importerVersion != importer.GetVersion() ||
+      entry->settingsHash != Hash::XXH64(importer.GetSettingsKey())) {
+    Logger::Debug("AssetManager", "Packed '{}' in '{}' is stale, ignoring",
+                  fullPath, archive->GetFilePath());
+    return nullptr;
+  }
+
+  std::shared_ptr<void> cpuData;
+  if (auto blob = archive->Read(*entry)) {
+    cpuData = importer.ReadDerivedBlob(blob, fullPath);
+  }
+  if (!cpuData) {
+    Logger::Warning("AssetManager", "Cannot read packed '{}' from '{}'",
+                    fullPath, archive->GetFilePath());
+  }
+  return cpuData;
+}
+
+bool AssetManager::BuildArchive(const std::string &archivePath,
+                                ArchiveCompression compression) {
+  if (!m_initialized) {
+    Logger::Error("AssetManager",
+                  "Cannot build archive: AssetManager not initialized.");
+    return false;
+  }
+
+  AssetArchiveWriter writer(archivePath, compression);
+  if (!writer.IsOpen()) {
+    return false;
+  }
+
+  // Importers write their output to a file; it is copied in from there
+  const std::string scratchPath =
+      (std::filesystem::path(GetCookedDirectory("Pack")) / "entry.tmp")
+          .string();
+  std::error_code ec;
+  std::filesystem::create_directories(
+      std::filesystem::path(scratchPath).parent_path(), ec);
+
+  auto start = std::chrono::steady_clock::now();
+  size_t skipped = 0;
+  const std::filesystem::path root(m_assetDirectory);
+  for (auto it = std::filesystem::recursive_directory_iterator(root, ec);
+       !ec && it != std::filesystem::recursive_directory_iterator();
+       it.increment(ec)) {
+    if (it->is_directory(ec)) {
+      if (it->path().filename() == "Cooked") {
+        it.disable_recursion_pending();
+      }
+      continue;
+    }
+
+    // Files no importer claims (.bin buffers, sidecars) are only read
+    // through the asset that uses them, which is packed cooked
+    std::string fullPath = it->path().string();
+    AssetHandle::Type type = GetAssetTypeFromFileExtension(fullPath);
+    auto importer = m_importers.find(type);
+    if (importer == m_importers.end()) {
+      continue;
+    }
+
+    std::vector<uint8_t> blob;
+    std::shared_ptr<void> cpuData =
+        ImportWithCache(*importer->second, type, fullPath);
+    if (cpuData && importer->second->WriteDerivedData(cpuData, scratchPath)) {
+      blob = FileUtils::ReadBinaryFile(scratchPath);
+    }
+    if (blob.empty()) {
+      Logger::Warning("AssetManager",
+                      "Cannot pack '{}'; it will load from its loose file",
+                      fullPath);
+      ++skipped;
+      continue;
+    }
+
+    AssetArchiveWriter::EntryInfo info;
+    info.assetType = static_cast<uint32_t>(type);
+    info.importerVersion = importer->second->GetVersion();
+    info.settingsHash = Hash::XXH64(importer->second->GetSettingsKey());
+    if (!writer.Add(GetNormalizedPath(fullPath), blob.data(), blob.size(),
+                    info)) {
+      return false;
+    }
+  }
+  std::filesystem::remove(scratchPath, ec);
+
+  if (!writer.Finish()) {
+    return false;
+  }
+  Logger::Info("AssetManager",
+               "Packed {} assets into '{}' in {:.1f} s ({:.1f} MB, {:.1f} MB "
+               "uncompressed), {} skipped",
+               writer.GetEntryCount(), archivePath,
+               std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                             start)
+                   .count(),
+               writer.GetStoredBytes() / (1024.0 * 1024.0),
+               writer.GetRawBytes() / (1024.0 * 1024.0), skipped);
+  return true;
+}
+
+std::shared_ptr<void>
+AssetManager::ImportWithCache(IAssetImporter &importer, AssetHandle::Type type,
+                              const std::string &fullPath) {
+  std::optional<uint64_t> key = GetDerivedDataKey(importer, type, fullPath);
+  if (key) {
+    if (auto cachedPath = m_derivedDataCache.Find(*key)) {
+      if (auto cached = AcceptDerivedData(
+              importer.ReadDerivedData(*cachedPath, fullPath), *key, fullPath)) {
+        return cached;
+      }
+    }
+  }
+  return ImportAndCache(importer, fullPath, key);
+}
+
+std::optional<uint64_t>
+AssetManager::GetDerivedDataKey(IAssetImporter &importer,
+                                AssetHandle::Type type,
+                                const std::string &fullPath) const {
+  if (!m_derivedDataCache.IsEnabled() ||
+      !importer.SupportsDerivedData(fullPath)) {
+    return std::nullopt;
+  }
+  return DerivedDataCache::ComputeKey(
+      importer.GetSourceFiles(fullPath), static_cast<uint32_t>(type),
+      importer.GetVersion(), importer.GetSettingsKey());
+}
+
+std::shared_ptr<void>
+AssetManager::ImportAndCache(IAssetImporter &importer,
+                             const std::string &fullPath,
+                             std::optional<uint64_t> key) {
+  std::shared_ptr<void> cpuData = importer.Import(fullPath);
+  if (cpuData && key) {
+    m_derivedDataCache.Store(*key, [&](const std::string &cachePath) {
+      return importer.WriteDerivedData(cpuData, cachePath);
+    });
+  }
+  return cpuData;
+}
+
+std::shared_ptr<void>
+AssetManager::AcceptDerivedData(std::shared_ptr<void> cached, uint64_t key,
+                                const std::string &fullPath) {
+  if (cached) {
+    Logger::Debug("AssetManager", "Derived data cache hit for '{}' ({:016x})",
+                  fullPath, key);
+    return cached;
+  }
+  Logger::Warning("AssetManager",
+                  "Discarding unreadable derived data for '{}' ({:016x})",
+                  fullPath, key);
+  m_derivedDataCache.Remove(key);
+  return nullptr;
+}
+
 bool AssetManager::IsAssetLoaded(const AssetHandle &handle) const {
   if (!handle.IsValid())
     return false;
@@ -178,6 +753,14 @@ AssetManager::GetMetadata(const AssetHandle &handle) const {
   return m_registry.GetMetadata(handle);
 }
 
+std::string AssetManager::GetAssetPath(const AssetHandle &handle) const {
+  return m_registry.GetAssetPath(handle);
+}
+
+std::string AssetManager::GetCookedDirectory(const std::string &category) const {
+  return (std::filesystem::path(m_assetDirectory) / "Cooked" / category).string();
+}
+
 std::string AssetManager::GetFullPath(const std::string &relativePath) const {
   std::string path = relativePath;
   if (path.compare(0, 7, "Assets/") == 0) {
@@ -195,11 +778,12 @@ AssetManager::GetAssetTypeFromFileExtension(const std::string &filePath) const {
                  ::tolower);
 
   if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" ||
-      extension == ".bmp" || extension == ".tga" || extension == ".hdr") {
+      extension == ".bmp" || extension == ".tga" || extension == ".hdr" ||
+      extension == ".atex" || extension == ".ktx2" || extension == ".dds") {
     return AssetHandle::Type::Texture;
   }
   if (extension == ".obj" || extension == ".fbx" || extension == ".gltf" ||
-      extension == ".glb") {
+      extension == ".glb" || extension == ".amesh") {
     return AssetHandle::Type::Model;
   }
   if (extension == ".amat") { // Astral Material
@@ -214,11 +798,377 @@ AssetManager::GetAssetTypeFromFileExtension(const std::string &filePath) const {
 }
 
 void AssetManager::Update() {
-  // Process loaded assets, handle garbage collection, etc.
+  if (!m_initialized) {
+    return;
+  }
+
+  auto now = std::chrono::steady_clock::now();
+  if (now - m_lastEviction >= EVICTION_INTERVAL) {
+    m_lastEviction = now;
+    EvictUnused();
+  }
+}
+
+void AssetManager::SetMemoryBudget(AssetHandle::Type type, size_t bytes) {
+  std::lock_guard<std::mutex> lock(m_memoryMutex);
+  m_memoryStats[static_cast<size_t>(type)].budgetBytes = bytes;
+}
+
+size_t AssetManager::GetMemoryBudget(AssetHandle::Type type) const {
+  std::lock_guard<std::mutex> lock(m_memoryMutex);
+  return m_memoryStats[static_cast<size_t>(type)].budgetBytes;
+}
+
+AssetMemoryStats AssetManager::GetMemoryStats(AssetHandle::Type type) const {
+  AssetMemoryStats stats;
+  {
+    std::lock_guard<std::mutex> lock(m_memoryMutex);
+    stats = m_memoryStats[static_cast<size_t>(type)];
+  }
+  stats.usedBytes = m_registry.GetMemoryUsageByType(type);
+  return stats;
+}
+
+void AssetManager::Pin(const AssetHandle &handle) {
+  m_registry.IncrementRefCount(handle);
+}
+
+void AssetManager::Unpin(const AssetHandle &handle) {
+  m_registry.DecrementRefCount(handle);
+}
+
+bool AssetManager::IsReferenced(const AssetHandle &handle,
+                                const AssetMetadata &metadata) const {
+  if (m_registry.GetRefCount(handle) > 0) {
+    return true;
+  }
+  // Any owner besides the manager (a renderer, a streamer) would keep the
+  // data alive anyway, and evicting it would only load a second copy. The
+  // manager's own owners are counted here rather than assumed: the metadata,
+  // this copy, and the cached future if it holds the same data.
+  std::lock_guard<std::mutex> lock(m_cacheMutex);
+  std::shared_ptr<void> data = metadata.data.load(std::memory_order_acquire);
+  if (!data) {
+    return false;
+  }
+  long managerOwners = 2;
+  auto it = m_assetCache.find(handle);
+  if (it != m_assetCache.end() &&
+      it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready &&
+      it->second.get() == data) {
+    ++managerOwners;
+  }
+  assert(data.use_count() >= managerOwners);
+  return data.use_count() > managerOwners;
+}
+
+size_t AssetManager::EvictUnused() {
+  struct Candidate {
+    AssetHandle handle;
+    size_t size;
+    double score;
+  };
+
+  std::array<size_t, ASSET_TYPE_COUNT> used{};
+  std::array<uint32_t, ASSET_TYPE_COUNT> pinned{};
+  std::array<std::vector<Candidate>, ASSET_TYPE_COUNT> candidates;
+  const uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::system_clock::now().time_since_epoch())
+                           .count();
+
+  for (const AssetHandle &handle : m_registry.GetAllAssets()) {
+    const AssetMetadata *metadata = m_registry.GetMetadata(handle);
+    if (!metadata) {
+      continue;
+    }
+    AssetLoadState state = metadata->state.load(std::memory_order_acquire);
+    if (state != AssetLoadState::Loaded_CPU && state != AssetLoadState::Loaded) {
+      continue;
+    }
+
+    const size_t type = static_cast<size_t>(metadata->type);
+    const size_t size = m_registry.GetMemorySize(handle);
+    used[type] += size;
+    if (IsReferenced(handle, *metadata)) {
+      ++pinned[type];
+      continue;
+    }
+
+    const uint64_t lastAccess =
+        metadata->lastAccessTime.load(std::memory_order_relaxed);
+    const uint64_t age = now > lastAccess ? now - lastAccess : 0;
+    if (age < MIN_EVICTION_AGE_MS || size == 0) {
+      continue;
+    }
+    // Old, large and cheap to load again goes first
+    const double reloadMs = std::max(m_registry.GetLoadTime(handle), 1.0);
+    candidates[type].push_back(
+        {handle, size, static_cast<double>(age) * size / reloadMs});
+  }
+
+  size_t evictedTotal = 0;
+  for (size_t type = 0; type < ASSET_TYPE_COUNT; ++type) {
+    size_t budget;
+    {
+      std::lock_guard<std::mutex> lock(m_memoryMutex);
+      m_memoryStats[type].pinnedCount = pinned[type];
+      budget = m_memoryStats[type].budgetBytes;
+      if (budget == 0 || used[type] <= budget) {
+        m_memoryStats[type].overBudget = false;
+        continue;
+      }
+    }
+
+    auto &list = candidates[type];
+    std::sort(list.begin(), list.end(),
+              [](const Candidate &a, const Candidate &b) {
+                return a.score > b.score;
+              });
+
+    uint64_t evictions = 0;
+    size_t evictedBytes = 0;
+    for (const Candidate &candidate : list) {
+      if (used[type] <= budget) {
+        break;
+      }
+      if (UnloadAsset(candidate.handle)) {
+        used[type] -= candidate.size;
+        evictedBytes += candidate.size;
+        ++evictions;
+      }
+    }
+
+    bool wasOverBudget;
+    {
+      std::lock_guard<std::mutex> lock(m_memoryMutex);
+      m_memoryStats[type].evictions += evictions;
+      m_memoryStats[type].evictedBytes += evictedBytes;
+      wasOverBudget = m_memoryStats[type].overBudget;
+      m_memoryStats[type].overBudget = used[type] > budget;
+    }
+    evictedTotal += evictedBytes;
+
+    // Warned once per overrun; the next passes keep evicting what they can
+    if (used[type] > budget && !wasOverBudget) {
+      Logger::Warning("AssetManager",
+                      "Asset type {} is over its memory budget ({:.1f} / "
+                      "{:.1f} MB); the rest is referenced or in use",
+                      type, used[type] / (1024.0 * 1024.0),
+                      budget / (1024.0 * 1024.0));
+    } else if (evictions > 0) {
+      Logger::Debug("AssetManager",
+                    "Evicted {} assets of type {} ({:.1f} MB)", evictions,
+                    type, evictedBytes / (1024.0 * 1024.0));
+    }
+  }
+  return evictedTotal;
 }
 
 void AssetManager::CheckForAssetChanges() {
-  // Hot-reload logic
+  // The watcher thread has already re-imported and swapped the assets; this
+  // only tells listeners, on the caller's thread
+  std::vector<AssetHandle> reloaded;
+  std::vector<ReloadListener> listeners;
+  {
+    std::lock_guard<std::mutex> lock(m_reloadMutex);
+    if (m_reloadedAssets.empty()) {
+      return;
+    }
+    reloaded.swap(m_reloadedAssets);
+
+    // A material is stale when one of its textures or shaders changed
+    for (size_t i = 0; i < reloaded.size(); ++i) {
+      auto it = m_dependents.find(reloaded[i]);
+      if (it == m_dependents.end()) {
+        continue;
+      }
+      for (const auto &dependent : it->second) {
+        if (std::find(reloaded.begin(), reloaded.end(), dependent) ==
+            reloaded.end()) {
+          reloaded.push_back(dependent);
+        }
+      }
+    }
+
+    for (const auto &[id, listener] : m_reloadListeners) {
+      listeners.push_back(listener);
+    }
+  }
+
+  for (const auto &handle : reloaded) {
+    for (const auto &listener : listeners) {
+      listener(handle);
+    }
+  }
+}
+
+uint64_t AssetManager::AddReloadListener(ReloadListener listener) {
+  std::lock_guard<std::mutex> lock(m_reloadMutex);
+  uint64_t id = m_nextReloadListenerId++;
+  m_reloadListeners.emplace(id, std::move(listener));
+  return id;
+}
+
+void AssetManager::RemoveReloadListener(uint64_t id) {
+  std::lock_guard<std::mutex> lock(m_reloadMutex);
+  m_reloadListeners.erase(id);
+}
+
+bool AssetManager::ReloadAsset(const AssetHandle &handle) {
+  AssetMetadata *metadata = m_registry.GetMetadata(handle);
+  if (!m_initialized || !m_loadScheduler || !metadata) {
+    return false;
+  }
+
+  AssetLoadState state = metadata->state.load(std::memory_order_acquire);
+  if (state == AssetLoadState::Failed) {
+    // Retried by the next GetAsset
+    m_registry.SetAssetState(handle, AssetLoadState::NotLoaded);
+    return true;
+  }
+  if (state == AssetLoadState::Queued) {
+    // Not started; it reads the new file
+    return true;
+  }
+  if (state == AssetLoadState::Loading) {
+    // May have read the old file already
+    return DeferReload(handle);
+  }
+  if (state != AssetLoadState::Loaded_CPU && state != AssetLoadState::Loaded) {
+    // Not loaded any more; the next load reads the new file anyway
+    return false;
+  }
+
+  auto it = m_importers.find(metadata->type);
+  if (it == m_importers.end()) {
+    return false;
+  }
+  IAssetImporter *importer = it->second.get();
+
+  // The old data stays in use until the new version and its dependencies
+  // are ready; a failed import keeps it
+  auto reload = [this, handle, metadata,
+                 importer](std::function<void()> finishReload) {
+    auto finish = [this, handle, finishReload]() {
+      finishReload();
+      ReloadIfDirty(handle);
+    };
+    ImportAsset(handle, *metadata, *importer,
+                [this, handle, metadata, importer,
+                 finish](std::shared_ptr<void> cpuData) {
+                  if (!cpuData) {
+                    Logger::Warning("AssetManager",
+                                    "Keeping the previous version of '{}'",
+                                    metadata->filePath);
+                    finish();
+                    return;
+                  }
+
+                  WhenAllLoaded(
+                      RegisterDependencies(handle, *importer, cpuData),
+                      AssetLoadPriority::Nearby,
+                      [this, handle, metadata, cpuData]() {
+                        std::promise<std::shared_ptr<void>> promise;
+                        promise.set_value(cpuData);
+                        {
+                          std::lock_guard<std::mutex> lock(m_cacheMutex);
+                          if (m_assetCache.find(handle) == m_assetCache.end()) {
+                            // Unloaded or evicted meanwhile
+                            return;
+                          }
+                          m_assetCache[handle] = promise.get_future().share();
+                          metadata->data.store(cpuData,
+                                               std::memory_order_release);
+                        }
+                        {
+                          std::lock_guard<std::mutex> lock(m_reloadMutex);
+                          m_reloadedAssets.push_back(handle);
+                        }
+                        Logger::Info("AssetManager", "Reloaded '{}'",
+                                     metadata->filePath);
+                      });
+                  finish();
+                });
+  };
+
+  if (!m_loadScheduler->EnqueueAsync(handle, AssetLoadPriority::Nearby,
+                                     GetLoadKind(*metadata), std::move(reload),
+                                     nullptr)) {
+    // An earlier reload is pending and may have read the old file already
+    return DeferReload(handle);
+  }
+  return true;
+}
+
+bool AssetManager::DeferReload(const AssetHandle &handle) {
+  {
+    std::lock_guard<std::mutex> lock(m_reloadMutex);
+    m_dirtyAssets.insert(handle);
+  }
+
+  // The pending load may have completed before the handle was marked; then
+  // nothing else would pick it up
+  AssetLoadState state = m_registry.GetAssetState(handle);
+  if (state != AssetLoadState::Queued && state != AssetLoadState::Loading &&
+      !m_loadScheduler->IsPending(handle)) {
+    ReloadIfDirty(handle);
+  }
+  return true;
+}
+
+void AssetManager::ReloadIfDirty(const AssetHandle &handle) {
+  {
+    std::lock_guard<std::mutex> lock(m_reloadMutex);
+    if (m_dirtyAssets.erase(handle) == 0) {
+      return;
+    }
+  }
+  ReloadAsset(handle);
+}
+
+void AssetManager::OnFilesChanged(const std::vector<std::string> &files) {
+  const std::filesystem::path cookedDirectory =
+      std::filesystem::path(GetCookedDirectory("")).lexically_normal();
+  auto normalize = [](const std::string &path) {
+    return std::filesystem::path(path).lexically_normal().generic_string();
+  };
+
+  std::unordered_set<std::string> changed;
+  for (const auto &file : files) {
+    // Cooked output is written by the loads themselves
+    std::string path = normalize(file);
+    if (path.rfind(cookedDirectory.generic_string(), 0) != 0) {
+      changed.insert(std::move(path));
+    }
+  }
+  if (changed.empty()) {
+    return;
+  }
+
+  // Matched through the importers' source files, so editing a .bin or an
+  // import settings sidecar reloads the asset that reads it
+  for (const auto &handle : m_registry.GetAllAssets()) {
+    const AssetMetadata *metadata = m_registry.GetMetadata(handle);
+    if (!metadata) {
+      continue;
+    }
+    auto it = m_importers.find(metadata->type);
+    if (it == m_importers.end()) {
+      continue;
+    }
+    std::string fullPath = GetFullPath(metadata->filePath);
+    for (const auto &source : it->second->GetSourceFiles(fullPath)) {
+      if (changed.count(normalize(source))) {
+        {
+          // The packed copy predates the edit
+          std::lock_guard<std::mutex> lock(m_archiveMutex);
+          m_looseOverrides.insert(GetNormalizedPath(fullPath));
+        }
+        ReloadAsset(handle);
+        break;
+      }
+    }
+  }
 }
 
 } // namespace AstralEngine
\ No newline at end of file
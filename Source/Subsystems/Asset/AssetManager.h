@@ -1,19 +1,40 @@
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
+#include <functional>
 #include <future>
 #include <mutex>
+#include <optional>
+#include <vector>
+#include "AssetArchive.h"
 #include "AssetHandle.h"
 #include "AssetRegistry.h"
 #include "IAssetImporter.h"
 #include "AssetData.h"
+#include "AssetLoadScheduler.h"
+#include "DerivedDataCache.h"
 #include "../../Core/ThreadPool.h"
 #include "../../Core/Logger.h"
 
 namespace AstralEngine {
 
+class AsyncFileIO;
+class FileWatcher;
+
+struct AssetMemoryStats {
+    size_t usedBytes = 0;      // Loaded assets of the type, as reported by its importer
+    size_t budgetBytes = 0;    // 0 means unlimited
+    uint32_t pinnedCount = 0;  // Referenced at the last eviction pass
+    uint64_t evictions = 0;    // Since Initialize
+    uint64_t evictedBytes = 0;
+    bool overBudget = false;   // Eviction could not get under budget
+};
+
 /**
  * @brief Manages game assets using a handle-based asynchronous architecture.
  *
@@ -35,7 +56,7 @@ public:
 
     // Modern Asset Loading API
     template<typename T>
-    AssetHandle Load(const std::string& filePath) {
+    AssetHandle Load(const std::string& filePath, AssetLoadPriority priority = AssetLoadPriority::Visible) {
         static_assert(std::is_base_of_v<ModelData, T> ||
                      std::is_base_of_v<TextureData, T> ||
                      std::is_base_of_v<ShaderData, T> ||
@@ -43,20 +64,20 @@ public:
                      "T must be a valid asset data type (ModelData, TextureData, ShaderData, or MaterialData)");
         AssetHandle handle = RegisterAsset(filePath);
         if (handle.IsValid()) {
-            GetAsset<T>(handle); // Trigger async loading
+            GetAsset<T>(handle, priority); // Trigger async loading
         }
         return handle;
     }
 
     template<typename T>
-    std::future<AssetHandle> LoadAsync(const std::string& filePath) {
+    std::future<AssetHandle> LoadAsync(const std::string& filePath, AssetLoadPriority priority = AssetLoadPriority::Visible) {
         static_assert(std::is_base_of_v<ModelData, T> ||
                      std::is_base_of_v<TextureData, T> ||
                      std::is_base_of_v<ShaderData, T> ||
                      std::is_base_of_v<MaterialData, T>,
                      "T must be a valid asset data type (ModelData, TextureData, ShaderData, or MaterialData)");
-        return m_threadPool->Submit([this, filePath]() {
-            return Load<T>(filePath);
+        return m_threadPool->Submit([this, filePath, priority]() {
+            return Load<T>(filePath, priority);
         });
     }
 
@@ -64,30 +85,132 @@ public:
     AssetHandle RegisterAsset(const std::string& filePath);
     bool UnloadAsset(const AssetHandle& handle);
 
-    // Asynchronous Asset Access
+    // Asynchronous Asset Access. Starts the load at the given priority if needed;
+    // asking again while it is queued raises the priority, never lowers it.
     template<typename T>
-    std::shared_ptr<T> GetAsset(const AssetHandle& handle);
+    std::shared_ptr<T> GetAsset(const AssetHandle& handle, AssetLoadPriority priority = AssetLoadPriority::Visible);
+
+    // Load scheduling
+    void Prefetch(const AssetHandle& handle, AssetLoadPriority priority = AssetLoadPriority::Prefetch);
+    bool SetLoadPriority(const AssetHandle& handle, AssetLoadPriority priority);
+    // Drops a load that has not started yet; the asset goes back to NotLoaded
+    bool CancelLoad(const AssetHandle& handle);
+    void SetLoadConcurrency(uint32_t ioLimit, uint32_t cpuLimit);
+    AssetLoadScheduler::Stats GetLoadStats() const;
+
+    // Resolves once the asset and everything it depends on (a material's
+    // shaders and textures) have settled; starts the loads if needed. Failed
+    // dependencies do not fail the asset.
+    std::shared_future<std::shared_ptr<void>> LoadWithDependencies(const AssetHandle& handle,
+                                                                   AssetLoadPriority priority = AssetLoadPriority::Visible);
+    // Runs callback once the asset has loaded, failed or been cancelled;
+    // right away if it already has or is not loading
+    void WhenLoaded(const AssetHandle& handle, std::function<void()> callback);
+
+    // Memory budgets, per asset type. When a type is over budget, Update
+    // evicts loaded assets nothing references: the least recently used,
+    // largest and cheapest to reload first. An asset is referenced while it
+    // is pinned or while anyone outside the manager holds its data.
+    void SetMemoryBudget(AssetHandle::Type type, size_t bytes);
+    size_t GetMemoryBudget(AssetHandle::Type type) const;
+    AssetMemoryStats GetMemoryStats(AssetHandle::Type type) const;
+    // Runs an eviction pass now; returns the bytes evicted
+    size_t EvictUnused();
+
+    // Pinned assets are never evicted; pins are counted. See AssetReference.
+    void Pin(const AssetHandle& handle);
+    void Unpin(const AssetHandle& handle);
 
     // Asset State & Info
     bool IsAssetLoaded(const AssetHandle& handle) const;
     AssetLoadState GetAssetState(const AssetHandle& handle) const;
     const AssetMetadata* GetMetadata(const AssetHandle& handle) const;
+    // The path the asset was registered with; empty if it is not registered
+    std::string GetAssetPath(const AssetHandle& handle) const;
 
     // Asset Registry Access
     AssetRegistry& GetRegistry() { return m_registry; }
     const AssetRegistry& GetRegistry() const { return m_registry; }
 
+    // Cooked importer output keyed by source contents; see DerivedDataCache
+    DerivedDataCache& GetDerivedDataCache() { return m_derivedDataCache; }
+
+    // Packed archives (see AssetArchive). Assets a mounted archive holds are
+    // read from it instead of their loose files, until the loose file changes;
+    // later mounts take precedence. Initialize mounts GetDefaultArchivePath
+    // ("Assets.apak" next to "Assets") if it exists.
+    bool MountArchive(const std::string& archivePath);
+    std::string GetDefaultArchivePath() const;
+    // Imports every asset under the asset directory and packs the importer
+    // output; the AssetPacker tool runs this
+    bool BuildArchive(const std::string& archivePath, ArchiveCompression compression = ArchiveCompression::None);
+
     // Utility
     std::string GetFullPath(const std::string& relativePath) const;
+    // Where importers keep derived (cooked) data for a category, e.g. "Meshes"
+    std::string GetCookedDirectory(const std::string& category) const;
 
     // Update and monitoring
     void Update();
+    // Hot reload. A file watcher re-imports changed assets in the background
+    // and swaps them in once their dependencies are ready; this then runs
+    // the reload listeners, on the calling thread, for each of them and for
+    // every asset that depends on one (a material on its textures).
     void CheckForAssetChanges();
+    using ReloadListener = std::function<void(const AssetHandle&)>;
+    uint64_t AddReloadListener(ReloadListener listener);
+    void RemoveReloadListener(uint64_t id);
+    // Re-imports a loaded asset; false if it is not loaded. A change that
+    // arrives while a load or reload is in progress is applied once it completes.
+    bool ReloadAsset(const AssetHandle& handle);
 
 private:
     void RegisterImporters();
     AssetHandle::Type GetAssetTypeFromFileExtension(const std::string& filePath) const;
-    void LoadAssetAsync(const AssetHandle& handle);
+    void LoadAssetAsync(const AssetHandle& handle, AssetLoadPriority priority);
+    AssetLoadKind GetLoadKind(const AssetMetadata& metadata) const;
+    // Publishes the result, then runs the asset's WhenLoaded callbacks
+    void FinishLoad(const AssetHandle& handle, std::promise<std::shared_ptr<void>>& promise,
+                    std::shared_ptr<void> data, AssetLoadState state);
+    std::shared_ptr<void> ImportWithCache(IAssetImporter& importer, AssetHandle::Type type,
+                                          const std::string& fullPath);
+    // Derived data cache key; nullopt if the cache is off or the importer does not use it
+    std::optional<uint64_t> GetDerivedDataKey(IAssetImporter& importer, AssetHandle::Type type,
+                                              const std::string& fullPath) const;
+    // Runs the importer and stores its output under key, if there is one
+    std::shared_ptr<void> ImportAndCache(IAssetImporter& importer, const std::string& fullPath,
+                                         std::optional<uint64_t> key);
+    // Returns cached, or drops the entry and returns null if it could not be read
+    std::shared_ptr<void> AcceptDerivedData(std::shared_ptr<void> cached, uint64_t key,
+                                            const std::string& fullPath);
+    // Null if no mounted archive has a current copy of the asset
+    std::shared_ptr<void> ImportPacked(IAssetImporter& importer, AssetHandle::Type type,
+                                       const std::string& fullPath);
+    const AssetArchive::Entry* FindPacked(const std::string& fullPath, std::shared_ptr<AssetArchive>& archive) const;
+    // Relative to the asset directory, as AssetArchive::NormalizePath spells it;
+    // keys both asset IDs and archive entries
+    std::string GetNormalizedPath(const std::string& fullPath) const;
+    // Imports and records the asset's memory size and load time, then passes
+    // the data (null on failure) to done. Files the importer can decode from
+    // memory are read asynchronously; done then runs on a pool thread.
+    using ImportCallback = std::function<void(std::shared_ptr<void>)>;
+    void ImportAsset(const AssetHandle& handle, const AssetMetadata& metadata,
+                     IAssetImporter& importer, ImportCallback done);
+    // Reads path asynchronously, then runs decode on the thread pool
+    void ReadAndDecode(const std::string& path,
+                       std::function<std::shared_ptr<void>(std::shared_ptr<MappedFile>)> decode,
+                       ImportCallback done);
+    std::vector<AssetHandle> RegisterDependencies(const AssetHandle& handle, const IAssetImporter& importer,
+                                                  const std::shared_ptr<void>& data);
+    // Starts the loads and runs callback once all of them have settled
+    void WhenAllLoaded(const std::vector<AssetHandle>& handles, AssetLoadPriority priority,
+                       std::function<void()> callback);
+    // Watcher thread
+    void OnFilesChanged(const std::vector<std::string>& files);
+    bool IsReferenced(const AssetHandle& handle, const AssetMetadata& metadata) const;
+    // Marks handle to be reloaded once its pending load completes
+    bool DeferReload(const AssetHandle& handle);
+    void ReloadIfDirty(const AssetHandle& handle);
 
     template<typename T>
     void RegisterImporter(AssetHandle::Type type);
@@ -98,11 +221,44 @@ private:
 
     AssetRegistry m_registry;
     std::unique_ptr<ThreadPool> m_threadPool;
+    std::unique_ptr<AssetLoadScheduler> m_loadScheduler;
+    std::unique_ptr<AsyncFileIO> m_fileIO;
+    DerivedDataCache m_derivedDataCache;
 
     // Caches for loaded assets and in-flight promises
     mutable std::mutex m_cacheMutex;
     std::unordered_map<AssetHandle, std::shared_future<std::shared_ptr<void>>, AssetHandleHash> m_assetCache;
 
+    // Waiters on loads in progress; guards state changes to a settled state
+    std::mutex m_completionMutex;
+    std::unordered_map<AssetHandle, std::vector<std::function<void()>>, AssetHandleHash> m_completionCallbacks;
+
+    // Memory budgets and eviction, indexed by AssetHandle::Type
+    static constexpr size_t ASSET_TYPE_COUNT = static_cast<size_t>(AssetHandle::Type::Unknown) + 1;
+    // Time between eviction passes in Update
+    static constexpr std::chrono::milliseconds EVICTION_INTERVAL{1000};
+    // Assets used more recently than this are never evicted, so data asked
+    // for every frame (or just loaded) does not bounce between loads
+    static constexpr uint64_t MIN_EVICTION_AGE_MS = 5000;
+    mutable std::mutex m_memoryMutex;
+    std::array<AssetMemoryStats, ASSET_TYPE_COUNT> m_memoryStats{};
+    std::chrono::steady_clock::time_point m_lastEviction;
+
+    // Hot reload
+    std::unique_ptr<FileWatcher> m_fileWatcher;
+    std::mutex m_reloadMutex;
+    std::vector<AssetHandle> m_reloadedAssets; // Swapped in, listeners not run yet
+    std::unordered_set<AssetHandle, AssetHandleHash> m_dirtyAssets; // Changed while a load was pending
+    std::unordered_map<uint64_t, ReloadListener> m_reloadListeners;
+    uint64_t m_nextReloadListenerId = 1;
+    // Dependency -> assets that depend on it
+    std::unordered_map<AssetHandle, std::vector<AssetHandle>, AssetHandleHash> m_dependents;
+
+    // Packed archives, searched last mounted first
+    mutable std::mutex m_archiveMutex;
+    std::vector<std::shared_ptr<AssetArchive>> m_archives;
+    std::unordered_set<std::string> m_looseOverrides; // Archive paths changed on disk since packing
+
     // Importer registration
     std::unordered_map<AssetHandle::Type, std::unique_ptr<IAssetImporter>> m_importers;
 };
@@ -110,7 +266,7 @@ private:
 // Template Implementations
 
 template<typename T>
-std::shared_ptr<T> AssetManager::GetAsset(const AssetHandle& handle) {
+std::shared_ptr<T> AssetManager::GetAsset(const AssetHandle& handle, AssetLoadPriority priority) {
     if (!handle.IsValid()) {
         return nullptr;
     }
@@ -122,15 +278,18 @@ std::shared_ptr<T> AssetManager::GetAsset(const AssetHandle& handle) {
     }
 
     // If asset is not loaded, not queued, and not currently loading, start the loading process.
-    AssetLoadState currentState = metadata->state.load();
+    AssetLoadState currentState = metadata->state.load(std::memory_order_acquire);
     if (currentState == AssetLoadState::NotLoaded || currentState == AssetLoadState::Unloaded) {
-        LoadAssetAsync(handle);
+        LoadAssetAsync(handle, priority);
         // Return nullptr for now, the asset will be available in a future frame.
         return nullptr;
     }
 
     // If the asset is still in the process of loading, return nullptr.
     if (currentState == AssetLoadState::Queued || currentState == AssetLoadState::Loading) {
+        if (currentState == AssetLoadState::Queued && m_loadScheduler) {
+            m_loadScheduler->Raise(handle, priority);
+        }
         return nullptr;
     }
 
@@ -139,30 +298,16 @@ std::shared_ptr<T> AssetManager::GetAsset(const AssetHandle& handle) {
         return nullptr;
     }
 
-    // At this point, the asset should be in the cache.
-    std::shared_future<std::shared_ptr<void>> future;
-    {
-        std::lock_guard<std::mutex> lock(m_cacheMutex);
-        auto it = m_assetCache.find(handle);
-        if (it == m_assetCache.end()) {
-            // This can happen if the asset was just loaded but the cache hasn't been populated yet for this thread.
-            // Or it indicates a logic error.
-            Logger::Warning("AssetManager", "Asset {} is marked as loaded but not found in cache. It might become available next frame.", handle.GetID());
-            return nullptr;
-        }
-        future = it->second;
-    }
-
-    // The future should be ready. A wait of 0 seconds is a non-blocking check.
-    if (future.valid() && future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
-        std::shared_ptr<void> assetData = future.get();
-        if (assetData) {
-            m_registry.UpdateLastAccessTime(handle);
-            return std::static_pointer_cast<T>(assetData);
-        }
+    // FinishLoad publishes the data before the state, so the acquire above
+    // makes it visible here without touching the cache mutex
+    std::shared_ptr<void> assetData = metadata->data.load(std::memory_order_acquire);
+    if (!assetData) {
+        // Unloaded between the state check and here
+        return nullptr;
     }
 
-    return nullptr; // Should not be reached in normal operation if state is Loaded.
+    m_registry.UpdateLastAccessTime(handle);
+    return std::static_pointer_cast<T>(assetData);
 }
 
 template<typename T>
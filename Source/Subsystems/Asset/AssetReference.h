@@ -0,0 +1,62 @@
+#pragma once
+
+#include "AssetManager.h"
+#include <utility>
+
+namespace AstralEngine {
+
+/**
+ * @brief Bir asset'i sabitleyen (pin) referans.
+ *
+ * Referans yaşadığı sürece asset, türünün bellek bütçesi aşılsa bile
+ * tahliye edilmez. Sahneler ve editör pencereleri uzun süre ihtiyaç
+ * duydukları asset'leri bununla tutar. Her kopya kendi pin'ini sayar;
+ * AssetManager referanslardan uzun yaşamalıdır.
+ */
+class AssetReference {
+public:
+    AssetReference() = default;
+
+    AssetReference(AssetManager* manager, const AssetHandle& handle)
+        : m_manager(handle.IsValid() ? manager : nullptr), m_handle(handle) {
+        if (m_manager) {
+            m_manager->Pin(m_handle);
+        }
+    }
+
+    AssetReference(const AssetReference& other) : AssetReference(other.m_manager, other.m_handle) {}
+
+    AssetReference(AssetReference&& other) noexcept
+        : m_manager(std::exchange(other.m_manager, nullptr)), m_handle(std::move(other.m_handle)) {}
+
+    AssetReference& operator=(AssetReference other) noexcept {
+        std::swap(m_manager, other.m_manager);
+        std::swap(m_handle, other.m_handle);
+        return *this;
+    }
+
+    ~AssetReference() { Reset(); }
+
+    void Reset() {
+        if (m_manager) {
+            m_manager->Unpin(m_handle);
+            m_manager = nullptr;
+        }
+        m_handle = AssetHandle();
+    }
+
+    // Same as AssetManager::GetAsset; null while the asset is loading
+    template<typename T>
+    std::shared_ptr<T> Get(AssetLoadPriority priority = AssetLoadPriority::Visible) const {
+        return m_manager ? m_manager->GetAsset<T>(m_handle, priority) : nullptr;
+    }
+
+    const AssetHandle& GetHandle() const { return m_handle; }
+    bool IsValid() const { return m_manager != nullptr; }
+
+private:
+    AssetManager* m_manager = nullptr;
+    AssetHandle m_handle;
+};
+
+} // namespace AstralEngine
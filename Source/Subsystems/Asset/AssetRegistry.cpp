@@ -5,12 +5,41 @@
 
 namespace AstralEngine {
 
+namespace {
+
+const char* GetStateName(AssetLoadState state) {
+    switch (state) {
+        case AssetLoadState::NotLoaded: return "NotLoaded";
+        case AssetLoadState::Queued: return "Queued";
+        case AssetLoadState::Loading: return "Loading";
+        case AssetLoadState::Loaded_CPU: return "Loaded_CPU";
+        case AssetLoadState::Loaded: return "Loaded";
+        case AssetLoadState::Failed: return "Failed";
+        case AssetLoadState::Unloaded: return "Unloaded";
+    }
+    return "Unknown";
+}
+
+uint64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+AssetRegistry::Index::Index(size_t capacity)
+    : mask(capacity - 1), slots(new std::atomic<AssetMetadata*>[capacity]) {
+    for (size_t i = 0; i < capacity; ++i) {
+        slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
 AssetRegistry::AssetRegistry() {
     Logger::Debug("AssetRegistry", "AssetRegistry created");
 }
 
 AssetRegistry::~AssetRegistry() {
-    Logger::Info("AssetRegistry", "AssetRegistry destroyed. Total assets: {}", m_registry.size());
+    Logger::Info("AssetRegistry", "AssetRegistry destroyed. Total assets: {}", GetTotalAssetCount());
 }
 
 bool AssetRegistry::RegisterAsset(const AssetHandle& handle, const std::string& filePath, AssetHandle::Type type) {
@@ -19,24 +48,35 @@ bool AssetRegistry::RegisterAsset(const AssetHandle& handle, const std::string&
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(m_mutex);
-    
-    // Asset zaten kayıtlı mı kontrol et
-    if (m_registry.find(handle) != m_registry.end()) {
-        Logger::Warning("AssetRegistry", "Asset already registered: {}", filePath);
+    // Already registered is the common case (every dependency lookup asks again)
+    if (Find(handle)) {
         return false;
     }
-    
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // An unregistered entry is revived in place; readers may still hold it
+    if (AssetMetadata* entry = FindEntry(handle)) {
+        if (entry->registered.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        entry->state.store(AssetLoadState::NotLoaded, std::memory_order_relaxed);
+        entry->data.store(nullptr);
+        entry->lastAccessTime.store(NowMs(), std::memory_order_relaxed);
+        entry->registered.store(true, std::memory_order_release);
+        Logger::Debug("AssetRegistry", "Asset re-registered: {} (ID: {})", filePath, handle.GetID());
+        return true;
+    }
+
     // Yeni metadata oluştur
-    AssetMetadata metadata;
-    metadata.handle = handle;
-    metadata.filePath = filePath;
-    metadata.type = type;
-    metadata.state = AssetLoadState::NotLoaded;
-    metadata.lastAccessTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::system_clock::now().time_since_epoch()).count();
-    
-    m_registry[handle] = std::move(metadata);
+    auto metadata = std::make_unique<AssetMetadata>();
+    metadata->handle = handle;
+    metadata->filePath = filePath;
+    metadata->type = type;
+    metadata->lastAccessTime.store(NowMs(), std::memory_order_relaxed);
+
+    Insert(metadata.get());
+    m_entries.push_back(std::move(metadata));
     
     Logger::Debug("AssetRegistry", "Asset registered: {} (ID: {})", filePath, handle.GetID());
     return true;
@@ -45,67 +85,67 @@ bool AssetRegistry::RegisterAsset(const AssetHandle& handle, const std::string&
 bool AssetRegistry::UnregisterAsset(const AssetHandle& handle) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    auto it = m_registry.find(handle);
-    if (it == m_registry.end()) {
+    AssetMetadata* metadata = Find(handle);
+    if (!metadata) {
         Logger::Warning("AssetRegistry", "Asset not found for unregistration: {}", handle.GetID());
         return false;
     }
     
-    Logger::Debug("AssetRegistry", "Asset unregistered: {}", it->second.filePath);
-    m_registry.erase(it);
+    Logger::Debug("AssetRegistry", "Asset unregistered: {}", metadata->filePath);
+    metadata->registered.store(false, std::memory_order_release);
+    metadata->data.store(nullptr);
     return true;
 }
 
 bool AssetRegistry::IsAssetRegistered(const AssetHandle& handle) const {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return m_registry.find(handle) != m_registry.end();
+    return Find(handle) != nullptr;
+}
+
+std::string AssetRegistry::GetAssetPath(const AssetHandle& handle) const {
+    // filePath is set before the entry is published and never changes
+    const AssetMetadata* metadata = Find(handle);
+    return metadata ? metadata->filePath : std::string();
 }
 
 AssetMetadata* AssetRegistry::GetMetadata(const AssetHandle& handle) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return GetMetadataInternal(handle);
+    return Find(handle);
 }
 
 const AssetMetadata* AssetRegistry::GetMetadata(const AssetHandle& handle) const {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return GetMetadataInternal(handle);
+    return Find(handle);
 }
 
 bool AssetRegistry::SetAssetState(const AssetHandle& handle, AssetLoadState state) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    
-    AssetMetadata* metadata = GetMetadataInternal(handle);
+    AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         Logger::Error("AssetRegistry", "Cannot set state for unregistered asset: {}", handle.GetID());
         return false;
     }
     
-    AssetLoadState oldState = metadata->state.load(std::memory_order_relaxed);
-    metadata->state.store(state, std::memory_order_relaxed);
+    // Release: whatever was published before (e.g. data) is visible to
+    // readers that see the new state
+    AssetLoadState oldState = metadata->state.exchange(state, std::memory_order_acq_rel);
     
     // State değişimini logla
-    const char* stateNames[] = {"NotLoaded", "Queued", "Loading", "Loaded", "Failed", "Unloaded"};
     Logger::Debug("AssetRegistry", "Asset {} state changed: {} -> {}", 
-                 metadata->filePath, stateNames[static_cast<int>(oldState)], stateNames[static_cast<int>(state)]);
+                 metadata->filePath, GetStateName(oldState), GetStateName(state));
     
     return true;
 }
 
 AssetLoadState AssetRegistry::GetAssetState(const AssetHandle& handle) const {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    
-    const AssetMetadata* metadata = GetMetadataInternal(handle);
+    const AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return AssetLoadState::NotLoaded;
     }
     
-    return metadata->state.load(std::memory_order_relaxed);
+    return metadata->state.load(std::memory_order_acquire);
 }
 
 bool AssetRegistry::SetLoadProgress(const AssetHandle& handle, float progress) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    AssetMetadata* metadata = GetMetadataInternal(handle);
+    AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return false;
     }
@@ -117,7 +157,7 @@ bool AssetRegistry::SetLoadProgress(const AssetHandle& handle, float progress) {
 float AssetRegistry::GetLoadProgress(const AssetHandle& handle) const {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    const AssetMetadata* metadata = GetMetadataInternal(handle);
+    const AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return 0.0f;
     }
@@ -128,7 +168,7 @@ float AssetRegistry::GetLoadProgress(const AssetHandle& handle) const {
 uint32_t AssetRegistry::IncrementRefCount(const AssetHandle& handle) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    AssetMetadata* metadata = GetMetadataInternal(handle);
+    AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return 0;
     }
@@ -139,7 +179,7 @@ uint32_t AssetRegistry::IncrementRefCount(const AssetHandle& handle) {
 uint32_t AssetRegistry::DecrementRefCount(const AssetHandle& handle) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    AssetMetadata* metadata = GetMetadataInternal(handle);
+    AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return 0;
     }
@@ -154,7 +194,7 @@ uint32_t AssetRegistry::DecrementRefCount(const AssetHandle& handle) {
 uint32_t AssetRegistry::GetRefCount(const AssetHandle& handle) const {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    const AssetMetadata* metadata = GetMetadataInternal(handle);
+    const AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return 0;
     }
@@ -165,7 +205,7 @@ uint32_t AssetRegistry::GetRefCount(const AssetHandle& handle) const {
 bool AssetRegistry::SetAssetError(const AssetHandle& handle, const std::string& error) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    AssetMetadata* metadata = GetMetadataInternal(handle);
+    AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return false;
     }
@@ -180,7 +220,7 @@ bool AssetRegistry::SetAssetError(const AssetHandle& handle, const std::string&
 std::string AssetRegistry::GetAssetError(const AssetHandle& handle) const {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    const AssetMetadata* metadata = GetMetadataInternal(handle);
+    const AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return "";
     }
@@ -191,7 +231,7 @@ std::string AssetRegistry::GetAssetError(const AssetHandle& handle) const {
 bool AssetRegistry::SetMemorySize(const AssetHandle& handle, size_t size) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    AssetMetadata* metadata = GetMetadataInternal(handle);
+    AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return false;
     }
@@ -203,7 +243,7 @@ bool AssetRegistry::SetMemorySize(const AssetHandle& handle, size_t size) {
 size_t AssetRegistry::GetMemorySize(const AssetHandle& handle) const {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    const AssetMetadata* metadata = GetMetadataInternal(handle);
+    const AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return 0;
     }
@@ -214,7 +254,7 @@ size_t AssetRegistry::GetMemorySize(const AssetHandle& handle) const {
 bool AssetRegistry::SetLoadTime(const AssetHandle& handle, double timeMs) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    AssetMetadata* metadata = GetMetadataInternal(handle);
+    AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return false;
     }
@@ -226,7 +266,7 @@ bool AssetRegistry::SetLoadTime(const AssetHandle& handle, double timeMs) {
 double AssetRegistry::GetLoadTime(const AssetHandle& handle) const {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    const AssetMetadata* metadata = GetMetadataInternal(handle);
+    const AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return 0.0;
     }
@@ -235,36 +275,36 @@ double AssetRegistry::GetLoadTime(const AssetHandle& handle) const {
 }
 
 bool AssetRegistry::UpdateLastAccessTime(const AssetHandle& handle) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    
-    AssetMetadata* metadata = GetMetadataInternal(handle);
+    AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return false;
     }
     
-    metadata->lastAccessTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::system_clock::now().time_since_epoch()).count();
+    // Many threads touch the same hot assets; skip the store (and the cache
+    // line bouncing it causes) while the millisecond has not changed
+    uint64_t now = NowMs();
+    if (metadata->lastAccessTime.load(std::memory_order_relaxed) != now) {
+        metadata->lastAccessTime.store(now, std::memory_order_relaxed);
+    }
     return true;
 }
 
 uint64_t AssetRegistry::GetLastAccessTime(const AssetHandle& handle) const {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    
-    const AssetMetadata* metadata = GetMetadataInternal(handle);
+    const AssetMetadata* metadata = Find(handle);
     if (!metadata) {
         return 0;
     }
     
-    return metadata->lastAccessTime;
+    return metadata->lastAccessTime.load(std::memory_order_relaxed);
 }
 
 std::vector<AssetHandle> AssetRegistry::GetAssetsByState(AssetLoadState state) const {
     std::lock_guard<std::mutex> lock(m_mutex);
     
     std::vector<AssetHandle> result;
-    for (const auto& pair : m_registry) {
-        if (pair.second.state == state) {
-            result.push_back(pair.first);
+    for (const auto& entry : m_entries) {
+        if (entry->registered && entry->state == state) {
+            result.push_back(entry->handle);
         }
     }
     
@@ -275,9 +315,9 @@ std::vector<AssetHandle> AssetRegistry::GetAssetsByType(AssetHandle::Type type)
     std::lock_guard<std::mutex> lock(m_mutex);
     
     std::vector<AssetHandle> result;
-    for (const auto& pair : m_registry) {
-        if (pair.second.type == type) {
-            result.push_back(pair.first);
+    for (const auto& entry : m_entries) {
+        if (entry->registered && entry->type == type) {
+            result.push_back(entry->handle);
         }
     }
     
@@ -286,15 +326,16 @@ std::vector<AssetHandle> AssetRegistry::GetAssetsByType(AssetHandle::Type type)
 
 size_t AssetRegistry::GetTotalAssetCount() const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    return m_registry.size();
+    return std::count_if(m_entries.begin(), m_entries.end(),
+                         [](const auto& entry) { return entry->registered.load(); });
 }
 
 size_t AssetRegistry::GetAssetCountByState(AssetLoadState state) const {
     std::lock_guard<std::mutex> lock(m_mutex);
     
     size_t count = 0;
-    for (const auto& pair : m_registry) {
-        if (pair.second.state == state) {
+    for (const auto& entry : m_entries) {
+        if (entry->registered && entry->state == state) {
             count++;
         }
     }
@@ -306,8 +347,23 @@ size_t AssetRegistry::GetTotalMemoryUsage() const {
     std::lock_guard<std::mutex> lock(m_mutex);
     
     size_t totalMemory = 0;
-    for (const auto& pair : m_registry) {
-        totalMemory += pair.second.memorySize;
+    for (const auto& entry : m_entries) {
+        if (entry->registered) {
+            totalMemory += entry->memorySize;
+        }
+    }
+    
+    return totalMemory;
+}
+
+size_t AssetRegistry::GetMemoryUsageByType(AssetHandle::Type type) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    size_t totalMemory = 0;
+    for (const auto& entry : m_entries) {
+        if (entry->registered && entry->type == type) {
+            totalMemory += entry->memorySize;
+        }
     }
     
     return totalMemory;
@@ -316,14 +372,13 @@ size_t AssetRegistry::GetTotalMemoryUsage() const {
 std::vector<AssetHandle> AssetRegistry::GetUnusedAssets(uint64_t olderThanMs) const {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    uint64_t currentTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t currentTime = NowMs();
     
     std::vector<AssetHandle> result;
-    for (const auto& pair : m_registry) {
-        if (pair.second.refCount == 0 && 
-            (currentTime - pair.second.lastAccessTime) > olderThanMs) {
-            result.push_back(pair.first);
+    for (const auto& entry : m_entries) {
+        if (entry->registered && entry->refCount == 0 &&
+            (currentTime - entry->lastAccessTime.load(std::memory_order_relaxed)) > olderThanMs) {
+            result.push_back(entry->handle);
         }
     }
     
@@ -333,32 +388,81 @@ std::vector<AssetHandle> AssetRegistry::GetUnusedAssets(uint64_t olderThanMs) co
 void AssetRegistry::ClearAll() {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    Logger::Info("AssetRegistry", "Clearing all asset registrations. Count: {}", m_registry.size());
-    m_registry.clear();
+    // Frees every entry; callers must make sure no lookups are in flight
+    Logger::Info("AssetRegistry", "Clearing all asset registrations. Count: {}", m_entries.size());
+    m_index.store(nullptr, std::memory_order_release);
+    m_indexes.clear();
+    m_entries.clear();
 }
 
 std::vector<AssetHandle> AssetRegistry::GetAllAssets() const {
     std::lock_guard<std::mutex> lock(m_mutex);
     
     std::vector<AssetHandle> result;
-    result.reserve(m_registry.size());
+    result.reserve(m_entries.size());
     
-    for (const auto& pair : m_registry) {
-        result.push_back(pair.first);
+    for (const auto& entry : m_entries) {
+        if (entry->registered) {
+            result.push_back(entry->handle);
+        }
     }
     
     return result;
 }
 
 // Private helper functions
-AssetMetadata* AssetRegistry::GetMetadataInternal(const AssetHandle& handle) {
-    auto it = m_registry.find(handle);
-    return (it != m_registry.end()) ? &it->second : nullptr;
+AssetMetadata* AssetRegistry::Find(const AssetHandle& handle) const {
+    AssetMetadata* metadata = FindEntry(handle);
+    if (metadata && metadata->registered.load(std::memory_order_acquire)) {
+        return metadata;
+    }
+    return nullptr;
 }
 
-const AssetMetadata* AssetRegistry::GetMetadataInternal(const AssetHandle& handle) const {
-    auto it = m_registry.find(handle);
-    return (it != m_registry.end()) ? &it->second : nullptr;
+AssetMetadata* AssetRegistry::FindEntry(const AssetHandle& handle) const {
+    const Index* index = m_index.load(std::memory_order_acquire);
+    if (!index) {
+        return nullptr;
+    }
+
+    // Every entry ever registered has a slot, so this sees unregistered ones too
+    for (size_t slot = handle.GetHash() & index->mask;; slot = (slot + 1) & index->mask) {
+        AssetMetadata* metadata = index->slots[slot].load(std::memory_order_acquire);
+        if (!metadata) {
+            return nullptr;
+        }
+        if (metadata->handle == handle) {
+            return metadata;
+        }
+    }
+}
+
+void AssetRegistry::Insert(AssetMetadata* metadata) {
+    Index* index = m_index.load(std::memory_order_relaxed);
+
+    // Keep the load factor at or below one half so probes stay short and
+    // always reach an empty slot. Growing publishes a new table; readers
+    // still probing the old one finish there safely.
+    size_t capacity = index ? index->mask + 1 : 0;
+    if ((m_entries.size() + 1) * 2 > capacity) {
+        auto grown = std::make_unique<Index>(std::max(INITIAL_CAPACITY, capacity * 2));
+        for (const auto& entry : m_entries) {
+            size_t slot = entry->handle.GetHash() & grown->mask;
+            while (grown->slots[slot].load(std::memory_order_relaxed)) {
+                slot = (slot + 1) & grown->mask;
+            }
+            grown->slots[slot].store(entry.get(), std::memory_order_relaxed);
+        }
+        index = grown.get();
+        m_indexes.push_back(std::move(grown));
+    }
+
+    size_t slot = metadata->handle.GetHash() & index->mask;
+    while (index->slots[slot].load(std::memory_order_relaxed)) {
+        slot = (slot + 1) & index->mask;
+    }
+    index->slots[slot].store(metadata, std::memory_order_release);
+    m_index.store(index, std::memory_order_release);
 }
 
 } // namespace AstralEngine
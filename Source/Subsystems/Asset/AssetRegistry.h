@@ -25,6 +25,11 @@ enum class AssetLoadState {
 
 /**
  * @brief Asset metadata bilgileri
+ *
+ * state, lastAccessTime, data ve registered kilitsiz okunur/yazılır; diğer
+ * alanlar registry mutex'i altında değişir. Kayıt silinse bile nesne
+ * ClearAll'a kadar yaşar, böylece kilitsiz okuyucular serbest bırakılmış
+ * belleğe erişmez.
  */
 struct AssetMetadata {
     AssetHandle handle;
@@ -38,7 +43,12 @@ struct AssetMetadata {
     
     // Performance metrics
     double loadTimeMs;
-    uint64_t lastAccessTime;
+    std::atomic<uint64_t> lastAccessTime;
+
+    // Loaded CPU data; published before state becomes Loaded_CPU
+    std::atomic<std::shared_ptr<void>> data;
+    // False once unregistered; lookups then skip the entry
+    std::atomic<bool> registered;
     
     AssetMetadata() 
         : state(AssetLoadState::NotLoaded)
@@ -46,41 +56,11 @@ struct AssetMetadata {
         , refCount(0)
         , loadProgress(0.0f)
         , loadTimeMs(0.0)
-        , lastAccessTime(0) {
-    }
-    
-    // Move constructor
-    AssetMetadata(AssetMetadata&& other) noexcept
-        : handle(std::move(other.handle))
-        , filePath(std::move(other.filePath))
-        , type(other.type)
-        , state(other.state.load(std::memory_order_relaxed))
-        , memorySize(other.memorySize)
-        , refCount(other.refCount)
-        , lastError(std::move(other.lastError))
-        , loadProgress(other.loadProgress)
-        , loadTimeMs(other.loadTimeMs)
-        , lastAccessTime(other.lastAccessTime) {
-    }
-    
-    // Move assignment operator
-    AssetMetadata& operator=(AssetMetadata&& other) noexcept {
-        if (this != &other) {
-            handle = std::move(other.handle);
-            filePath = std::move(other.filePath);
-            type = other.type;
-            state.store(other.state.load(std::memory_order_relaxed), std::memory_order_relaxed);
-            memorySize = other.memorySize;
-            refCount = other.refCount;
-            lastError = std::move(other.lastError);
-            loadProgress = other.loadProgress;
-            loadTimeMs = other.loadTimeMs;
-            lastAccessTime = other.lastAccessTime;
-        }
-        return *this;
+        , lastAccessTime(0)
+        , registered(true) {
     }
     
-    // Non-copyable
+    // Shared by address with lock-free readers
     AssetMetadata(const AssetMetadata&) = delete;
     AssetMetadata& operator=(const AssetMetadata&) = delete;
 };
@@ -89,7 +69,11 @@ struct AssetMetadata {
  * @brief Tüm asset'lerin kayıtını tutan registry
  * 
  * Asset metadata, yükleme durumları ve referans sayılarını yönetir.
- * Thread-safe tasarım.
+ * Thread-safe tasarım. Render döngüsünün her frame yaptığı aramalar
+ * (GetMetadata, durum, erişim zamanı) kilit almaz: handle'lar açık adresli
+ * bir tabloda tutulur, yazıcılar yalnızca boş slotları doldurur ve tablo
+ * büyürken yenisi kopyalanıp atomik olarak yayınlanır (RCU benzeri). Eski
+ * tablolar ClearAll'a kadar tutulur.
  */
 class AssetRegistry {
 public:
@@ -104,6 +88,8 @@ public:
     bool RegisterAsset(const AssetHandle& handle, const std::string& filePath, AssetHandle::Type type);
     bool UnregisterAsset(const AssetHandle& handle);
     bool IsAssetRegistered(const AssetHandle& handle) const;
+    // Handle'lar yol tutmaz; yol kayıttan okunur (boşsa kayıtlı değil)
+    std::string GetAssetPath(const AssetHandle& handle) const;
 
     // Metadata erişimi
     AssetMetadata* GetMetadata(const AssetHandle& handle);
@@ -142,6 +128,7 @@ public:
     size_t GetTotalAssetCount() const;
     size_t GetAssetCountByState(AssetLoadState state) const;
     size_t GetTotalMemoryUsage() const;
+    size_t GetMemoryUsageByType(AssetHandle::Type type) const;
     
     // Cleanup operations
     std::vector<AssetHandle> GetUnusedAssets(uint64_t olderThanMs = 0) const;
@@ -151,12 +138,28 @@ public:
     std::vector<AssetHandle> GetAllAssets() const;
 
 private:
+    // Open-addressing table of metadata pointers, probed linearly. Slots go
+    // from null to a pointer once and never change after that.
+    struct Index {
+        explicit Index(size_t capacity);
+        size_t mask;
+        std::unique_ptr<std::atomic<AssetMetadata*>[]> slots;
+    };
+
+    static constexpr size_t INITIAL_CAPACITY = 256;
+
+    // Serializes writers; readers go through m_index only
     mutable std::mutex m_mutex;
-    std::unordered_map<AssetHandle, AssetMetadata, AssetHandleHash> m_registry;
+    std::atomic<Index*> m_index{nullptr};
+    std::vector<std::unique_ptr<Index>> m_indexes; // Current one last; older ones may still be read
+    std::vector<std::unique_ptr<AssetMetadata>> m_entries;
     
-    // Helper functions
-    AssetMetadata* GetMetadataInternal(const AssetHandle& handle);
-    const AssetMetadata* GetMetadataInternal(const AssetHandle& handle) const;
+    // Lock-free lookup; null if missing or unregistered
+    AssetMetadata* Find(const AssetHandle& handle) const;
+    // Same probe, but also returns unregistered entries
+    AssetMetadata* FindEntry(const AssetHandle& handle) const;
+    // Call with m_mutex held
+    void Insert(AssetMetadata* metadata);
 };
 
 } // namespace AstralEngine
@@ -0,0 +1,522 @@
+#include "BlockCompressor.h"
+#include "../../Core/ThreadPool.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace AstralEngine {
+
+	namespace {
+
+		constexpr int BC7_WEIGHTS4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		// Little-endian bit packer for 128-bit blocks
+		class BitWriter {
+		public:
+			explicit BitWriter(uint8_t* out) : m_out(out) { std::memset(m_out, 0, 16); }
+
+			void Write(uint32_t value, uint32_t bits) {
+				for (uint32_t i = 0; i < bits; ++i, ++m_position) {
+					if (value & (1u << i)) {
+						m_out[m_position >> 3] |= static_cast<uint8_t>(1u << (m_position & 7));
+					}
+				}
+			}
+
+		private:
+			uint8_t* m_out;
+			uint32_t m_position = 0;
+		};
+
+		// Principal axis of N-dimensional points by power iteration on the covariance
+		template <int D>
+		void PrincipalAxis(const float (*points)[D], int count, float* mean, float* axis) {
+			for (int c = 0; c < D; ++c) {
+				mean[c] = 0.0f;
+				for (int i = 0; i < count; ++i) mean[c] += points[i][c];
+				mean[c] /= static_cast<float>(count);
+			}
+
+			float covariance[D][D] = {};
+			for (int i = 0; i < count; ++i) {
+				for (int a = 0; a < D; ++a) {
+					for (int b = a; b < D; ++b) {
+						covariance[a][b] += (points[i][a] - mean[a]) * (points[i][b] - mean[b]);
+					}
+				}
+			}
+			for (int a = 0; a < D; ++a) {
+				for (int b = 0; b < a; ++b) covariance[a][b] = covariance[b][a];
+			}
+
+			// Start from the widest channel so the iteration never starts orthogonal
+			int widest = 0;
+			for (int c = 1; c < D; ++c) {
+				if (covariance[c][c] > covariance[widest][widest]) widest = c;
+			}
+			for (int c = 0; c < D; ++c) axis[c] = covariance[widest][c];
+
+			for (int iteration = 0; iteration < 8; ++iteration) {
+				float next[D] = {};
+				float length = 0.0f;
+				for (int a = 0; a < D; ++a) {
+					for (int b = 0; b < D; ++b) next[a] += covariance[a][b] * axis[b];
+					length = std::max(length, std::abs(next[a]));
+				}
+				if (length <= 0.0f) break;
+				for (int c = 0; c < D; ++c) axis[c] = next[c] / length;
+			}
+
+			float length = 0.0f;
+			for (int c = 0; c < D; ++c) length += axis[c] * axis[c];
+			length = std::sqrt(length);
+			for (int c = 0; c < D; ++c) axis[c] = length > 0.0f ? axis[c] / length : 0.0f;
+		}
+
+		// Endpoints spanning the points' extent along the principal axis
+		template <int D>
+		void FitEndpoints(const float (*points)[D], int count, float* e0, float* e1) {
+			float mean[D], axis[D];
+			PrincipalAxis<D>(points, count, mean, axis);
+			float minT = 0.0f, maxT = 0.0f;
+			for (int i = 0; i < count; ++i) {
+				float t = 0.0f;
+				for (int c = 0; c < D; ++c) t += (points[i][c] - mean[c]) * axis[c];
+				minT = std::min(minT, t);
+				maxT = std::max(maxT, t);
+			}
+			for (int c = 0; c < D; ++c) {
+				e0[c] = mean[c] + axis[c] * minT;
+				e1[c] = mean[c] + axis[c] * maxT;
+			}
+		}
+
+		// Least-squares endpoints for points interpolated with the given weights
+		// (0 = e0, 1 = e1). Returns false if the system is singular.
+		template <int D>
+		bool RefineEndpoints(const float (*points)[D], const float* weights, int count, float* e0, float* e1) {
+			float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+			float ax[D] = {}, bx[D] = {};
+			for (int i = 0; i < count; ++i) {
+				float b = weights[i];
+				float a = 1.0f - b;
+				aa += a * a;
+				ab += a * b;
+				bb += b * b;
+				for (int c = 0; c < D; ++c) {
+					ax[c] += a * points[i][c];
+					bx[c] += b * points[i][c];
+				}
+			}
+			float determinant = aa * bb - ab * ab;
+			if (std::abs(determinant) < 1e-6f) {
+				return false;
+			}
+			float inverse = 1.0f / determinant;
+			for (int c = 0; c < D; ++c) {
+				e0[c] = (ax[c] * bb - bx[c] * ab) * inverse;
+				e1[c] = (bx[c] * aa - ax[c] * ab) * inverse;
+			}
+			return true;
+		}
+
+		// --- BC1 color ---
+
+		uint16_t To565(const float* color) {
+			int r = std::clamp(static_cast<int>(std::lround(color[0] * 31.0f / 255.0f)), 0, 31);
+			int g = std::clamp(static_cast<int>(std::lround(color[1] * 63.0f / 255.0f)), 0, 63);
+			int b = std::clamp(static_cast<int>(std::lround(color[2] * 31.0f / 255.0f)), 0, 31);
+			return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+		}
+
+		void From565(uint16_t value, int* color) {
+			int r = (value >> 11) & 31, g = (value >> 5) & 63, b = value & 31;
+			color[0] = (r << 3) | (r >> 2);
+			color[1] = (g << 2) | (g >> 4);
+			color[2] = (b << 3) | (b >> 2);
+		}
+
+		// Nearest four-color palette entry per texel; returns the squared error
+		int AssignColorIndices(const float (*points)[3], uint16_t c0, uint16_t c1, uint8_t* indices) {
+			int palette[4][3];
+			From565(c0, palette[0]);
+			From565(c1, palette[1]);
+			for (int c = 0; c < 3; ++c) {
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+			int total = 0;
+			for (int i = 0; i < 16; ++i) {
+				int best = 0, bestError = INT32_MAX;
+				for (int p = 0; p < 4; ++p) {
+					int error = 0;
+					for (int c = 0; c < 3; ++c) {
+						int d = static_cast<int>(points[i][c]) - palette[p][c];
+						error += d * d;
+					}
+					if (error < bestError) {
+						bestError = error;
+						best = p;
+					}
+				}
+				indices[i] = static_cast<uint8_t>(best);
+				total += bestError;
+			}
+			return total;
+		}
+
+		void EncodeColorBlock(const uint8_t* rgba, uint8_t* out) {
+			float points[16][3];
+			for (int i = 0; i < 16; ++i) {
+				for (int c = 0; c < 3; ++c) points[i][c] = rgba[i * 4 + c];
+			}
+
+			float e0[3], e1[3];
+			FitEndpoints<3>(points, 16, e0, e1);
+			uint16_t c0 = To565(e1), c1 = To565(e0);
+			uint8_t indices[16];
+			int error = AssignColorIndices(points, c0, c1, indices);
+
+			// One least-squares pass over the chosen indices
+			static constexpr float INDEX_WEIGHTS[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+			float weights[16];
+			for (int i = 0; i < 16; ++i) weights[i] = INDEX_WEIGHTS[indices[i]];
+			if (error > 0 && RefineEndpoints<3>(points, weights, 16, e0, e1)) {
+				uint16_t r0 = To565(e0), r1 = To565(e1);
+				uint8_t refined[16];
+				int refinedError = AssignColorIndices(points, r0, r1, refined);
+				if (refinedError < error) {
+					c0 = r0;
+					c1 = r1;
+					std::memcpy(indices, refined, sizeof(indices));
+				}
+			}
+
+			// c0 > c1 selects the four-color mode; swapping maps 0<->1 and 2<->3
+			if (c0 < c1) {
+				std::swap(c0, c1);
+				for (auto& index : indices) index ^= 1;
+			} else if (c0 == c1) {
+				std::memset(indices, 0, sizeof(indices));
+			}
+
+			uint32_t bits = 0;
+			for (int i = 0; i < 16; ++i) bits |= static_cast<uint32_t>(indices[i]) << (i * 2);
+			out[0] = static_cast<uint8_t>(c0);
+			out[1] = static_cast<uint8_t>(c0 >> 8);
+			out[2] = static_cast<uint8_t>(c1);
+			out[3] = static_cast<uint8_t>(c1 >> 8);
+			std::memcpy(out + 4, &bits, 4);
+		}
+
+		// --- BC4 single channel (eight-value mode) ---
+
+		void EncodeBC4(const uint8_t* rgba, int channel, uint8_t* out) {
+			int minValue = 255, maxValue = 0;
+			for (int i = 0; i < 16; ++i) {
+				minValue = std::min<int>(minValue, rgba[i * 4 + channel]);
+				maxValue = std::max<int>(maxValue, rgba[i * 4 + channel]);
+			}
+
+			out[0] = static_cast<uint8_t>(maxValue);
+			out[1] = static_cast<uint8_t>(minValue);
+			uint64_t bits = 0;
+			if (maxValue > minValue) {
+				int palette[8] = { maxValue, minValue };
+				for (int p = 2; p < 8; ++p) palette[p] = ((8 - p) * maxValue + (p - 1) * minValue) / 7;
+				for (int i = 0; i < 16; ++i) {
+					int value = rgba[i * 4 + channel];
+					int best = 0, bestError = INT32_MAX;
+					for (int p = 0; p < 8; ++p) {
+						int error = std::abs(value - palette[p]);
+						if (error < bestError) {
+							bestError = error;
+							best = p;
+						}
+					}
+					bits |= static_cast<uint64_t>(best) << (i * 3);
+				}
+			}
+			for (int b = 0; b < 6; ++b) out[2 + b] = static_cast<uint8_t>(bits >> (b * 8));
+		}
+
+		// --- BC7 mode 6: RGBA 7.7.7.7 endpoints + unique p-bit, 4-bit indices ---
+
+		// Quantizes an endpoint to 7 bits per channel plus the p-bit that fits best
+		void QuantizeBC7Endpoint(const float* color, int* quantized, int& pbit) {
+			float bestError = INFINITY;
+			for (int p = 0; p < 2; ++p) {
+				int candidate[4];
+				float error = 0.0f;
+				for (int c = 0; c < 4; ++c) {
+					candidate[c] = std::clamp(static_cast<int>(std::lround((color[c] - p) * 0.5f)), 0, 127);
+					float d = color[c] - static_cast<float>((candidate[c] << 1) | p);
+					error += d * d;
+				}
+				if (error < bestError) {
+					bestError = error;
+					pbit = p;
+					std::memcpy(quantized, candidate, sizeof(candidate));
+				}
+			}
+		}
+
+		float AssignBC7Indices(const float (*points)[4], const int* q0, int p0, const int* q1, int p1, uint8_t* indices) {
+			int palette[16][4];
+			for (int c = 0; c < 4; ++c) {
+				int a = (q0[c] << 1) | p0, b = (q1[c] << 1) | p1;
+				for (int w = 0; w < 16; ++w) {
+					palette[w][c] = ((64 - BC7_WEIGHTS4[w]) * a + BC7_WEIGHTS4[w] * b + 32) >> 6;
+				}
+			}
+			float total = 0.0f;
+			for (int i = 0; i < 16; ++i) {
+				float bestError = INFINITY;
+				for (int w = 0; w < 16; ++w) {
+					float error = 0.0f;
+					for (int c = 0; c < 4; ++c) {
+						float d = points[i][c] - static_cast<float>(palette[w][c]);
+						error += d * d;
+					}
+					if (error < bestError) {
+						bestError = error;
+						indices[i] = static_cast<uint8_t>(w);
+					}
+				}
+				total += bestError;
+			}
+			return total;
+		}
+
+		// --- BC6H mode 11: unsigned, 10-bit endpoints, 4-bit indices ---
+
+		// Endpoint value (in unquantized 16-bit space) to 10 bits, and back as the decoder does
+		int QuantizeBC6H(float unquantized) {
+			return std::clamp(static_cast<int>(std::lround((unquantized - 32.0f) / 64.0f)), 0, 1023);
+		}
+
+		int UnquantizeBC6H(int value) {
+			if (value == 0) return 0;
+			if (value == 1023) return 0xFFFF;
+			return ((value << 16) + 0x8000) >> 10;
+		}
+
+		float AssignBC6HIndices(const float (*halves)[3], const int* q0, const int* q1, uint8_t* indices) {
+			int palette[16][3];
+			for (int c = 0; c < 3; ++c) {
+				int a = UnquantizeBC6H(q0[c]), b = UnquantizeBC6H(q1[c]);
+				for (int w = 0; w < 16; ++w) {
+					int interpolated = ((64 - BC7_WEIGHTS4[w]) * a + BC7_WEIGHTS4[w] * b + 32) >> 6;
+					palette[w][c] = (interpolated * 31) >> 6; // Final half-float bits
+				}
+			}
+			float total = 0.0f;
+			for (int i = 0; i < 16; ++i) {
+				float bestError = INFINITY;
+				for (int w = 0; w < 16; ++w) {
+					float error = 0.0f;
+					for (int c = 0; c < 3; ++c) {
+						float d = halves[i][c] - static_cast<float>(palette[w][c]);
+						error += d * d;
+					}
+					if (error < bestError) {
+						bestError = error;
+						indices[i] = static_cast<uint8_t>(w);
+					}
+				}
+				total += bestError;
+			}
+			return total;
+		}
+
+	} // namespace
+
+	void BlockCompressor::EncodeBC1(const uint8_t* rgba, uint8_t* out) {
+		EncodeColorBlock(rgba, out);
+	}
+
+	void BlockCompressor::EncodeBC3(const uint8_t* rgba, uint8_t* out) {
+		EncodeBC4(rgba, 3, out);
+		EncodeColorBlock(rgba, out + 8);
+	}
+
+	void BlockCompressor::EncodeBC5(const uint8_t* rgba, uint8_t* out) {
+		EncodeBC4(rgba, 0, out);
+		EncodeBC4(rgba, 1, out + 8);
+	}
+
+	void BlockCompressor::EncodeBC7(const uint8_t* rgba, uint8_t* out) {
+		float points[16][4];
+		for (int i = 0; i < 16; ++i) {
+			for (int c = 0; c < 4; ++c) points[i][c] = rgba[i * 4 + c];
+		}
+
+		float e0[4], e1[4];
+		FitEndpoints<4>(points, 16, e0, e1);
+		int q0[4], q1[4], p0 = 0, p1 = 0;
+		QuantizeBC7Endpoint(e0, q0, p0);
+		QuantizeBC7Endpoint(e1, q1, p1);
+		uint8_t indices[16];
+		float error = AssignBC7Indices(points, q0, p0, q1, p1, indices);
+
+		float weights[16];
+		for (int i = 0; i < 16; ++i) weights[i] = BC7_WEIGHTS4[indices[i]] / 64.0f;
+		if (error > 0.0f && RefineEndpoints<4>(points, weights, 16, e0, e1)) {
+			int r0[4], r1[4], rp0 = 0, rp1 = 0;
+			QuantizeBC7Endpoint(e0, r0, rp0);
+			QuantizeBC7Endpoint(e1, r1, rp1);
+			uint8_t refined[16];
+			if (AssignBC7Indices(points, r0, rp0, r1, rp1, refined) < error) {
+				std::memcpy(q0, r0, sizeof(q0));
+				std::memcpy(q1, r1, sizeof(q1));
+				p0 = rp0;
+				p1 = rp1;
+				std::memcpy(indices, refined, sizeof(indices));
+			}
+		}
+
+		// The first index is stored with 3 bits, so its top bit must be 0
+		if (indices[0] & 8) {
+			std::swap(q0, q1);
+			std::swap(p0, p1);
+			for (auto& index : indices) index = static_cast<uint8_t>(15 - index);
+		}
+
+		BitWriter writer(out);
+		writer.Write(1u << 6, 7); // Mode 6
+		for (int c = 0; c < 4; ++c) {
+			writer.Write(static_cast<uint32_t>(q0[c]), 7);
+			writer.Write(static_cast<uint32_t>(q1[c]), 7);
+		}
+		writer.Write(static_cast<uint32_t>(p0), 1);
+		writer.Write(static_cast<uint32_t>(p1), 1);
+		writer.Write(indices[0], 3);
+		for (int i = 1; i < 16; ++i) writer.Write(indices[i], 4);
+	}
+
+	void BlockCompressor::EncodeBC6H(const float* rgba, uint8_t* out) {
+		// Interpolation happens on half-float bit patterns, so fit in that space
+		float halves[16][3];
+		for (int i = 0; i < 16; ++i) {
+			for (int c = 0; c < 3; ++c) {
+				float value = rgba[i * 4 + c];
+				value = (value > 0.0f) ? std::min(value, 65504.0f) : 0.0f; // Also maps NaN to 0
+				halves[i][c] = static_cast<float>(glm::packHalf1x16(value));
+			}
+		}
+
+		// Endpoints live in the unquantized space, which the decoder scales by 31/64
+		float points[16][3];
+		for (int i = 0; i < 16; ++i) {
+			for (int c = 0; c < 3; ++c) points[i][c] = halves[i][c] * (64.0f / 31.0f);
+		}
+
+		float e0[3], e1[3];
+		FitEndpoints<3>(points, 16, e0, e1);
+		int q0[3], q1[3];
+		for (int c = 0; c < 3; ++c) {
+			q0[c] = QuantizeBC6H(e0[c]);
+			q1[c] = QuantizeBC6H(e1[c]);
+		}
+		uint8_t indices[16];
+		float error = AssignBC6HIndices(halves, q0, q1, indices);
+
+		float weights[16];
+		for (int i = 0; i < 16; ++i) weights[i] = BC7_WEIGHTS4[indices[i]] / 64.0f;
+		if (error > 0.0f && RefineEndpoints<3>(points, weights, 16, e0, e1)) {
+			int r0[3], r1[3];
+			for (int c = 0; c < 3; ++c) {
+				r0[c] = QuantizeBC6H(e0[c]);
+				r1[c] = QuantizeBC6H(e1[c]);
+			}
+			uint8_t refined[16];
+			if (AssignBC6HIndices(halves, r0, r1, refined) < error) {
+				std::memcpy(q0, r0, sizeof(q0));
+				std::memcpy(q1, r1, sizeof(q1));
+				std::memcpy(indices, refined, sizeof(indices));
+			}
+		}
+
+		if (indices[0] & 8) {
+			std::swap(q0, q1);
+			for (auto& index : indices) index = static_cast<uint8_t>(15 - index);
+		}
+
+		BitWriter writer(out);
+		writer.Write(0x03, 5); // Mode 11
+		for (int c = 0; c < 3; ++c) writer.Write(static_cast<uint32_t>(q0[c]), 10);
+		for (int c = 0; c < 3; ++c) writer.Write(static_cast<uint32_t>(q1[c]), 10);
+		writer.Write(indices[0], 3);
+		for (int i = 1; i < 16; ++i) writer.Write(indices[i], 4);
+	}
+
+	uint32_t BlockCompressor::GetBlockSize(TextureCompression compression) {
+		switch (compression) {
+			case TextureCompression::BC1: return 8;
+			case TextureCompression::BC3:
+			case TextureCompression::BC5:
+			case TextureCompression::BC6H:
+			case TextureCompression::BC7: return 16;
+			default: return 0;
+		}
+	}
+
+	size_t BlockCompressor::GetCompressedSize(TextureCompression compression, uint32_t width, uint32_t height) {
+		// 64-bit throughout; width + 3 alone wraps for dimensions near UINT32_MAX
+		return ((static_cast<uint64_t>(width) + 3) / 4) * ((static_cast<uint64_t>(height) + 3) / 4) * GetBlockSize(compression);
+	}
+
+	void BlockCompressor::Compress(TextureCompression compression, const void* pixels, uint32_t width, uint32_t height,
+								   uint8_t* out, ThreadPool* threadPool) {
+		const uint32_t blocksX = (width + 3) / 4;
+		const uint32_t blocksY = (height + 3) / 4;
+		const uint32_t blockSize = GetBlockSize(compression);
+		if (blockSize == 0) {
+			return;
+		}
+
+		auto encodeRow = [&](size_t by) {
+			uint8_t* rowOut = out + by * blocksX * blockSize;
+			for (uint32_t bx = 0; bx < blocksX; ++bx) {
+				uint8_t* blockOut = rowOut + bx * blockSize;
+				if (compression == TextureCompression::BC6H) {
+					float block[16 * 4];
+					const float* source = static_cast<const float*>(pixels);
+					for (uint32_t i = 0; i < 16; ++i) {
+						uint32_t x = std::min(bx * 4 + (i & 3), width - 1);
+						uint32_t y = std::min(static_cast<uint32_t>(by) * 4 + (i >> 2), height - 1);
+						std::memcpy(block + i * 4, source + (static_cast<size_t>(y) * width + x) * 4, sizeof(float) * 4);
+					}
+					EncodeBC6H(block, blockOut);
+					continue;
+				}
+
+				uint8_t block[16 * 4];
+				const uint8_t* source = static_cast<const uint8_t*>(pixels);
+				for (uint32_t i = 0; i < 16; ++i) {
+					uint32_t x = std::min(bx * 4 + (i & 3), width - 1);
+					uint32_t y = std::min(static_cast<uint32_t>(by) * 4 + (i >> 2), height - 1);
+					std::memcpy(block + i * 4, source + (static_cast<size_t>(y) * width + x) * 4, 4);
+				}
+				switch (compression) {
+					case TextureCompression::BC1: EncodeBC1(block, blockOut); break;
+					case TextureCompression::BC3: EncodeBC3(block, blockOut); break;
+					case TextureCompression::BC5: EncodeBC5(block, blockOut); break;
+					default: EncodeBC7(block, blockOut); break;
+				}
+			}
+		};
+
+		if (threadPool && blocksY > 1) {
+			threadPool->ParallelFor(blocksY, encodeRow);
+		} else {
+			for (uint32_t by = 0; by < blocksY; ++by) {
+				encodeRow(by);
+			}
+		}
+	}
+
+} // namespace AstralEngine
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "AssetData.h"
+#include <cstdint>
+
+namespace AstralEngine {
+
+	class ThreadPool;
+
+	/**
+	 * @class BlockCompressor
+	 * @brief CPU BC1/BC3/BC5/BC6H/BC7 blok kodlayıcısı.
+	 *
+	 * Hız/kalite dengesi import zamanına göre seçildi: uç noktalar ana eksen
+	 * (PCA) boyunca bulunur ve bir kez en küçük kareler ile iyileştirilir.
+	 * BC7 yalnızca mode 6 (tek bölge, RGBA), BC6H yalnızca mode 11 (tek
+	 * bölge, 10 bit uç noktalar) kullanır.
+	 */
+	class BlockCompressor {
+	public:
+		// Blocks take 16 texels in row-major order: RGBA8 (4 bytes) or, for
+		// BC6H, RGBA32F (alpha ignored). Output is 8 bytes for BC1, 16 otherwise.
+		static void EncodeBC1(const uint8_t* rgba, uint8_t* out);
+		static void EncodeBC3(const uint8_t* rgba, uint8_t* out);
+		static void EncodeBC5(const uint8_t* rgba, uint8_t* out); // Red and green
+		static void EncodeBC7(const uint8_t* rgba, uint8_t* out);
+		static void EncodeBC6H(const float* rgba, uint8_t* out);  // Unsigned; negatives clamp to 0
+
+		static uint32_t GetBlockSize(TextureCompression compression);
+		static size_t GetCompressedSize(TextureCompression compression, uint32_t width, uint32_t height);
+
+		// Compresses a whole image (RGBA8, or RGBA32F for BC6H); partial edge
+		// blocks repeat the last row/column. Block rows run on the pool if given.
+		static void Compress(TextureCompression compression, const void* pixels, uint32_t width, uint32_t height,
+							 uint8_t* out, ThreadPool* threadPool = nullptr);
+	};
+
+} // namespace AstralEngine
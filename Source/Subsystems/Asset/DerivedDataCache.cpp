@@ -0,0 +1,228 @@
+#include "DerivedDataCache.h"
+#include "../../Core/Hash.h"
+#include "../../Core/Logger.h"
+#include "../../Core/MappedFile.h"
+
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <system_error>
+#include <thread>
+
+namespace AstralEngine {
+
+	namespace {
+
+		constexpr const char* ENTRY_EXTENSION = ".ddc";
+
+	} // namespace
+
+	bool DerivedDataCache::Initialize(const std::string& directory, uint64_t maxSizeBytes) {
+		std::error_code ec;
+		std::filesystem::create_directories(directory, ec);
+		if (ec) {
+			Logger::Warning("DerivedDataCache", "Cannot create cache directory '{}': {}; caching disabled", directory, ec.message());
+			return false;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_directory = directory;
+		m_maxSize = maxSizeBytes;
+		m_entries.clear();
+		m_totalSize = 0;
+
+		// Rebuild the LRU order from file times; hits touch the file so the
+		// order survives restarts
+		struct ScannedEntry {
+			uint64_t key;
+			uint64_t size;
+			std::filesystem::file_time_type time;
+		};
+		std::vector<ScannedEntry> scanned;
+
+		for (const auto& file : std::filesystem::directory_iterator(directory, ec)) {
+			if (!file.is_regular_file(ec)) continue;
+
+			const auto& path = file.path();
+			if (path.extension() == ".tmp") {
+				std::filesystem::remove(path, ec); // Left over from an interrupted write
+				continue;
+			}
+			if (path.extension() != ENTRY_EXTENSION) continue;
+
+			uint64_t key = 0;
+			try {
+				key = std::stoull(path.stem().string(), nullptr, 16);
+			} catch (const std::exception&) {
+				continue;
+			}
+			scanned.push_back({key, static_cast<uint64_t>(file.file_size(ec)), file.last_write_time(ec)});
+		}
+
+		std::sort(scanned.begin(), scanned.end(), [](const ScannedEntry& a, const ScannedEntry& b) {
+			return a.time < b.time;
+		});
+		for (const auto& entry : scanned) {
+			m_entries[entry.key] = {entry.size, ++m_accessTick};
+			m_totalSize += entry.size;
+		}
+
+		EvictLocked();
+		m_enabled = true;
+
+		Logger::Info("DerivedDataCache", "Derived data cache at '{}' ({} entries, {:.1f} / {:.1f} MB)",
+					 directory, m_entries.size(), m_totalSize / (1024.0 * 1024.0), m_maxSize / (1024.0 * 1024.0));
+		return true;
+	}
+
+	void DerivedDataCache::SetMaxSize(uint64_t maxSizeBytes) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_maxSize = maxSizeBytes;
+		EvictLocked();
+	}
+
+	uint64_t DerivedDataCache::ComputeKey(const std::vector<std::string>& sourceFiles, uint32_t assetType,
+										  uint32_t importerVersion, const std::string& settings) {
+		uint64_t key = Hash::XXH64(settings);
+		key = Hash::Combine(key, assetType);
+		key = Hash::Combine(key, importerVersion);
+
+		for (const auto& sourceFile : sourceFiles) {
+			auto file = MappedFile::Open(sourceFile);
+			if (!file) {
+				// Missing dependency still has to change the key
+				key = Hash::Combine(key, Hash::XXH64(sourceFile));
+				continue;
+			}
+			key = Hash::Combine(key, Hash::XXH64(file->GetData(), file->GetSize()));
+		}
+		return key;
+	}
+
+	std::string DerivedDataCache::GetImportSettingsPath(const std::string& sourceFile) {
+		return sourceFile + ".import.json";
+	}
+
+	nlohmann::json DerivedDataCache::ReadImportSettings(const std::string& sourceFile) {
+		std::ifstream file(GetImportSettingsPath(sourceFile));
+		if (!file.is_open()) {
+			return nlohmann::json::object();
+		}
+		nlohmann::json json = nlohmann::json::parse(file, nullptr, false);
+		if (json.is_discarded() || !json.is_object()) {
+			Logger::Warning("DerivedDataCache", "Ignoring malformed import settings for '{}'", sourceFile);
+			return nlohmann::json::object();
+		}
+		return json;
+	}
+
+	std::string DerivedDataCache::GetEntryPath(uint64_t key) const {
+		return (std::filesystem::path(m_directory) / std::format("{:016x}{}", key, ENTRY_EXTENSION)).string();
+	}
+
+	std::optional<std::string> DerivedDataCache::Find(uint64_t key) {
+		if (!m_enabled) {
+			return std::nullopt;
+		}
+
+		std::string path;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto it = m_entries.find(key);
+			if (it == m_entries.end()) {
+				m_misses++;
+				return std::nullopt;
+			}
+			it->second.lastAccess = ++m_accessTick;
+			path = GetEntryPath(key);
+		}
+
+		// Persist recency for the next session's LRU order
+		std::error_code ec;
+		std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+		m_hits++;
+		return path;
+	}
+
+	bool DerivedDataCache::Store(uint64_t key, const std::function<bool(const std::string& path)>& writer) {
+		if (!m_enabled) {
+			return false;
+		}
+
+		std::string path = GetEntryPath(key);
+		// Unique per thread so two loads of the same asset can't collide
+		std::string tempPath = std::format("{}.{}.tmp", path, std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+		std::error_code ec;
+		if (!writer(tempPath)) {
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+
+		uint64_t size = static_cast<uint64_t>(std::filesystem::file_size(tempPath, ec));
+		std::filesystem::rename(tempPath, path, ec);
+		if (ec) {
+			Logger::Warning("DerivedDataCache", "Failed to store entry {:016x}: {}", key, ec.message());
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto& entry = m_entries[key];
+		m_totalSize -= entry.size;
+		entry.size = size;
+		entry.lastAccess = ++m_accessTick;
+		m_totalSize += size;
+		EvictLocked();
+		return true;
+	}
+
+	void DerivedDataCache::Remove(uint64_t key) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_entries.find(key);
+		if (it == m_entries.end()) return;
+
+		std::error_code ec;
+		std::filesystem::remove(GetEntryPath(key), ec);
+		m_totalSize -= it->second.size;
+		m_entries.erase(it);
+	}
+
+	void DerivedDataCache::EvictLocked() {
+		if (m_totalSize <= m_maxSize) return;
+
+		std::vector<std::pair<uint64_t, uint64_t>> byAge; // (lastAccess, key)
+		byAge.reserve(m_entries.size());
+		for (const auto& [key, entry] : m_entries) {
+			byAge.emplace_back(entry.lastAccess, key);
+		}
+		std::sort(byAge.begin(), byAge.end());
+
+		std::error_code ec;
+		for (const auto& [lastAccess, key] : byAge) {
+			if (m_totalSize <= m_maxSize) break;
+
+			// Unlinking is safe even if a reader still has the entry mapped
+			std::filesystem::remove(GetEntryPath(key), ec);
+			m_totalSize -= m_entries[key].size;
+			m_entries.erase(key);
+			m_evictions++;
+		}
+	}
+
+	DerivedDataCache::Stats DerivedDataCache::GetStats() const {
+		Stats stats;
+		stats.hits = m_hits.load();
+		stats.misses = m_misses.load();
+		stats.evictions = m_evictions.load();
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		stats.sizeBytes = m_totalSize;
+		stats.entryCount = m_entries.size();
+		return stats;
+	}
+
+} // namespace AstralEngine
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <nlohmann/json_fwd.hpp>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace AstralEngine {
+
+	/**
+	 * @class DerivedDataCache
+	 * @brief İçerik adresli türetilmiş veri (cooked asset) önbelleği.
+	 *
+	 * Anahtar; kaynak dosya baytlarının, importer sürümünün ve import
+	 * ayarlarının hash'idir. Kaynak değişmediği sürece importer yeniden
+	 * çalıştırılmaz. Toplam boyut sınırı aşıldığında en uzun süre
+	 * kullanılmayan girdiler silinir (LRU). Thread-safe'tir.
+	 */
+	class DerivedDataCache {
+	public:
+		struct Stats {
+			uint64_t hits = 0;
+			uint64_t misses = 0;
+			uint64_t evictions = 0;
+			uint64_t sizeBytes = 0;
+			size_t entryCount = 0;
+		};
+
+		static constexpr uint64_t DEFAULT_MAX_SIZE = 2ull * 1024 * 1024 * 1024;
+
+		// Scans the directory for existing entries; returns false if it can't be created
+		bool Initialize(const std::string& directory, uint64_t maxSizeBytes = DEFAULT_MAX_SIZE);
+		bool IsEnabled() const { return m_enabled; }
+
+		void SetMaxSize(uint64_t maxSizeBytes);
+		uint64_t GetMaxSize() const { return m_maxSize; }
+
+		// Hashes the contents of every source file together with the importer identity
+		static uint64_t ComputeKey(const std::vector<std::string>& sourceFiles, uint32_t assetType,
+								   uint32_t importerVersion, const std::string& settings);
+
+		// Per-asset import options live next to the source: "<source>.import.json".
+		// Importers list it among their source files even when it is absent;
+		// ComputeKey hashes a missing file by its path, so creating the sidecar
+		// later still invalidates the cached entry.
+		static std::string GetImportSettingsPath(const std::string& sourceFile);
+		// The sidecar's JSON object; empty if there is none or it is malformed (logged)
+		static nlohmann::json ReadImportSettings(const std::string& sourceFile);
+
+		// Path of the cached entry (counts a hit), or nullopt (counts a miss)
+		std::optional<std::string> Find(uint64_t key);
+
+		// writer fills the given path; the entry becomes visible only if it returns true
+		bool Store(uint64_t key, const std::function<bool(const std::string& path)>& writer);
+
+		// Drops an entry that turned out to be unreadable
+		void Remove(uint64_t key);
+
+		Stats GetStats() const;
+
+	private:
+		struct Entry {
+			uint64_t size = 0;
+			uint64_t lastAccess = 0; // Monotonic tick; higher is more recent
+		};
+
+		std::string GetEntryPath(uint64_t key) const;
+		void EvictLocked();
+
+		std::string m_directory;
+		bool m_enabled = false;
+		uint64_t m_maxSize = DEFAULT_MAX_SIZE;
+
+		mutable std::mutex m_mutex;
+		std::unordered_map<uint64_t, Entry> m_entries;
+		uint64_t m_totalSize = 0;
+		uint64_t m_accessTick = 0;
+
+		std::atomic<uint64_t> m_hits{0};
+		std::atomic<uint64_t> m_misses{0};
+		std::atomic<uint64_t> m_evictions{0};
+	};
+
+} // namespace AstralEngine
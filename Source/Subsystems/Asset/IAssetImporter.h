@@ -2,6 +2,9 @@
 
 #include <string>
 #include <memory>
+#include <vector>
+#include <cstdint>
+#include "../../Core/MappedFile.h"
 
 namespace AstralEngine {
 
@@ -27,6 +30,70 @@ namespace AstralEngine {
 		 *         başarısız olursa nullptr döndürür.
 		 */
 		virtual std::shared_ptr<void> Import(const std::string& filePath) = 0;
+
+		/**
+		 * @brief Dosyanın tamamı bellekte verildiğinde varlığı oradan içe aktarır.
+		 *
+		 * SupportsMemoryImport() true dönen dosyaları AssetManager asenkron
+		 * okur (AsyncFileIO) ve çözümlemeyi bir worker thread'de bununla
+		 * yapar; böylece disk beklenirken hiçbir thread bloklanmaz. Sonuç
+		 * Import() ile aynı olmalıdır.
+		 */
+		virtual bool SupportsMemoryImport(const std::string& filePath) const { return false; }
+		virtual std::shared_ptr<void> ImportFromMemory(const std::string& filePath, const std::shared_ptr<MappedFile>& data) { return nullptr; }
+
+		/**
+		 * @brief Importer çıktısını DerivedDataCache'e yazıp okuyabiliyorsa true döner.
+		 *
+		 * Önbellek anahtarı GetSourceFiles() dosyalarının içeriği, GetVersion()
+		 * ve GetSettingsKey() değerlerinden hesaplanır. Çıktı formatı veya
+		 * import davranışı değiştiğinde GetVersion() artırılmalıdır.
+		 */
+		virtual bool SupportsDerivedData(const std::string& filePath) const { return false; }
+		virtual uint32_t GetVersion() const { return 1; }
+		virtual std::string GetSettingsKey() const { return {}; }
+
+		// Every file whose contents affect the import result (e.g. .gltf + .bin)
+		virtual std::vector<std::string> GetSourceFiles(const std::string& filePath) const { return { filePath }; }
+
+		virtual bool WriteDerivedData(const std::shared_ptr<void>& asset, const std::string& cachePath) { return false; }
+
+		// sourcePath is the original asset path, for fields the cached blob does not store
+		virtual std::shared_ptr<void> ReadDerivedData(const std::string& cachePath, const std::string& sourcePath) {
+			auto file = MappedFile::Open(cachePath);
+			return file ? ReadDerivedBlob(file, sourcePath) : nullptr;
+		}
+
+		/**
+		 * @brief WriteDerivedData çıktısını bellekteki bir blob'dan okur.
+		 *
+		 * Paketlenmiş arşivler (AssetArchive) her varlığı bu formatta tutar;
+		 * blob arşivin map edilmiş belleğini gösterebilir, dönen veri onu
+		 * tutarak sıfır kopyayla kullanabilir. Arşivler SupportsDerivedData()
+		 * false dönen dosyaları da WriteDerivedData ile paketler.
+		 */
+		virtual std::shared_ptr<void> ReadDerivedBlob(const std::shared_ptr<MappedFile>& blob, const std::string& sourcePath) { return nullptr; }
+
+		// True if a cache hit may be read whole ahead of time and handed to
+		// ReadDerivedBlob instead of going through ReadDerivedData
+		virtual bool SupportsDerivedDataReadAhead() const { return false; }
+
+		/**
+		 * @brief Varlığın kullanılabilmesi için önce yüklenmesi gereken diğer varlıkların yolları.
+		 *
+		 * AssetManager bunları paralel yükler ve varlığı ancak hepsi bittiğinde
+		 * hazır sayar (ör. materyal için texture ve shader'lar). Bağımlılıklar
+		 * döngü oluşturmamalıdır.
+		 */
+		virtual std::vector<std::string> GetDependencies(const std::shared_ptr<void>& asset) const { return {}; }
+
+		/**
+		 * @brief Yüklenen varlığın bellekte tuttuğu bayt sayısı.
+		 *
+		 * AssetManager bunu yükleme anında kaydeder ve tür başına bellek
+		 * bütçelerini bununla uygular.
+		 */
+		virtual size_t GetMemoryUsage(const std::shared_ptr<void>& asset) const { return 0; }
 	};
 
 } // namespace AstralEngine
@@ -4,13 +4,58 @@
 #include "AssetManager.h"
 
 
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <istream>
 #include <nlohmann/json.hpp>
+#include <streambuf>
 
 
 namespace AstralEngine {
 
+namespace {
+
+constexpr uint32_t CACHE_MAGIC = 0x544D4341; // "ACMT"
+
+void WriteString(std::ofstream &file, const std::string &value) {
+  uint32_t length = static_cast<uint32_t>(value.size());
+  file.write(reinterpret_cast<const char *>(&length), sizeof(length));
+  file.write(value.data(), length);
+}
+
+bool ReadString(std::istream &file, std::string &value) {
+  uint32_t length = 0;
+  if (!file.read(reinterpret_cast<char *>(&length), sizeof(length))) {
+    return false;
+  }
+  value.resize(length);
+  return static_cast<bool>(file.read(value.data(), length));
+}
+
+// Reads a blob in place, without copying it into a stringstream
+struct BlobBuffer : std::streambuf {
+  BlobBuffer(const uint8_t *data, size_t size) {
+    char *begin = reinterpret_cast<char *>(const_cast<uint8_t *>(data));
+    setg(begin, begin, begin + size);
+  }
+};
+
+// Every path field, in serialization order
+template <typename Material, typename F>
+void ForEachPath(Material &material, F &&f) {
+  f(material.vertexShaderPath);
+  f(material.fragmentShaderPath);
+  f(material.albedoMapPath);
+  f(material.normalMapPath);
+  f(material.metallicMapPath);
+  f(material.roughnessMapPath);
+  f(material.aoMapPath);
+  f(material.emissiveMapPath);
+}
+
+} // namespace
+
 MaterialImporter::MaterialImporter(AssetManager *owner)
     : m_ownerManager(owner) {}
 
@@ -24,12 +69,24 @@ std::shared_ptr<void> MaterialImporter::Import(const std::string &filePath) {
                   filePath);
     return nullptr;
   }
+  return Parse(file, filePath);
+}
+
+std::shared_ptr<void>
+MaterialImporter::ImportFromMemory(const std::string &filePath,
+                                   const std::shared_ptr<MappedFile> &data) {
+  BlobBuffer buffer(data->GetData(), data->GetSize());
+  std::istream input(&buffer);
+  return Parse(input, filePath);
+}
 
+std::shared_ptr<void> MaterialImporter::Parse(std::istream &input,
+                                              const std::string &filePath) {
   auto materialData = std::make_shared<MaterialData>(filePath);
 
   try {
     nlohmann::json materialJson;
-    file >> materialJson;
+    input >> materialJson;
 
     materialData->name = materialJson.value(
         "name", std::filesystem::path(filePath).stem().string());
@@ -133,4 +190,81 @@ std::shared_ptr<void> MaterialImporter::Import(const std::string &filePath) {
   return materialData;
 }
 
+bool MaterialImporter::WriteDerivedData(const std::shared_ptr<void> &asset,
+                                        const std::string &cachePath) {
+  const auto &materialData = *std::static_pointer_cast<MaterialData>(asset);
+
+  std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char *>(&CACHE_MAGIC), sizeof(CACHE_MAGIC));
+  WriteString(file, materialData.name);
+  ForEachPath(materialData,
+              [&](const std::string &path) { WriteString(file, path); });
+
+  uint32_t textureCount =
+      static_cast<uint32_t>(materialData.texturePaths.size());
+  file.write(reinterpret_cast<const char *>(&textureCount),
+             sizeof(textureCount));
+  for (const auto &path : materialData.texturePaths) {
+    WriteString(file, path);
+  }
+
+  // Properties is a plain aggregate of glm vectors, floats and bools
+  file.write(reinterpret_cast<const char *>(&materialData.properties),
+             sizeof(materialData.properties));
+  return file.good();
+}
+
+std::shared_ptr<void>
+MaterialImporter::ReadDerivedBlob(const std::shared_ptr<MappedFile> &blob,
+                                  const std::string &sourcePath) {
+  BlobBuffer buffer(blob->GetData(), blob->GetSize());
+  std::istream file(&buffer);
+  uint32_t magic = 0;
+  if (!file.read(reinterpret_cast<char *>(&magic), sizeof(magic)) ||
+      magic != CACHE_MAGIC) {
+    return nullptr;
+  }
+
+  auto materialData = std::make_shared<MaterialData>(sourcePath);
+  bool ok = ReadString(file, materialData->name);
+  ForEachPath(*materialData,
+              [&](std::string &path) { ok = ok && ReadString(file, path); });
+
+  uint32_t textureCount = 0;
+  ok = ok && file.read(reinterpret_cast<char *>(&textureCount),
+                       sizeof(textureCount));
+  for (uint32_t i = 0; ok && i < textureCount; ++i) {
+    ok = ReadString(file, materialData->texturePaths.emplace_back());
+  }
+  ok = ok && file.read(reinterpret_cast<char *>(&materialData->properties),
+                       sizeof(materialData->properties));
+  if (!ok) {
+    return nullptr;
+  }
+
+  materialData->isValid = true;
+  return materialData;
+}
+
+std::vector<std::string> MaterialImporter::GetDependencies(
+    const std::shared_ptr<void> &asset) const {
+  const auto &materialData = *std::static_pointer_cast<MaterialData>(asset);
+
+  std::vector<std::string> dependencies;
+  ForEachPath(materialData, [&](const std::string &path) {
+    if (!path.empty()) {
+      dependencies.push_back(path);
+    }
+  });
+  for (const auto &path : materialData.texturePaths) {
+    dependencies.push_back(path);
+  }
+  return dependencies;
+}
+
+size_t MaterialImporter::GetMemoryUsage(
+    const std::shared_ptr<void> &asset) const {
+  return std::static_pointer_cast<MaterialData>(asset)->GetMemoryUsage();
+}
+
 } // namespace AstralEngine
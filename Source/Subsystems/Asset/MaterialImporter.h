@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IAssetImporter.h"
+#include <iosfwd>
 
 namespace AstralEngine {
 
@@ -17,8 +18,22 @@ namespace AstralEngine {
 		explicit MaterialImporter(AssetManager* owner);
 
 		std::shared_ptr<void> Import(const std::string& filePath) override;
+		bool SupportsMemoryImport(const std::string& filePath) const override { return true; }
+		std::shared_ptr<void> ImportFromMemory(const std::string& filePath, const std::shared_ptr<MappedFile>& data) override;
+
+		bool SupportsDerivedData(const std::string& filePath) const override { return true; }
+		bool WriteDerivedData(const std::shared_ptr<void>& asset, const std::string& cachePath) override;
+		std::shared_ptr<void> ReadDerivedBlob(const std::shared_ptr<MappedFile>& blob, const std::string& sourcePath) override;
+		bool SupportsDerivedDataReadAhead() const override { return true; }
+
+		// Shaders and every texture map
+		std::vector<std::string> GetDependencies(const std::shared_ptr<void>& asset) const override;
+		size_t GetMemoryUsage(const std::shared_ptr<void>& asset) const override;
 
 	private:
+		// Parses the material JSON; filePath names the asset in logs and defaults
+		std::shared_ptr<void> Parse(std::istream& input, const std::string& filePath);
+
 		AssetManager* m_ownerManager;
 	};
 
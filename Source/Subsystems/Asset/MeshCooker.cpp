@@ -0,0 +1,212 @@
+#include "MeshCooker.h"
+#include "../../Core/Logger.h"
+#include "../../Core/MappedFile.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace AstralEngine {
+
+	namespace {
+
+		uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+
+		void WritePadding(std::ofstream& file, uint64_t targetOffset) {
+			static const char zeros[MeshCooker::BLOB_ALIGNMENT] = {};
+			uint64_t current = static_cast<uint64_t>(file.tellp());
+			if (targetOffset > current) {
+				file.write(zeros, static_cast<std::streamsize>(targetOffset - current));
+			}
+		}
+
+		static_assert(std::is_trivially_copyable_v<Meshlet>, "Meshlets are stored in and mapped from cooked files");
+		static_assert(std::is_trivially_copyable_v<PackedVertex>, "Packed vertices are stored in and mapped from cooked files");
+		static_assert(std::is_trivially_copyable_v<MeshLod>, "LODs are stored in and mapped from cooked files");
+		static_assert(std::is_trivially_copyable_v<Submesh>, "Submeshes are stored in and mapped from cooked files");
+
+	} // namespace
+
+	bool MeshCooker::Write(const ModelData& model, const std::string& cookedPath) {
+		auto vertices = model.GetVertexData();
+		auto indices = model.GetIndices();
+		auto meshlets = model.GetMeshlets();
+		auto lods = model.GetLods();
+		auto submeshes = model.GetSubmeshes();
+		if (vertices.empty() || indices.empty()) {
+			return false;
+		}
+
+		CookedMeshHeader header{};
+		header.magic = MAGIC;
+		header.version = FORMAT_VERSION;
+		header.vertexStride = model.GetVertexStride();
+		header.indexSize = sizeof(uint32_t);
+		header.vertexCount = model.GetVertexCount();
+		header.indexCount = indices.size();
+		header.submeshCount = static_cast<uint32_t>(submeshes.size());
+		header.flags = model.vertexFormat == VertexFormat::Packed ? FLAG_PACKED_VERTICES : 0;
+		std::memcpy(header.boundsMin, &model.boundingBox.min, sizeof(header.boundsMin));
+		std::memcpy(header.boundsMax, &model.boundingBox.max, sizeof(header.boundsMax));
+		header.submeshTableOffset = AlignUp(sizeof(CookedMeshHeader), alignof(Submesh));
+		header.vertexDataOffset = AlignUp(header.submeshTableOffset + submeshes.size_bytes(), BLOB_ALIGNMENT);
+		header.indexDataOffset = AlignUp(header.vertexDataOffset + vertices.size_bytes(), BLOB_ALIGNMENT);
+		header.meshletCount = meshlets.size();
+		header.meshletDataOffset = AlignUp(header.indexDataOffset + indices.size_bytes(), BLOB_ALIGNMENT);
+		header.lodCount = lods.size();
+		header.lodTableOffset = AlignUp(header.meshletDataOffset + meshlets.size_bytes(), alignof(MeshLod));
+
+		std::error_code ec;
+		std::filesystem::path path(cookedPath);
+		if (path.has_parent_path()) {
+			std::filesystem::create_directories(path.parent_path(), ec);
+		}
+
+		std::string tempPath = cookedPath + ".tmp";
+		{
+			std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+			if (!file.is_open()) {
+				Logger::Error("MeshCooker", "Failed to open '{}' for writing", tempPath);
+				return false;
+			}
+
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			WritePadding(file, header.submeshTableOffset);
+			file.write(reinterpret_cast<const char*>(submeshes.data()), static_cast<std::streamsize>(submeshes.size_bytes()));
+			WritePadding(file, header.vertexDataOffset);
+			file.write(reinterpret_cast<const char*>(vertices.data()), static_cast<std::streamsize>(vertices.size_bytes()));
+			WritePadding(file, header.indexDataOffset);
+			file.write(reinterpret_cast<const char*>(indices.data()), static_cast<std::streamsize>(indices.size_bytes()));
+			if (!meshlets.empty()) {
+				WritePadding(file, header.meshletDataOffset);
+				file.write(reinterpret_cast<const char*>(meshlets.data()), static_cast<std::streamsize>(meshlets.size_bytes()));
+			}
+			if (!lods.empty()) {
+				WritePadding(file, header.lodTableOffset);
+				file.write(reinterpret_cast<const char*>(lods.data()), static_cast<std::streamsize>(lods.size_bytes()));
+			}
+
+			if (!file.good()) {
+				Logger::Error("MeshCooker", "Failed to write cooked mesh '{}'", tempPath);
+				file.close();
+				std::filesystem::remove(tempPath, ec);
+				return false;
+			}
+		}
+
+		std::filesystem::rename(tempPath, cookedPath, ec);
+		if (ec) {
+			Logger::Error("MeshCooker", "Failed to move cooked mesh into place '{}': {}", cookedPath, ec.message());
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+		return true;
+	}
+
+	std::shared_ptr<ModelData> MeshCooker::Load(const std::string& cookedPath) {
+		auto file = MappedFile::Open(cookedPath);
+		if (!file) {
+			return nullptr;
+		}
+		return Load(std::move(file), cookedPath);
+	}
+
+	std::shared_ptr<ModelData> MeshCooker::Load(std::shared_ptr<MappedFile> file, const std::string& name) {
+		const uint8_t* base = file->GetData();
+		size_t size = file->GetSize();
+		if (size < sizeof(CookedMeshHeader)) {
+			Logger::Warning("MeshCooker", "Cooked mesh '{}' is truncated", name);
+			return nullptr;
+		}
+
+		CookedMeshHeader header;
+		std::memcpy(&header, base, sizeof(header));
+		const bool packed = (header.flags & FLAG_PACKED_VERTICES) != 0;
+		const uint32_t expectedStride = packed ? sizeof(PackedVertex) : sizeof(Vertex);
+		if (header.magic != MAGIC || header.version != FORMAT_VERSION ||
+			header.vertexStride != expectedStride || header.indexSize != sizeof(uint32_t)) {
+			Logger::Debug("MeshCooker", "Cooked mesh '{}' has an incompatible format, ignoring", name);
+			return nullptr;
+		}
+
+		// Every count and offset comes from the file, so each range is checked
+		// in a form that cannot wrap
+		if (header.vertexDataOffset % BLOB_ALIGNMENT != 0 || header.indexDataOffset % BLOB_ALIGNMENT != 0 ||
+			header.meshletDataOffset % BLOB_ALIGNMENT != 0 ||
+			!MappedFile::RangeFits(header.vertexDataOffset, header.vertexCount, expectedStride, size) ||
+			!MappedFile::RangeFits(header.indexDataOffset, header.indexCount, sizeof(uint32_t), size) ||
+			(header.meshletCount > 0 && !MappedFile::RangeFits(header.meshletDataOffset, header.meshletCount, sizeof(Meshlet), size)) ||
+			header.lodCount > MAX_MESH_LODS ||
+			(header.lodCount > 0 && (header.lodTableOffset % alignof(MeshLod) != 0 ||
+									 !MappedFile::RangeFits(header.lodTableOffset, header.lodCount, sizeof(MeshLod), size))) ||
+			header.submeshTableOffset % alignof(Submesh) != 0 ||
+			!MappedFile::RangeFits(header.submeshTableOffset, header.submeshCount, sizeof(Submesh), size)) {
+			Logger::Warning("MeshCooker", "Cooked mesh '{}' is corrupt", name);
+			return nullptr;
+		}
+
+		auto modelData = std::make_shared<ModelData>(name);
+		if (packed) {
+			modelData->vertexFormat = VertexFormat::Packed;
+			modelData->mappedPackedVertices = std::span<const PackedVertex>(
+				reinterpret_cast<const PackedVertex*>(base + header.vertexDataOffset), header.vertexCount);
+		} else {
+			modelData->mappedVertices = std::span<const Vertex>(
+				reinterpret_cast<const Vertex*>(base + header.vertexDataOffset), header.vertexCount);
+		}
+		modelData->mappedIndices = std::span<const uint32_t>(
+			reinterpret_cast<const uint32_t*>(base + header.indexDataOffset), header.indexCount);
+		if (header.meshletCount > 0) {
+			modelData->mappedMeshlets = std::span<const Meshlet>(
+				reinterpret_cast<const Meshlet*>(base + header.meshletDataOffset), header.meshletCount);
+		}
+		// Draws and LOD selection index the buffers with these tables unchecked
+		auto lodFits = [&](const MeshLod& lod) {
+			return MappedFile::RangeFits(lod.indexOffset, lod.indexCount, 1, header.indexCount) &&
+				   MappedFile::RangeFits(lod.meshletOffset, lod.meshletCount, 1, header.meshletCount);
+		};
+		for (const auto& meshlet : modelData->mappedMeshlets) {
+			if (!MappedFile::RangeFits(meshlet.indexOffset, meshlet.triangleCount, 3, header.indexCount)) {
+				Logger::Warning("MeshCooker", "Cooked mesh '{}' has an invalid meshlet table", name);
+				return nullptr;
+			}
+		}
+		if (header.lodCount > 0) {
+			modelData->mappedLods = std::span<const MeshLod>(
+				reinterpret_cast<const MeshLod*>(base + header.lodTableOffset), header.lodCount);
+			for (const auto& lod : modelData->mappedLods) {
+				if (!lodFits(lod)) {
+					Logger::Warning("MeshCooker", "Cooked mesh '{}' has an invalid LOD table", name);
+					return nullptr;
+				}
+			}
+		}
+		if (header.submeshCount > 0) {
+			modelData->mappedSubmeshes = std::span<const Submesh>(
+				reinterpret_cast<const Submesh*>(base + header.submeshTableOffset), header.submeshCount);
+			for (const auto& submesh : modelData->mappedSubmeshes) {
+				bool valid = MappedFile::RangeFits(submesh.vertexOffset, submesh.vertexCount, 1, header.vertexCount);
+				for (const auto& lod : submesh.lods) {
+					valid = valid && lodFits(lod);
+				}
+				if (!valid) {
+					Logger::Warning("MeshCooker", "Cooked mesh '{}' has an invalid submesh table", name);
+					return nullptr;
+				}
+			}
+		}
+		modelData->mappedStorage = file;
+		modelData->boundingBox = AABB(
+			glm::vec3(header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]),
+			glm::vec3(header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]));
+		modelData->name = std::filesystem::path(name).stem().string();
+		modelData->isValid = true;
+		return modelData;
+	}
+
+} // namespace AstralEngine
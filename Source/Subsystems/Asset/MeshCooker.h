@@ -0,0 +1,63 @@
+#pragma once
+
+#include "AssetData.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace AstralEngine {
+
+	class MappedFile;
+
+	/**
+	 * @brief Cooked mesh (.amesh) dosya başlığı.
+	 *
+	 * Dosya düzeni: başlık, submesh tablosu (Submesh), vertex blob'u, index blob'u,
+	 * meshlet tablosu, LOD tablosu.
+	 * Blob'lar BLOB_ALIGNMENT'a hizalıdır; map edilen dosyadan doğrudan
+	 * okunabilir.
+	 */
+	struct CookedMeshHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t vertexStride;
+		uint32_t indexSize;
+		uint64_t vertexCount;
+		uint64_t indexCount;
+		uint32_t submeshCount;
+		uint32_t flags;
+		float boundsMin[3];
+		float boundsMax[3];
+		uint64_t meshletCount;
+		uint64_t meshletDataOffset;
+		uint64_t submeshTableOffset;
+		uint64_t vertexDataOffset;
+		uint64_t indexDataOffset;
+		uint64_t lodCount;
+		uint64_t lodTableOffset;
+	};
+
+	/**
+	 * @class MeshCooker
+	 * @brief ModelData'yı versiyonlu binary formata yazar ve mmap ile geri yükler.
+	 */
+	class MeshCooker {
+	public:
+		static constexpr uint32_t MAGIC = 0x48534D41; // "AMSH"
+		static constexpr uint32_t FORMAT_VERSION = 6;
+		static constexpr uint32_t FLAG_PACKED_VERTICES = 1u << 0; // Vertex blob holds PackedVertex
+		static constexpr uint64_t BLOB_ALIGNMENT = 64;
+		static constexpr const char* EXTENSION = ".amesh";
+
+		// Writes to a temp file and renames it, so readers never see a partial file
+		static bool Write(const ModelData& model, const std::string& cookedPath);
+
+		// Maps the file; vertex/index data are used in place. Returns nullptr if
+		// the file is missing, malformed or from another format version.
+		static std::shared_ptr<ModelData> Load(const std::string& cookedPath);
+		// Same, for a blob that is already mapped (e.g. a packed archive entry);
+		// name is only used in messages
+		static std::shared_ptr<ModelData> Load(std::shared_ptr<MappedFile> file, const std::string& name);
+	};
+
+} // namespace AstralEngine
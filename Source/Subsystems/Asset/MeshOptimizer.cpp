@@ -0,0 +1,471 @@
+#include "MeshOptimizer.h"
+#include "MeshletBuilder.h"
+#include "MeshSimplifier.h"
+#include "../../Core/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace AstralEngine {
+
+	namespace {
+
+		constexpr uint32_t INVALID = std::numeric_limits<uint32_t>::max();
+
+		// Tom Forsyth, "Linear-Speed Vertex Cache Optimisation"
+		constexpr uint32_t FORSYTH_CACHE_SIZE = 32;
+		constexpr float CACHE_DECAY_POWER = 1.5f;
+		constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+		constexpr float VALENCE_BOOST_SCALE = 2.0f;
+		constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+		float VertexScore(int32_t cachePosition, uint32_t remainingValence) {
+			if (remainingValence == 0) {
+				return -1.0f; // No triangles left to use it
+			}
+
+			float score = 0.0f;
+			if (cachePosition >= 0) {
+				if (cachePosition < 3) {
+					// Vertices of the last triangle; fixed score so it isn't simply repeated
+					score = LAST_TRIANGLE_SCORE;
+				} else {
+					float scaler = 1.0f / (FORSYTH_CACHE_SIZE - 3);
+					score = std::pow(1.0f - (cachePosition - 3) * scaler, CACHE_DECAY_POWER);
+				}
+			}
+			// Boost vertices with few triangles left so lone triangles get finished
+			score += VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainingValence), -VALENCE_BOOST_POWER);
+			return score;
+		}
+
+		// FIFO cache simulation via timestamps: a vertex is resident if it was
+		// loaded fewer than cacheSize misses ago
+		template <typename F>
+		void SimulateFifo(std::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize, F&& onTriangle) {
+			std::vector<uint32_t> loadTime(vertexCount, 0);
+			uint32_t time = cacheSize + 1;
+			for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+				uint32_t misses = 0;
+				for (size_t k = 0; k < 3; ++k) {
+					uint32_t v = indices[i + k];
+					if (time - loadTime[v] > cacheSize) {
+						loadTime[v] = time++;
+						misses++;
+					}
+				}
+				onTriangle(i / 3, misses);
+			}
+		}
+
+		double ElapsedMs(std::chrono::steady_clock::time_point start) {
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+	} // namespace
+
+	MeshOptimizationReport MeshOptimizer::Optimize(ModelData& model, const MeshOptimizerSettings& settings) {
+		MeshOptimizationReport report;
+		if (model.mappedStorage || model.vertexFormat != VertexFormat::Standard) {
+			Logger::Warning("MeshOptimizer", "Cannot optimize mapped or packed model '{}'", model.name);
+			return report;
+		}
+
+		// Re-running rebuilds the chain from LOD0
+		if (!model.lods.empty()) {
+			model.indices.resize(model.lods.front().indexCount);
+			model.lods.clear();
+			for (auto& submesh : model.submeshes) {
+				std::fill(std::begin(submesh.lods) + 1, std::end(submesh.lods), MeshLod{});
+			}
+		}
+		EnsureSubmesh(model);
+
+		auto start = std::chrono::steady_clock::now();
+		report.before = AnalyzeVertexCache(model.indices, model.vertices.size());
+		report.vertexCountBefore = model.vertices.size();
+
+		if (settings.lodCount > 1) {
+			GenerateLods(model, settings.lodCount, settings.lodReduction, settings.lodMaxError);
+		}
+
+		// Every submesh of every LOD can be drawn on its own, so each range is
+		// ordered independently
+		auto forEachRange = [&](auto&& stage) {
+			std::vector<uint32_t> range;
+			for (uint32_t level = 0; level < model.GetLodCount(); ++level) {
+				for (const auto& submesh : model.submeshes) {
+					auto first = model.indices.begin() + submesh.lods[level].indexOffset;
+					range.assign(first, first + submesh.lods[level].indexCount);
+					stage(range);
+					std::copy(range.begin(), range.end(), first);
+				}
+			}
+		};
+		if (settings.vertexCache) {
+			forEachRange([&](std::vector<uint32_t>& indices) { OptimizeVertexCache(indices, model.vertices.size()); });
+		}
+		if (settings.overdraw) {
+			forEachRange([&](std::vector<uint32_t>& indices) {
+				OptimizeOverdraw(indices, model.vertices, settings.overdrawThreshold);
+			});
+		}
+		if (settings.meshlets) {
+			MeshletBuilder::Build(model);
+		} else {
+			model.meshlets.clear();
+		}
+		// Last: only renames vertices, so triangle order and meshlet ranges stay valid
+		if (settings.vertexFetch) {
+			OptimizeVertexFetch(model.vertices, model.indices);
+			UpdateSubmeshVertexRanges(model);
+		}
+
+		std::span<const uint32_t> lod0(model.indices);
+		if (!model.lods.empty()) {
+			lod0 = lod0.first(model.lods.front().indexCount);
+		}
+		report.after = AnalyzeVertexCache(lod0, model.vertices.size());
+		report.vertexCountAfter = model.vertices.size();
+		report.lodCount = model.GetLodCount();
+		report.timeMs = ElapsedMs(start);
+
+		Logger::Info("MeshOptimizer", "Optimized '{}': ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, vertices {} -> {}, {} LODs ({:.2f} ms)",
+					 model.name, report.before.acmr, report.after.acmr, report.before.atvr, report.after.atvr,
+					 report.vertexCountBefore, report.vertexCountAfter, report.lodCount, report.timeMs);
+		return report;
+	}
+
+	void MeshOptimizer::EnsureSubmesh(ModelData& model) {
+		model.indices.resize(model.indices.size() - model.indices.size() % 3);
+		if (!model.submeshes.empty()) {
+			return;
+		}
+
+		Submesh submesh;
+		submesh.vertexCount = static_cast<uint32_t>(model.vertices.size());
+		submesh.bounds = model.boundingBox;
+		submesh.lods[0].indexCount = static_cast<uint32_t>(model.indices.size());
+		model.submeshes.push_back(submesh);
+	}
+
+	void MeshOptimizer::UpdateSubmeshVertexRanges(ModelData& model) {
+		for (auto& submesh : model.submeshes) {
+			// LOD0 references every vertex the coarser levels use
+			const MeshLod& range = submesh.lods[0];
+			if (range.indexCount == 0) {
+				submesh.vertexOffset = 0;
+				submesh.vertexCount = 0;
+				continue;
+			}
+			auto first = model.indices.begin() + range.indexOffset;
+			auto [minIt, maxIt] = std::minmax_element(first, first + range.indexCount);
+			submesh.vertexOffset = *minIt;
+			submesh.vertexCount = *maxIt - *minIt + 1;
+		}
+	}
+
+	void MeshOptimizer::GenerateLods(ModelData& model, uint32_t lodCount, float reduction, float maxError) {
+		model.lods.clear();
+		EnsureSubmesh(model);
+		if (model.indices.empty()) {
+			return;
+		}
+		lodCount = std::min(lodCount, MAX_MESH_LODS);
+
+		// LOD0 as laid out by the importer: submeshes back to back
+		const size_t submeshCount = model.submeshes.size();
+		std::vector<std::vector<uint32_t>> sources(submeshCount);
+		for (size_t s = 0; s < submeshCount; ++s) {
+			const MeshLod& range = model.submeshes[s].lods[0];
+			sources[s].assign(model.indices.begin() + range.indexOffset,
+							  model.indices.begin() + range.indexOffset + range.indexCount);
+		}
+		model.lods.push_back({ 0, static_cast<uint32_t>(model.indices.size()), 0, 0, 0.0f });
+
+		std::vector<std::vector<uint32_t>> previous = sources;
+		size_t previousTotal = model.indices.size();
+		for (uint32_t level = 1; level < lodCount; ++level) {
+			std::vector<std::vector<uint32_t>> next(submeshCount);
+			std::vector<float> errors(submeshCount, 0.0f);
+			size_t total = 0;
+			for (size_t s = 0; s < submeshCount; ++s) {
+				size_t target = static_cast<size_t>(previous[s].size() / 3 * reduction) * 3;
+
+				// Always from the source so errors don't compound across levels
+				float error = 0.0f;
+				std::vector<uint32_t> simplified = MeshSimplifier::Simplify(model.vertices, sources[s], target, maxError, &error);
+
+				// A submesh that can't shrink further (error limit, locked borders)
+				// repeats its previous level
+				if (simplified.empty() || simplified.size() >= previous[s].size()) {
+					next[s] = previous[s];
+					errors[s] = model.submeshes[s].lods[level - 1].error;
+				} else {
+					next[s] = std::move(simplified);
+					errors[s] = std::max(error, model.submeshes[s].lods[level - 1].error);
+				}
+				total += next[s].size();
+			}
+
+			// Stop once the whole model stalls
+			if (total > previousTotal * 9 / 10) {
+				break;
+			}
+
+			MeshLod lod;
+			lod.indexOffset = static_cast<uint32_t>(model.indices.size());
+			lod.indexCount = static_cast<uint32_t>(total);
+			lod.error = model.lods.back().error;
+			for (size_t s = 0; s < submeshCount; ++s) {
+				MeshLod& range = model.submeshes[s].lods[level];
+				range = {};
+				range.indexOffset = static_cast<uint32_t>(model.indices.size());
+				range.indexCount = static_cast<uint32_t>(next[s].size());
+				range.error = errors[s];
+				lod.error = std::max(lod.error, errors[s]);
+				model.indices.insert(model.indices.end(), next[s].begin(), next[s].end());
+			}
+			model.lods.push_back(lod);
+			previous = std::move(next);
+			previousTotal = total;
+		}
+
+		for (size_t i = 0; i < model.lods.size(); ++i) {
+			Logger::Debug("MeshOptimizer", "'{}' LOD{}: {} triangles, error {:.4f}", model.name, i,
+						  model.lods[i].indexCount / 3, model.lods[i].error);
+		}
+	}
+
+	VertexCacheStats MeshOptimizer::AnalyzeVertexCache(std::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize) {
+		VertexCacheStats stats;
+		size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0 || vertexCount == 0) {
+			return stats;
+		}
+
+		uint64_t totalMisses = 0;
+		SimulateFifo(indices, vertexCount, cacheSize, [&](size_t, uint32_t misses) { totalMisses += misses; });
+
+		std::vector<uint8_t> referenced(vertexCount, 0);
+		size_t uniqueVertices = 0;
+		for (uint32_t index : indices) {
+			if (!referenced[index]) {
+				referenced[index] = 1;
+				uniqueVertices++;
+			}
+		}
+
+		stats.acmr = static_cast<float>(totalMisses) / triangleCount;
+		stats.atvr = static_cast<float>(totalMisses) / uniqueVertices;
+		return stats;
+	}
+
+	void MeshOptimizer::OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount) {
+		const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+		if (triangleCount == 0) {
+			return;
+		}
+
+		// Live vertex -> triangle adjacency; entries are swap-removed as triangles are emitted
+		std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+		for (uint32_t i = 0; i < triangleCount * 3; ++i) {
+			adjacencyOffsets[indices[i] + 1]++;
+		}
+		std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+
+		std::vector<uint32_t> liveValence(vertexCount, 0);
+		std::vector<uint32_t> adjacency(triangleCount * 3);
+		for (uint32_t t = 0; t < triangleCount; ++t) {
+			for (uint32_t k = 0; k < 3; ++k) {
+				uint32_t v = indices[t * 3 + k];
+				adjacency[adjacencyOffsets[v] + liveValence[v]++] = t;
+			}
+		}
+
+		std::vector<int32_t> cachePosition(vertexCount, -1);
+		std::vector<float> vertexScore(vertexCount);
+		for (size_t v = 0; v < vertexCount; ++v) {
+			vertexScore[v] = VertexScore(-1, liveValence[v]);
+		}
+
+		std::vector<float> triangleScore(triangleCount);
+		std::vector<uint8_t> emitted(triangleCount, 0);
+		uint32_t best = INVALID;
+		float bestScore = -std::numeric_limits<float>::max();
+		for (uint32_t t = 0; t < triangleCount; ++t) {
+			triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+			if (triangleScore[t] > bestScore) {
+				bestScore = triangleScore[t];
+				best = t;
+			}
+		}
+
+		std::vector<uint32_t> result;
+		result.reserve(triangleCount * 3);
+		std::vector<uint32_t> cache;
+		std::vector<uint32_t> newCache;
+		cache.reserve(FORSYTH_CACHE_SIZE + 3);
+		newCache.reserve(FORSYTH_CACHE_SIZE + 3);
+		uint32_t scanCursor = 0;
+
+		for (uint32_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount) {
+			if (best == INVALID) {
+				// Nothing in the cache has triangles left; restart in input order,
+				// which is cheaper than a full rescore and keeps the source locality
+				while (emitted[scanCursor]) scanCursor++;
+				best = scanCursor;
+			}
+
+			const uint32_t* triangle = &indices[best * 3];
+			result.insert(result.end(), triangle, triangle + 3);
+			emitted[best] = 1;
+
+			newCache.clear();
+			for (uint32_t k = 0; k < 3; ++k) {
+				uint32_t v = triangle[k];
+
+				uint32_t begin = adjacencyOffsets[v];
+				uint32_t end = begin + liveValence[v];
+				for (uint32_t a = begin; a < end; ++a) {
+					if (adjacency[a] == best) {
+						adjacency[a] = adjacency[end - 1];
+						liveValence[v]--;
+						break;
+					}
+				}
+
+				if (std::find(newCache.begin(), newCache.end(), v) == newCache.end()) {
+					newCache.push_back(v);
+				}
+			}
+			for (uint32_t v : cache) {
+				if (std::find(newCache.begin(), newCache.end(), v) == newCache.end()) {
+					newCache.push_back(v);
+				}
+			}
+
+			// Rescore every vertex whose cache position changed, including those
+			// pushed out, then every live triangle touching them
+			for (size_t i = 0; i < newCache.size(); ++i) {
+				uint32_t v = newCache[i];
+				cachePosition[v] = (i < FORSYTH_CACHE_SIZE) ? static_cast<int32_t>(i) : -1;
+				vertexScore[v] = VertexScore(cachePosition[v], liveValence[v]);
+			}
+
+			best = INVALID;
+			bestScore = -std::numeric_limits<float>::max();
+			for (uint32_t v : newCache) {
+				uint32_t begin = adjacencyOffsets[v];
+				for (uint32_t a = begin; a < begin + liveValence[v]; ++a) {
+					uint32_t t = adjacency[a];
+					const uint32_t* tri = &indices[t * 3];
+					triangleScore[t] = vertexScore[tri[0]] + vertexScore[tri[1]] + vertexScore[tri[2]];
+					if (triangleScore[t] > bestScore) {
+						bestScore = triangleScore[t];
+						best = t;
+					}
+				}
+			}
+
+			cache.assign(newCache.begin(), newCache.begin() + std::min<size_t>(newCache.size(), FORSYTH_CACHE_SIZE));
+		}
+
+		std::copy(result.begin(), result.end(), indices.begin());
+	}
+
+	void MeshOptimizer::OptimizeOverdraw(std::vector<uint32_t>& indices, std::span<const Vertex> vertices, float threshold) {
+		const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+		if (triangleCount < 2) {
+			return;
+		}
+
+		// Cluster boundaries where the cache is cold anyway (all three vertices
+		// missed), so reordering clusters barely changes ACMR (Sander et al. 2007)
+		std::vector<uint32_t> clusterStarts;
+		SimulateFifo(indices, vertices.size(), ANALYZE_CACHE_SIZE, [&](size_t t, uint32_t misses) {
+			if (t == 0 || misses == 3) {
+				clusterStarts.push_back(static_cast<uint32_t>(t));
+			}
+		});
+		if (clusterStarts.size() < 2) {
+			return;
+		}
+		clusterStarts.push_back(triangleCount);
+
+		// Area-weighted centroid/normal per cluster
+		const size_t clusterCount = clusterStarts.size() - 1;
+		std::vector<glm::vec3> clusterCentroid(clusterCount, glm::vec3(0.0f));
+		std::vector<glm::vec3> clusterNormal(clusterCount, glm::vec3(0.0f));
+		std::vector<float> clusterArea(clusterCount, 0.0f);
+		glm::vec3 meshCentroid(0.0f);
+		float meshArea = 0.0f;
+
+		for (size_t c = 0; c < clusterCount; ++c) {
+			for (uint32_t t = clusterStarts[c]; t < clusterStarts[c + 1]; ++t) {
+				const glm::vec3& p0 = vertices[indices[t * 3]].position;
+				const glm::vec3& p1 = vertices[indices[t * 3 + 1]].position;
+				const glm::vec3& p2 = vertices[indices[t * 3 + 2]].position;
+				glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+				float area = glm::length(n);
+				glm::vec3 centroid = (p0 + p1 + p2) / 3.0f;
+
+				clusterCentroid[c] += centroid * area;
+				clusterNormal[c] += n;
+				clusterArea[c] += area;
+			}
+			meshCentroid += clusterCentroid[c];
+			meshArea += clusterArea[c];
+		}
+		if (meshArea <= 0.0f) {
+			return;
+		}
+		meshCentroid /= meshArea;
+
+		// Clusters facing away from the centre are likely silhouettes that occlude the rest
+		std::vector<float> sortKey(clusterCount, 0.0f);
+		for (size_t c = 0; c < clusterCount; ++c) {
+			float normalLength = glm::length(clusterNormal[c]);
+			if (clusterArea[c] <= 0.0f || normalLength <= 0.0f) continue;
+			glm::vec3 centroid = clusterCentroid[c] / clusterArea[c];
+			sortKey[c] = glm::dot(centroid - meshCentroid, clusterNormal[c] / normalLength);
+		}
+
+		std::vector<uint32_t> order(clusterCount);
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return sortKey[a] > sortKey[b]; });
+
+		std::vector<uint32_t> reordered;
+		reordered.reserve(indices.size());
+		for (uint32_t c : order) {
+			reordered.insert(reordered.end(), indices.begin() + clusterStarts[c] * 3, indices.begin() + clusterStarts[c + 1] * 3);
+		}
+
+		float acmrBefore = AnalyzeVertexCache(indices, vertices.size()).acmr;
+		float acmrAfter = AnalyzeVertexCache(reordered, vertices.size()).acmr;
+		if (acmrAfter > acmrBefore * threshold) {
+			Logger::Debug("MeshOptimizer", "Overdraw ordering rejected (ACMR {:.3f} -> {:.3f})", acmrBefore, acmrAfter);
+			return;
+		}
+		std::copy(reordered.begin(), reordered.end(), indices.begin());
+	}
+
+	void MeshOptimizer::OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+		std::vector<uint32_t> remap(vertices.size(), INVALID);
+		std::vector<Vertex> reordered;
+		reordered.reserve(vertices.size());
+
+		for (uint32_t& index : indices) {
+			if (remap[index] == INVALID) {
+				remap[index] = static_cast<uint32_t>(reordered.size());
+				reordered.push_back(vertices[index]);
+			}
+			index = remap[index];
+		}
+		vertices = std::move(reordered);
+	}
+
+} // namespace AstralEngine
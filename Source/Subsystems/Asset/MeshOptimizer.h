@@ -0,0 +1,76 @@
+#pragma once
+
+#include "AssetData.h"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace AstralEngine {
+
+	/// Post-transform cache efficiency of an index buffer (FIFO simulation)
+	struct VertexCacheStats {
+		float acmr = 0.0f; ///< Average cache misses per triangle (0.5 - 3, lower is better)
+		float atvr = 0.0f; ///< Average transformed vertices per vertex (1.0 is optimal)
+	};
+
+	struct MeshOptimizerSettings {
+		bool vertexCache = true;
+		bool overdraw = true;
+		float overdrawThreshold = 1.05f; ///< Max ACMR growth accepted for overdraw ordering
+		bool meshlets = true;
+		bool vertexFetch = true;
+		uint32_t lodCount = 4;        ///< LODs including the source mesh; 1 disables simplification
+		float lodReduction = 0.5f;    ///< Triangle ratio of each LOD to the previous one
+		float lodMaxError = 0.02f;    ///< Simplification error limit (fraction of mesh extent)
+	};
+
+	struct MeshOptimizationReport {
+		VertexCacheStats before;
+		VertexCacheStats after;
+		size_t vertexCountBefore = 0;
+		size_t vertexCountAfter = 0;
+		size_t lodCount = 0;
+		double timeMs = 0.0;
+	};
+
+	/**
+	 * @class MeshOptimizer
+	 * @brief Import sonrası mesh işleme hattı.
+	 *
+	 * Sıra: LOD zinciri (quadric sadeleştirme), her LOD için vertex cache
+	 * (Forsyth) ve overdraw (küme sıralama), meshlet'ler, vertex fetch (ilk
+	 * kullanım sırasına göre yeniden numaralama). Meshlet
+	 * üretimi üçgen sırasını korumaya çalıştığı için önceki adımların
+	 * kazanımı büyük ölçüde korunur.
+	 */
+	class MeshOptimizer {
+	public:
+		static constexpr uint32_t ANALYZE_CACHE_SIZE = 16;
+
+		// Runs every enabled stage in place; needs owned (non-mapped) data
+		static MeshOptimizationReport Optimize(ModelData& model, const MeshOptimizerSettings& settings = {});
+
+		// Appends simplified copies of every submesh and fills model.lods and the
+		// submeshes' LOD ranges (at most MAX_MESH_LODS levels)
+		static void GenerateLods(ModelData& model, uint32_t lodCount, float reduction, float maxError);
+
+		// Adds a single submesh covering the whole model if it has none
+		static void EnsureSubmesh(ModelData& model);
+
+		// Recomputes each submesh's vertex range from its indices (after renumbering)
+		static void UpdateSubmeshVertexRanges(ModelData& model);
+
+		static VertexCacheStats AnalyzeVertexCache(std::span<const uint32_t> indices, size_t vertexCount,
+												   uint32_t cacheSize = ANALYZE_CACHE_SIZE);
+
+		// Reorders triangles for post-transform cache hits
+		static void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount);
+
+		// Reorders cache-coherent triangle clusters so outward-facing ones draw first
+		static void OptimizeOverdraw(std::vector<uint32_t>& indices, std::span<const Vertex> vertices, float threshold);
+
+		// Renumbers vertices in first-use order and drops unreferenced ones
+		static void OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+	};
+
+} // namespace AstralEngine
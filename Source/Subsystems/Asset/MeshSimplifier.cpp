@@ -0,0 +1,251 @@
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+namespace AstralEngine {
+
+	namespace {
+
+		constexpr uint32_t MAX_PASSES = 64;
+
+		// Sum of squared distances to a set of planes: p^T A p + 2 b.p + c.
+		// Accumulated area-weighted; weight normalizes the result to a mean.
+		struct Quadric {
+			double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+			double b0 = 0, b1 = 0, b2 = 0;
+			double c = 0;
+			double weight = 0;
+
+			void AddPlane(const glm::vec3& n, float d, double w) {
+				a00 += w * n.x * n.x; a01 += w * n.x * n.y; a02 += w * n.x * n.z;
+				a11 += w * n.y * n.y; a12 += w * n.y * n.z; a22 += w * n.z * n.z;
+				b0 += w * n.x * d; b1 += w * n.y * d; b2 += w * n.z * d;
+				c += w * d * d;
+				weight += w;
+			}
+
+			void Add(const Quadric& q) {
+				a00 += q.a00; a01 += q.a01; a02 += q.a02; a11 += q.a11; a12 += q.a12; a22 += q.a22;
+				b0 += q.b0; b1 += q.b1; b2 += q.b2;
+				c += q.c;
+				weight += q.weight;
+			}
+
+			// Mean squared distance of p to the planes
+			double Error(const glm::vec3& p) const {
+				double x = p.x, y = p.y, z = p.z;
+				double r = a00 * x * x + a11 * y * y + a22 * z * z +
+						   2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) +
+						   2.0 * (b0 * x + b1 * y + b2 * z) + c;
+				return weight > 0.0 ? std::abs(r) / weight : 0.0;
+			}
+		};
+
+		struct Collapse {
+			uint32_t from;
+			uint32_t to;
+			double error;
+		};
+
+		struct PositionHash {
+			size_t operator()(const glm::vec3& p) const {
+				uint32_t bits[3];
+				std::memcpy(bits, &p, sizeof(bits));
+				return (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u);
+			}
+		};
+
+		uint64_t EdgeKey(uint32_t a, uint32_t b) {
+			return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+		}
+
+	} // namespace
+
+	std::vector<uint32_t> MeshSimplifier::Simplify(std::span<const Vertex> vertices, std::span<const uint32_t> indices,
+												   size_t targetIndexCount, float targetError, float* resultError) {
+		std::vector<uint32_t> result(indices.begin(), indices.end() - indices.size() % 3);
+		if (resultError) *resultError = 0.0f;
+		if (result.size() <= targetIndexCount || vertices.empty()) {
+			return result;
+		}
+
+		const size_t vertexCount = vertices.size();
+
+		// Vertices sharing a position (attribute seams) form one group
+		std::vector<uint32_t> group(vertexCount);
+		std::vector<uint32_t> groupSize(vertexCount, 0);
+		{
+			std::unordered_map<glm::vec3, uint32_t, PositionHash> firstAt;
+			firstAt.reserve(vertexCount);
+			for (uint32_t v = 0; v < vertexCount; ++v) {
+				auto [it, inserted] = firstAt.emplace(vertices[v].position, v);
+				group[v] = it->second;
+				groupSize[it->second]++;
+			}
+		}
+
+		// Lock seams plus open and non-manifold edges (in position space)
+		std::vector<uint8_t> locked(vertexCount, 0);
+		{
+			std::unordered_map<uint64_t, uint32_t> edgeUse;
+			edgeUse.reserve(result.size());
+			for (size_t i = 0; i < result.size(); i += 3) {
+				for (size_t k = 0; k < 3; ++k) {
+					edgeUse[EdgeKey(group[result[i + k]], group[result[i + (k + 1) % 3]])]++;
+				}
+			}
+			for (const auto& [key, count] : edgeUse) {
+				if (count != 2) {
+					locked[static_cast<uint32_t>(key >> 32)] = 1;
+					locked[static_cast<uint32_t>(key)] = 1;
+				}
+			}
+			for (uint32_t v = 0; v < vertexCount; ++v) {
+				if (groupSize[group[v]] > 1 || locked[group[v]]) {
+					locked[v] = 1;
+				}
+			}
+		}
+
+		std::vector<Quadric> quadrics(vertexCount);
+		AABB bounds;
+		for (size_t i = 0; i < result.size(); i += 3) {
+			const glm::vec3& p0 = vertices[result[i]].position;
+			const glm::vec3& p1 = vertices[result[i + 1]].position;
+			const glm::vec3& p2 = vertices[result[i + 2]].position;
+			glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+			float length = glm::length(n);
+			if (length <= 0.0f) continue;
+			n /= length;
+			float d = -glm::dot(n, p0);
+			for (size_t k = 0; k < 3; ++k) {
+				quadrics[group[result[i + k]]].AddPlane(n, d, 0.5 * length);
+				bounds.Extend(vertices[result[i + k]].position);
+			}
+		}
+
+		const glm::vec3 extent = bounds.IsValid() ? bounds.GetExtent() : glm::vec3(0.0f);
+		const double scale = std::max({ extent.x, extent.y, extent.z, 1e-6f });
+		const double errorLimit = static_cast<double>(targetError) * scale * static_cast<double>(targetError) * scale;
+		double maxError = 0.0;
+
+		std::vector<uint32_t> adjacencyOffsets(vertexCount + 1);
+		std::vector<uint32_t> adjacency;
+		std::vector<uint8_t> touched(vertexCount);
+		std::vector<Collapse> collapses;
+
+		for (uint32_t pass = 0; pass < MAX_PASSES && result.size() > targetIndexCount; ++pass) {
+			const size_t triangleCount = result.size() / 3;
+
+			// Vertex -> triangle adjacency (CSR) for the flip test
+			std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+			for (uint32_t index : result) adjacencyOffsets[index + 1]++;
+			for (size_t i = 1; i < adjacencyOffsets.size(); ++i) adjacencyOffsets[i] += adjacencyOffsets[i - 1];
+			adjacency.resize(result.size());
+			{
+				std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+				for (uint32_t t = 0; t < triangleCount; ++t) {
+					for (uint32_t k = 0; k < 3; ++k) adjacency[cursor[result[t * 3 + k]]++] = t;
+				}
+			}
+
+			// Cheapest direction of every edge; locked vertices only receive
+			collapses.clear();
+			for (size_t i = 0; i < result.size(); i += 3) {
+				for (size_t k = 0; k < 3; ++k) {
+					uint32_t a = result[i + k];
+					uint32_t b = result[i + (k + 1) % 3];
+					if (a > b) continue; // Each interior edge is seen from both triangles
+					if (locked[a] && locked[b]) continue;
+
+					Collapse best{ 0, 0, -1.0 };
+					for (int dir = 0; dir < 2; ++dir) {
+						uint32_t from = dir ? b : a;
+						uint32_t to = dir ? a : b;
+						if (locked[from]) continue;
+						Quadric q = quadrics[group[from]];
+						q.Add(quadrics[group[to]]);
+						double error = q.Error(vertices[to].position);
+						if (best.error < 0.0 || error < best.error) {
+							best = { from, to, error };
+						}
+					}
+					collapses.push_back(best);
+				}
+			}
+			if (collapses.empty()) break;
+
+			std::sort(collapses.begin(), collapses.end(), [](const Collapse& x, const Collapse& y) { return x.error < y.error; });
+
+			std::fill(touched.begin(), touched.end(), 0);
+			const size_t trianglesToRemove = (result.size() - targetIndexCount) / 3 + 1;
+			size_t removed = 0;
+			size_t applied = 0;
+
+			for (const Collapse& collapse : collapses) {
+				if (collapse.error > errorLimit || removed >= trianglesToRemove) break;
+				if (touched[collapse.from] || touched[collapse.to]) continue;
+
+				const glm::vec3& target = vertices[collapse.to].position;
+				const uint32_t targetGroup = group[collapse.to];
+				bool valid = true;
+				size_t degenerate = 0;
+
+				for (uint32_t a = adjacencyOffsets[collapse.from]; a < adjacencyOffsets[collapse.from + 1] && valid; ++a) {
+					const uint32_t* tri = &result[adjacency[a] * 3];
+					if (group[tri[0]] == targetGroup || group[tri[1]] == targetGroup || group[tri[2]] == targetGroup) {
+						degenerate++;
+						continue;
+					}
+					// Reject collapses that flip or nearly flip a remaining triangle
+					glm::vec3 p[3], q[3];
+					for (int k = 0; k < 3; ++k) {
+						p[k] = vertices[tri[k]].position;
+						q[k] = tri[k] == collapse.from ? target : p[k];
+					}
+					glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+					glm::vec3 after = glm::cross(q[1] - q[0], q[2] - q[0]);
+					float lengths = glm::length(before) * glm::length(after);
+					valid = lengths > 0.0f && glm::dot(before, after) > 0.25f * lengths;
+				}
+				if (!valid) continue;
+
+				for (uint32_t a = adjacencyOffsets[collapse.from]; a < adjacencyOffsets[collapse.from + 1]; ++a) {
+					uint32_t* tri = &result[adjacency[a] * 3];
+					for (int k = 0; k < 3; ++k) {
+						if (tri[k] == collapse.from) tri[k] = collapse.to;
+						touched[tri[k]] = 1;
+					}
+				}
+				touched[collapse.from] = 1;
+				touched[collapse.to] = 1;
+				quadrics[group[collapse.to]].Add(quadrics[group[collapse.from]]);
+
+				maxError = std::max(maxError, collapse.error);
+				removed += degenerate;
+				applied++;
+			}
+			if (applied == 0) break;
+
+			// Drop triangles that collapsed to a line or point
+			size_t write = 0;
+			for (size_t i = 0; i < result.size(); i += 3) {
+				uint32_t g0 = group[result[i]], g1 = group[result[i + 1]], g2 = group[result[i + 2]];
+				if (g0 == g1 || g1 == g2 || g0 == g2) continue;
+				result[write++] = result[i];
+				result[write++] = result[i + 1];
+				result[write++] = result[i + 2];
+			}
+			result.resize(write);
+		}
+
+		if (resultError) {
+			*resultError = static_cast<float>(std::sqrt(maxError) / scale);
+		}
+		return result;
+	}
+
+} // namespace AstralEngine
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "AssetData.h"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace AstralEngine {
+
+	/**
+	 * @class MeshSimplifier
+	 * @brief Quadric error metriği ile kenar çökertme (Garland & Heckbert).
+	 *
+	 * Vertex'ler taşınmaz ve yeni vertex üretilmez; bir vertex komşusunun
+	 * üzerine çökertilir. Böylece sonuç, kaynakla aynı vertex buffer'ı
+	 * kullanan yeni bir index listesidir. Açık kenarlar ve UV/normal dikişleri
+	 * (aynı pozisyonda birden fazla vertex) kilitlidir, siluet ve doku
+	 * sürekliliği korunur.
+	 */
+	class MeshSimplifier {
+	public:
+		// Collapses edges until at most targetIndexCount indices remain or the next
+		// collapse would move the surface by more than targetError (fraction of the
+		// mesh extent). resultError receives the error actually introduced.
+		static std::vector<uint32_t> Simplify(std::span<const Vertex> vertices, std::span<const uint32_t> indices,
+											  size_t targetIndexCount, float targetError, float* resultError = nullptr);
+	};
+
+} // namespace AstralEngine
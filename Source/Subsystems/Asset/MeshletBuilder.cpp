@@ -0,0 +1,264 @@
+#include "MeshletBuilder.h"
+#include "../../Core/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace AstralEngine {
+
+	namespace {
+
+		constexpr uint32_t INVALID = std::numeric_limits<uint32_t>::max();
+
+	} // namespace
+
+	void MeshletBuilder::Build(ModelData& model, uint32_t maxVertices, uint32_t maxTriangles) {
+		model.meshlets.clear();
+
+		if (model.mappedStorage || model.vertexFormat != VertexFormat::Standard) {
+			Logger::Warning("MeshletBuilder", "Cannot rebuild meshlets of mapped or packed model '{}'", model.name);
+			return;
+		}
+
+		if (model.indices.size() < 3 || maxVertices < 3 || maxTriangles == 0) {
+			return;
+		}
+		for (uint32_t index : model.indices) {
+			if (index >= model.vertices.size()) {
+				Logger::Error("MeshletBuilder", "Model '{}' has out-of-range index {}", model.name, index);
+				return;
+			}
+		}
+
+		if (!model.submeshes.empty()) {
+			// Meshlets never span submeshes or LODs, so every range culls on its
+			// own; built LOD-major like the index buffer, so each LOD's meshlets
+			// are contiguous too
+			for (uint32_t level = 0; level < model.GetLodCount(); ++level) {
+				uint32_t lodMeshletOffset = static_cast<uint32_t>(model.meshlets.size());
+				for (auto& submesh : model.submeshes) {
+					MeshLod& range = submesh.lods[level];
+					range.meshletOffset = static_cast<uint32_t>(model.meshlets.size());
+					BuildRange(model, range.indexOffset, range.indexCount, maxVertices, maxTriangles);
+					range.meshletCount = static_cast<uint32_t>(model.meshlets.size()) - range.meshletOffset;
+				}
+				if (level < model.lods.size()) {
+					model.lods[level].meshletOffset = lodMeshletOffset;
+					model.lods[level].meshletCount = static_cast<uint32_t>(model.meshlets.size()) - lodMeshletOffset;
+				}
+			}
+		} else if (model.lods.empty()) {
+			// Trailing non-triangle indices are dropped; nothing draws them
+			model.indices.resize(model.indices.size() - model.indices.size() % 3);
+			BuildRange(model, 0, static_cast<uint32_t>(model.indices.size()), maxVertices, maxTriangles);
+		} else {
+			// Each LOD gets its own meshlets so a selected LOD culls as one range
+			for (auto& lod : model.lods) {
+				lod.meshletOffset = static_cast<uint32_t>(model.meshlets.size());
+				BuildRange(model, lod.indexOffset, lod.indexCount, maxVertices, maxTriangles);
+				lod.meshletCount = static_cast<uint32_t>(model.meshlets.size()) - lod.meshletOffset;
+			}
+		}
+
+		for (auto& meshlet : model.meshlets) {
+			ComputeBounds(meshlet, model.vertices, model.indices);
+		}
+
+		const size_t triangleCount = model.indices.size() / 3;
+		Logger::Debug("MeshletBuilder", "Built {} meshlets for '{}' ({} triangles, avg {:.1f} per meshlet)",
+					  model.meshlets.size(), model.name, triangleCount,
+					  static_cast<double>(triangleCount) / std::max<size_t>(model.meshlets.size(), 1));
+	}
+
+	void MeshletBuilder::BuildRange(ModelData& model, uint32_t firstIndex, uint32_t indexCount,
+									uint32_t maxVertices, uint32_t maxTriangles) {
+		const auto& vertices = model.vertices;
+		const std::vector<uint32_t> indices(model.indices.begin() + firstIndex,
+											model.indices.begin() + firstIndex + indexCount);
+		const uint32_t triangleCount = indexCount / 3;
+		if (triangleCount == 0) {
+			return;
+		}
+
+		// Vertex -> triangle adjacency (CSR) to grow meshlets across shared edges
+		std::vector<uint32_t> adjacencyOffsets(vertices.size() + 1, 0);
+		for (uint32_t index : indices) {
+			adjacencyOffsets[index + 1]++;
+		}
+		for (size_t i = 1; i < adjacencyOffsets.size(); ++i) {
+			adjacencyOffsets[i] += adjacencyOffsets[i - 1];
+		}
+		std::vector<uint32_t> adjacency(indices.size());
+		{
+			std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for (uint32_t t = 0; t < triangleCount; ++t) {
+				for (uint32_t k = 0; k < 3; ++k) {
+					adjacency[cursor[indices[t * 3 + k]]++] = t;
+				}
+			}
+		}
+
+		std::vector<uint8_t> emitted(triangleCount, 0);
+		std::vector<uint32_t> vertexMeshlet(vertices.size(), INVALID); // Last meshlet that used each vertex
+		std::vector<uint32_t> meshletVertices;
+		std::vector<uint32_t> reordered;
+		reordered.reserve(indices.size());
+		meshletVertices.reserve(maxVertices);
+
+		uint32_t meshletId = 0;
+		Meshlet current;
+		current.indexOffset = firstIndex;
+
+		// Running centroid of the current meshlet; keeps clusters round so their
+		// bounding spheres stay tight
+		glm::vec3 centroidSum(0.0f);
+
+		auto countNewVertices = [&](uint32_t t) {
+			uint32_t a = indices[t * 3], b = indices[t * 3 + 1], c = indices[t * 3 + 2];
+			uint32_t count = (vertexMeshlet[a] != meshletId) ? 1 : 0;
+			count += (vertexMeshlet[b] != meshletId && b != a) ? 1 : 0;
+			count += (vertexMeshlet[c] != meshletId && c != a && c != b) ? 1 : 0;
+			return count;
+		};
+
+		auto finishMeshlet = [&]() {
+			if (current.triangleCount == 0) return;
+			current.vertexCount = static_cast<uint32_t>(meshletVertices.size());
+			model.meshlets.push_back(current);
+			current = Meshlet{};
+			current.indexOffset = firstIndex + static_cast<uint32_t>(reordered.size());
+			meshletVertices.clear();
+			centroidSum = glm::vec3(0.0f);
+			meshletId++;
+		};
+
+		// Best unemitted triangle touching the given vertices: fewest new
+		// vertices, then closest to the meshlet centroid
+		auto findCandidate = [&](const uint32_t* candidateVertices, size_t count, uint32_t& bestNew) {
+			uint32_t best = INVALID;
+			float bestDistance = std::numeric_limits<float>::max();
+			bestNew = 4;
+			glm::vec3 centroid = centroidSum / static_cast<float>(std::max<size_t>(meshletVertices.size(), 1));
+			for (size_t i = 0; i < count; ++i) {
+				uint32_t v = candidateVertices[i];
+				for (uint32_t a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; ++a) {
+					uint32_t t = adjacency[a];
+					if (emitted[t]) continue;
+					uint32_t newVertices = countNewVertices(t);
+					if (newVertices > bestNew) continue;
+
+					glm::vec3 center = (vertices[indices[t * 3]].position + vertices[indices[t * 3 + 1]].position +
+										vertices[indices[t * 3 + 2]].position) / 3.0f;
+					glm::vec3 offset = center - centroid;
+					float distance = glm::dot(offset, offset);
+					if (newVertices < bestNew || distance < bestDistance) {
+						best = t;
+						bestNew = newVertices;
+						bestDistance = distance;
+					}
+				}
+			}
+			return best;
+		};
+
+		uint32_t scanCursor = 0;
+		uint32_t lastTriangle = INVALID;
+
+		for (uint32_t remaining = triangleCount; remaining > 0; --remaining) {
+			uint32_t bestNew = 4;
+			uint32_t best = INVALID;
+
+			// Neighbours of the last triangle are the cheapest good guess; fall
+			// back to the whole meshlet border
+			if (lastTriangle != INVALID && current.triangleCount > 0) {
+				best = findCandidate(&indices[lastTriangle * 3], 3, bestNew);
+				if (best == INVALID) {
+					best = findCandidate(meshletVertices.data(), meshletVertices.size(), bestNew);
+				}
+			}
+
+			if (best == INVALID) {
+				// Disconnected: start over unless the meshlet is still small, in
+				// which case pack the next piece in to avoid tiny clusters
+				if (current.triangleCount >= maxTriangles / 2) {
+					finishMeshlet();
+				}
+				while (emitted[scanCursor]) scanCursor++;
+				best = scanCursor;
+				bestNew = countNewVertices(best);
+			}
+
+			if (meshletVertices.size() + bestNew > maxVertices || current.triangleCount + 1 > maxTriangles) {
+				finishMeshlet();
+			}
+
+			for (uint32_t k = 0; k < 3; ++k) {
+				uint32_t v = indices[best * 3 + k];
+				if (vertexMeshlet[v] != meshletId) {
+					vertexMeshlet[v] = meshletId;
+					meshletVertices.push_back(v);
+					centroidSum += vertices[v].position;
+				}
+				reordered.push_back(v);
+			}
+			emitted[best] = 1;
+			current.triangleCount++;
+			lastTriangle = best;
+		}
+		finishMeshlet();
+
+		std::copy(reordered.begin(), reordered.end(), model.indices.begin() + firstIndex);
+	}
+
+	void MeshletBuilder::ComputeBounds(Meshlet& meshlet, std::span<const Vertex> vertices, std::span<const uint32_t> indices) {
+		const uint32_t first = meshlet.indexOffset;
+		const uint32_t last = first + meshlet.triangleCount * 3;
+
+		AABB box;
+		for (uint32_t i = first; i < last; ++i) {
+			box.Extend(vertices[indices[i]].position);
+		}
+		meshlet.center = box.GetCenter();
+		float radiusSq = 0.0f;
+		for (uint32_t i = first; i < last; ++i) {
+			glm::vec3 d = vertices[indices[i]].position - meshlet.center;
+			radiusSq = std::max(radiusSq, glm::dot(d, d));
+		}
+		meshlet.radius = std::sqrt(radiusSq);
+
+		// Normal cone from face (winding) normals, which is what back-face culling uses
+		glm::vec3 normalSum(0.0f);
+		for (uint32_t i = first; i < last; i += 3) {
+			const glm::vec3& p0 = vertices[indices[i]].position;
+			glm::vec3 n = glm::cross(vertices[indices[i + 1]].position - p0, vertices[indices[i + 2]].position - p0);
+			float length = glm::length(n);
+			if (length > 0.0f) {
+				normalSum += n / length;
+			}
+		}
+
+		meshlet.coneAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+		meshlet.coneCutoff = 1.0f;
+		float sumLength = glm::length(normalSum);
+		if (sumLength <= 1e-6f) {
+			return;
+		}
+		glm::vec3 axis = normalSum / sumLength;
+
+		float minDot = 1.0f;
+		for (uint32_t i = first; i < last; i += 3) {
+			const glm::vec3& p0 = vertices[indices[i]].position;
+			glm::vec3 n = glm::cross(vertices[indices[i + 1]].position - p0, vertices[indices[i + 2]].position - p0);
+			float length = glm::length(n);
+			if (length > 0.0f) {
+				minDot = std::min(minDot, glm::dot(axis, n / length));
+			}
+		}
+
+		meshlet.coneAxis = axis;
+		// Spread of 90 degrees or more can always face the camera somewhere
+		meshlet.coneCutoff = (minDot <= 0.0f) ? 1.0f : std::sqrt(1.0f - minDot * minDot);
+	}
+
+} // namespace AstralEngine
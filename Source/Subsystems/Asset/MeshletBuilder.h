@@ -0,0 +1,36 @@
+#pragma once
+
+#include "AssetData.h"
+#include <cstdint>
+
+namespace AstralEngine {
+
+	/**
+	 * @class MeshletBuilder
+	 * @brief Model geometrisini küme bazında culling için meshlet'lere böler.
+	 *
+	 * Index buffer meshlet sırasına göre yeniden düzenlenir; böylece her
+	 * meshlet mevcut index buffer içinde ardışık bir aralıktır ve ek GPU
+	 * buffer'ı gerekmez.
+	 */
+	class MeshletBuilder {
+	public:
+		// Limits match common mesh shader meshlet sizes (NVIDIA/AMD guidance)
+		static constexpr uint32_t MAX_VERTICES = 64;
+		static constexpr uint32_t MAX_TRIANGLES = 124;
+
+		// Rebuilds model.meshlets (per submesh and LOD when set) and reorders
+		// model.indices; needs owned (non-mapped) data
+		static void Build(ModelData& model, uint32_t maxVertices = MAX_VERTICES, uint32_t maxTriangles = MAX_TRIANGLES);
+
+		// Bounding sphere and normal cone for triangles [firstIndex, firstIndex + triangleCount * 3)
+		static void ComputeBounds(Meshlet& meshlet, std::span<const Vertex> vertices, std::span<const uint32_t> indices);
+
+	private:
+		// Appends meshlets for indices [firstIndex, firstIndex + indexCount) and
+		// reorders that range in place
+		static void BuildRange(ModelData& model, uint32_t firstIndex, uint32_t indexCount,
+							   uint32_t maxVertices, uint32_t maxTriangles);
+	};
+
+} // namespace AstralEngine
@@ -1,75 +1,315 @@
 #include "ModelImporter.h"
 #include "AssetData.h"
+#include "DerivedDataCache.h"
+#include "MeshCooker.h"
+#include "MeshOptimizer.h"
+#include "VertexQuantizer.h"
 #include "../../Core/Logger.h"
+#include "../../Core/ThreadPool.h"
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <filesystem>
+#include <format>
+#include <fstream>
 
 namespace AstralEngine {
 
-	std::shared_ptr<void> ModelImporter::Import(const std::string& filePath) {
-		Logger::Trace("ModelImporter", "Loading ModelData from file: '{}'", filePath);
+	namespace {
 
-		auto modelData = std::make_shared<ModelData>(filePath);
+		double ElapsedMs(std::chrono::steady_clock::time_point start) {
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
 
-		Assimp::Importer importer;
-		const aiScene* scene = importer.ReadFile(filePath,
-			aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_CalcTangentSpace |
-			aiProcess_GenNormals | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality);
+		// Cache/overdraw/fetch ordering is done by MeshOptimizer on the merged buffer.
+		// Tangents are computed per mesh in ImportSource, in parallel, instead of
+		// by Assimp's single-threaded aiProcess_CalcTangentSpace.
+		constexpr unsigned int IMPORT_FLAGS =
+			aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenNormals | aiProcess_JoinIdenticalVertices;
 
-		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-			Logger::Error("ModelImporter", "Assimp failed to load model '{}': {}", filePath, importer.GetErrorString());
-			return nullptr;
+		// Where one aiMesh lands in the merged buffers (prefix sums of the counts)
+		struct MeshSlice {
+			const aiMesh* mesh;
+			uint32_t vertexOffset;
+			uint32_t indexOffset;
+			uint32_t indexCount;
+		};
+
+		uint32_t CountTriangleIndices(const aiMesh* mesh) {
+			uint32_t count = 0;
+			for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+				count += mesh->mFaces[i].mNumIndices == 3 ? 3 : 0;
+			}
+			return count;
 		}
 
-		// Process all meshes in the scene
-		uint32_t vertexOffset = 0;
-		for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
-			const aiMesh* mesh = scene->mMeshes[i];
-			if (!mesh->HasPositions()) continue;
+		// Per-vertex tangent frame from UV gradients, accumulated over the
+		// triangles and orthogonalized against the normal
+		void ComputeTangents(std::span<Vertex> vertices, std::span<const uint32_t> indices, uint32_t vertexOffset) {
+			std::vector<glm::vec3> bitangents(vertices.size(), glm::vec3(0.0f));
+			for (auto& vertex : vertices) {
+				vertex.tangent = glm::vec3(0.0f);
+			}
+
+			for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+				uint32_t a = indices[i] - vertexOffset, b = indices[i + 1] - vertexOffset, c = indices[i + 2] - vertexOffset;
+				glm::vec3 edge1 = vertices[b].position - vertices[a].position;
+				glm::vec3 edge2 = vertices[c].position - vertices[a].position;
+				glm::vec2 deltaUv1 = vertices[b].texCoord - vertices[a].texCoord;
+				glm::vec2 deltaUv2 = vertices[c].texCoord - vertices[a].texCoord;
+				float determinant = deltaUv1.x * deltaUv2.y - deltaUv2.x * deltaUv1.y;
+				if (std::abs(determinant) < 1e-12f) continue;
+
+				float r = 1.0f / determinant;
+				glm::vec3 tangent = (edge1 * deltaUv2.y - edge2 * deltaUv1.y) * r;
+				glm::vec3 bitangent = (edge2 * deltaUv1.x - edge1 * deltaUv2.x) * r;
+				for (uint32_t v : { a, b, c }) {
+					vertices[v].tangent += tangent;
+					bitangents[v] += bitangent;
+				}
+			}
+
+			for (size_t v = 0; v < vertices.size(); ++v) {
+				Vertex& vertex = vertices[v];
+				const glm::vec3& n = vertex.normal;
+				glm::vec3 t = vertex.tangent - n * glm::dot(n, vertex.tangent);
+				float length = glm::length(t);
+				if (length < 1e-12f) {
+					// No usable UV gradient; any frame around the normal will do
+					t = std::abs(n.x) < 0.9f ? glm::cross(n, glm::vec3(1.0f, 0.0f, 0.0f)) : glm::cross(n, glm::vec3(0.0f, 1.0f, 0.0f));
+					length = glm::length(t);
+					if (length < 1e-12f) continue;
+				}
+				vertex.tangent = t / length;
+				// Keep the UV handedness (mirrored UVs flip the bitangent)
+				glm::vec3 b = glm::cross(n, vertex.tangent);
+				vertex.bitangent = glm::dot(b, bitangents[v]) < 0.0f ? -b : b;
+			}
+		}
+
+		// Fills one slice of the pre-sized buffers; touches nothing shared
+		void ConvertMesh(const MeshSlice& slice, ModelData& model, Submesh& submesh) {
+			const aiMesh* mesh = slice.mesh;
+			Vertex* vertices = model.vertices.data() + slice.vertexOffset;
+			uint32_t* indices = model.indices.data() + slice.indexOffset;
+
+			submesh.materialIndex = mesh->mMaterialIndex;
+			submesh.vertexOffset = slice.vertexOffset;
+			submesh.vertexCount = mesh->mNumVertices;
+			submesh.lods[0].indexOffset = slice.indexOffset;
+			submesh.lods[0].indexCount = slice.indexCount;
 
 			for (unsigned int j = 0; j < mesh->mNumVertices; ++j) {
-				Vertex vertex;
+				Vertex& vertex = vertices[j];
 				vertex.position = { mesh->mVertices[j].x, mesh->mVertices[j].y, mesh->mVertices[j].z };
 				if (mesh->HasNormals()) vertex.normal = { mesh->mNormals[j].x, mesh->mNormals[j].y, mesh->mNormals[j].z };
 				if (mesh->HasTextureCoords(0)) vertex.texCoord = { mesh->mTextureCoords[0][j].x, mesh->mTextureCoords[0][j].y };
-				if (mesh->HasTangentsAndBitangents()) {
-					vertex.tangent = { mesh->mTangents[j].x, mesh->mTangents[j].y, mesh->mTangents[j].z };
-					vertex.bitangent = { mesh->mBitangents[j].x, mesh->mBitangents[j].y, mesh->mBitangents[j].z };
-				}
-				modelData->vertices.push_back(vertex);
+				submesh.bounds.Extend(vertex.position);
 			}
 
+			uint32_t written = 0;
 			for (unsigned int j = 0; j < mesh->mNumFaces; ++j) {
 				const aiFace& face = mesh->mFaces[j];
 				if (face.mNumIndices != 3) continue;
-				for (unsigned int k = 0; k < face.mNumIndices; ++k) {
-					modelData->indices.push_back(face.mIndices[k] + vertexOffset);
+				for (unsigned int k = 0; k < 3; ++k) {
+					indices[written++] = face.mIndices[k] + slice.vertexOffset;
 				}
 			}
 
-			vertexOffset += mesh->mNumVertices;
+			if (mesh->HasNormals() && mesh->HasTextureCoords(0)) {
+				ComputeTangents(std::span<Vertex>(vertices, mesh->mNumVertices),
+								std::span<const uint32_t>(indices, slice.indexCount), slice.vertexOffset);
+			}
+		}
+
+		struct ModelImportSettings {
+			VertexFormat vertexFormat = VertexFormat::Standard;
+		};
+
+		ModelImportSettings ReadImportSettings(const std::string& filePath) {
+			ModelImportSettings settings;
+			nlohmann::json json = DerivedDataCache::ReadImportSettings(filePath);
+			if (json.value("vertexFormat", std::string("standard")) == "packed") {
+				settings.vertexFormat = VertexFormat::Packed;
+			}
+			return settings;
 		}
 
-		if (modelData->vertices.empty()) {
+	} // namespace
+
+	ModelImporter::ModelImporter(const MeshOptimizerSettings& optimizerSettings, ThreadPool* threadPool)
+		: m_optimizerSettings(optimizerSettings), m_threadPool(threadPool) {}
+
+	std::shared_ptr<void> ModelImporter::Import(const std::string& filePath) {
+		// Already-cooked file referenced directly
+		if (std::filesystem::path(filePath).extension() == MeshCooker::EXTENSION) {
+			auto modelData = MeshCooker::Load(filePath);
+			if (!modelData) {
+				Logger::Error("ModelImporter", "Failed to load cooked model '{}'", filePath);
+			}
+			return modelData;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		auto modelData = ImportSource(filePath);
+		if (modelData) {
+			Logger::Info("ModelImporter", "Imported model '{}' with Assimp in {:.2f} ms", modelData->name, ElapsedMs(start));
+		}
+		return modelData;
+	}
+
+	bool ModelImporter::SupportsMemoryImport(const std::string& filePath) const {
+		return std::filesystem::path(filePath).extension() == MeshCooker::EXTENSION;
+	}
+
+	std::shared_ptr<void> ModelImporter::ImportFromMemory(const std::string& filePath, const std::shared_ptr<MappedFile>& data) {
+		auto modelData = MeshCooker::Load(data, filePath);
+		if (!modelData) {
+			Logger::Error("ModelImporter", "Failed to load cooked model '{}'", filePath);
+		}
+		return modelData;
+	}
+
+	bool ModelImporter::SupportsDerivedData(const std::string& filePath) const {
+		return std::filesystem::path(filePath).extension() != MeshCooker::EXTENSION;
+	}
+
+	std::string ModelImporter::GetSettingsKey() const {
+		const auto& opt = m_optimizerSettings;
+		return std::format("assimp:{:x};opt:{:d}{:d}{:d}{:d}:{};lod:{}:{}:{}", IMPORT_FLAGS, opt.vertexCache,
+						   opt.overdraw, opt.meshlets, opt.vertexFetch, opt.overdrawThreshold, opt.lodCount,
+						   opt.lodReduction, opt.lodMaxError);
+	}
+
+	std::vector<std::string> ModelImporter::GetSourceFiles(const std::string& filePath) const {
+		std::vector<std::string> files = { filePath, DerivedDataCache::GetImportSettingsPath(filePath) };
+
+		// A .gltf keeps its geometry in external buffers; editing only the .bin
+		// must still invalidate the cooked mesh
+		std::filesystem::path path(filePath);
+		std::string extension = path.extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+		if (extension != ".gltf") {
+			return files;
+		}
+
+		std::ifstream file(filePath);
+		nlohmann::json gltf = nlohmann::json::parse(file, nullptr, false);
+		if (gltf.is_discarded() || !gltf.contains("buffers") || !gltf["buffers"].is_array()) {
+			return files;
+		}
+		for (const auto& buffer : gltf["buffers"]) {
+			if (!buffer.contains("uri") || !buffer["uri"].is_string()) continue;
+			std::string uri = buffer["uri"].get<std::string>();
+			if (uri.rfind("data:", 0) == 0) continue; // Embedded, already hashed with the .gltf
+			files.push_back((path.parent_path() / uri).string());
+		}
+		return files;
+	}
+
+	bool ModelImporter::WriteDerivedData(const std::shared_ptr<void>& asset, const std::string& cachePath) {
+		auto start = std::chrono::steady_clock::now();
+		const auto& modelData = *std::static_pointer_cast<ModelData>(asset);
+		if (!MeshCooker::Write(modelData, cachePath)) {
+			return false;
+		}
+		Logger::Debug("ModelImporter", "Cooked '{}' in {:.2f} ms", modelData.name, ElapsedMs(start));
+		return true;
+	}
+
+	std::shared_ptr<void> ModelImporter::ReadDerivedBlob(const std::shared_ptr<MappedFile>& blob, const std::string& sourcePath) {
+		auto start = std::chrono::steady_clock::now();
+		auto cooked = MeshCooker::Load(blob, sourcePath);
+		if (!cooked) {
+			return nullptr;
+		}
+		cooked->filePath = sourcePath;
+		cooked->name = std::filesystem::path(sourcePath).filename().string();
+		Logger::Info("ModelImporter", "Loaded cooked model '{}' in {:.2f} ms ({} vertices, {} indices)",
+					 cooked->name, ElapsedMs(start), cooked->GetVertexCount(), cooked->GetIndexCount());
+		return cooked;
+	}
+
+	size_t ModelImporter::GetMemoryUsage(const std::shared_ptr<void>& asset) const {
+		return std::static_pointer_cast<ModelData>(asset)->GetMemoryUsage();
+	}
+
+	std::shared_ptr<ModelData> ModelImporter::ImportSource(const std::string& filePath) {
+		Logger::Trace("ModelImporter", "Loading ModelData from file: '{}'", filePath);
+
+		auto modelData = std::make_shared<ModelData>(filePath);
+
+		Assimp::Importer importer;
+		const aiScene* scene = importer.ReadFile(filePath, IMPORT_FLAGS);
+
+		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+			Logger::Error("ModelImporter", "Assimp failed to load model '{}': {}", filePath, importer.GetErrorString());
+			return nullptr;
+		}
+
+		// Lay every mesh out in the merged buffers up front so each can be
+		// converted independently; meshes without triangles are dropped
+		std::vector<MeshSlice> slices;
+		slices.reserve(scene->mNumMeshes);
+		uint64_t vertexTotal = 0;
+		uint64_t indexTotal = 0;
+		for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+			const aiMesh* mesh = scene->mMeshes[i];
+			if (!mesh->HasPositions()) continue;
+			uint32_t indexCount = CountTriangleIndices(mesh);
+			if (indexCount == 0) continue;
+
+			slices.push_back({ mesh, static_cast<uint32_t>(vertexTotal), static_cast<uint32_t>(indexTotal), indexCount });
+			vertexTotal += mesh->mNumVertices;
+			indexTotal += indexCount;
+		}
+
+		if (slices.empty()) {
 			Logger::Error("ModelImporter", "No valid geometry found in model '{}'", filePath);
 			return nullptr;
 		}
+		if (vertexTotal > UINT32_MAX || indexTotal > UINT32_MAX) {
+			Logger::Error("ModelImporter", "Model '{}' exceeds 32-bit index range", filePath);
+			return nullptr;
+		}
+
+		modelData->vertices.resize(vertexTotal);
+		modelData->indices.resize(indexTotal);
+		modelData->submeshes.resize(slices.size());
 
-		// Calculate the bounding box for the entire model
+		auto convert = [&](size_t i) { ConvertMesh(slices[i], *modelData, modelData->submeshes[i]); };
+		if (m_threadPool && slices.size() > 1) {
+			m_threadPool->ParallelFor(slices.size(), convert);
+		} else {
+			for (size_t i = 0; i < slices.size(); ++i) {
+				convert(i);
+			}
+		}
+
+		// Model bounds from the per-submesh ones
 		AABB boundingBox;
-		for (const auto& vertex : modelData->vertices) {
-			boundingBox.Extend(vertex.position);
+		for (const auto& submesh : modelData->submeshes) {
+			boundingBox.Extend(submesh.bounds.min);
+			boundingBox.Extend(submesh.bounds.max);
 		}
 		modelData->boundingBox = boundingBox;
 
 		modelData->isValid = true;
 		modelData->name = std::filesystem::path(filePath).filename().string();
 
-		Logger::Info("ModelImporter", "Successfully loaded model '{}' ({} vertices, {} indices)", 
-					 modelData->name, modelData->vertices.size(), modelData->indices.size());
+		MeshOptimizer::Optimize(*modelData, m_optimizerSettings);
+		if (ReadImportSettings(filePath).vertexFormat == VertexFormat::Packed) {
+			VertexQuantizer::Pack(*modelData);
+		}
+
+		Logger::Info("ModelImporter", "Successfully loaded model '{}' ({} vertices, {} indices, {} submeshes, {} meshlets, {} LODs)",
+					 modelData->name, modelData->GetVertexCount(), modelData->indices.size(), modelData->submeshes.size(),
+					 modelData->meshlets.size(), modelData->GetLodCount());
 
 		return modelData;
 	}
@@ -1,16 +1,52 @@
 #pragma once
 
 #include "IAssetImporter.h"
+#include "MeshOptimizer.h"
+#include <string>
 
 namespace AstralEngine {
 
+	class ThreadPool;
+
 	/**
 	 * @class ModelImporter
 	 * @brief 3D model dosyalarını (FBX, OBJ, vb.) ModelData'ya dönüştürür.
+	 *
+	 * Türetilmiş veri önbelleğine .amesh formatında yazılır; önbellekten
+	 * okunan modeller mmap ile doğrudan kullanılır. Modelin yanındaki
+	 * "<model>.import.json" dosyası ile sıkıştırılmış vertex formatı seçilebilir:
+	 * { "vertexFormat": "packed" }
+	 *
+	 * Assimp sahnesindeki mesh'ler (vertex dönüşümü, tangent'lar, sınırlar)
+	 * thread pool verilmişse paralel işlenir; çıktı buffer'ları önceden
+	 * boyutlanır ve her mesh kendi aralığına yazar.
 	 */
 	class ModelImporter : public IAssetImporter {
 	public:
+		// threadPool may be the pool the import itself runs on (see ThreadPool::ParallelFor)
+		explicit ModelImporter(const MeshOptimizerSettings& optimizerSettings = {}, ThreadPool* threadPool = nullptr);
+
 		std::shared_ptr<void> Import(const std::string& filePath) override;
+		// Only cooked .amesh files; sources are imported by Assimp from disk
+		bool SupportsMemoryImport(const std::string& filePath) const override;
+		std::shared_ptr<void> ImportFromMemory(const std::string& filePath, const std::shared_ptr<MappedFile>& data) override;
+
+		// Full Assimp import, bypassing any cooked data
+		std::shared_ptr<ModelData> ImportSource(const std::string& filePath);
+
+		bool SupportsDerivedData(const std::string& filePath) const override;
+		uint32_t GetVersion() const override { return 7; } // 2: meshlets, 3: MeshOptimizer, 4: packed vertices, 5: LODs, 6: submeshes, 7: own tangents
+		std::string GetSettingsKey() const override;
+		std::vector<std::string> GetSourceFiles(const std::string& filePath) const override;
+		bool WriteDerivedData(const std::shared_ptr<void>& asset, const std::string& cachePath) override;
+		std::shared_ptr<void> ReadDerivedBlob(const std::shared_ptr<MappedFile>& blob, const std::string& sourcePath) override;
+		bool SupportsDerivedDataReadAhead() const override { return true; }
+
+		size_t GetMemoryUsage(const std::shared_ptr<void>& asset) const override;
+
+	private:
+		MeshOptimizerSettings m_optimizerSettings;
+		ThreadPool* m_threadPool = nullptr;
 	};
 
 } // namespace AstralEngine
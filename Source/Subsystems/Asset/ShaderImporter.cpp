@@ -2,6 +2,7 @@
 #include "AssetData.h"
 #include "../../Core/Logger.h"
 
+#include <cstring>
 #include <fstream>
 #include <filesystem>
 
@@ -43,4 +44,39 @@ namespace AstralEngine {
 		return shaderData;
 	}
 
+	std::shared_ptr<void> ShaderImporter::ImportFromMemory(const std::string& filePath, const std::shared_ptr<MappedFile>& data) {
+		if (data->GetSize() == 0) {
+			Logger::Error("ShaderImporter", "Shader file is empty: '{}'", filePath);
+			return nullptr;
+		}
+		// The file holds the SPIR-V words as is, like a packed blob
+		return ReadDerivedBlob(data, filePath);
+	}
+
+	bool ShaderImporter::WriteDerivedData(const std::shared_ptr<void>& asset, const std::string& cachePath) {
+		const auto& shaderData = *std::static_pointer_cast<ShaderData>(asset);
+		std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(shaderData.spirvCode.data()),
+				   shaderData.spirvCode.size() * sizeof(uint32_t));
+		return file.good();
+	}
+
+	std::shared_ptr<void> ShaderImporter::ReadDerivedBlob(const std::shared_ptr<MappedFile>& blob, const std::string& sourcePath) {
+		if (blob->GetSize() % sizeof(uint32_t) != 0) {
+			Logger::Error("ShaderImporter", "SPIR-V blob size is not a multiple of 4 bytes: '{}'", sourcePath);
+			return nullptr;
+		}
+
+		auto shaderData = std::make_shared<ShaderData>(sourcePath);
+		shaderData->spirvCode.resize(blob->GetSize() / sizeof(uint32_t));
+		std::memcpy(shaderData->spirvCode.data(), blob->GetData(), blob->GetSize());
+		shaderData->isValid = true;
+		shaderData->name = std::filesystem::path(sourcePath).filename().string();
+		return shaderData;
+	}
+
+	size_t ShaderImporter::GetMemoryUsage(const std::shared_ptr<void>& asset) const {
+		return std::static_pointer_cast<ShaderData>(asset)->GetMemoryUsage();
+	}
+
 } // namespace AstralEngine
@@ -11,6 +11,13 @@ namespace AstralEngine {
 	class ShaderImporter : public IAssetImporter {
 	public:
 		std::shared_ptr<void> Import(const std::string& filePath) override;
+		bool SupportsMemoryImport(const std::string& filePath) const override { return true; }
+		std::shared_ptr<void> ImportFromMemory(const std::string& filePath, const std::shared_ptr<MappedFile>& data) override;
+		// SPIR-V is already the runtime format, so the derived data cache is not
+		// used; these only serve packed archives, which store the words as is
+		bool WriteDerivedData(const std::shared_ptr<void>& asset, const std::string& cachePath) override;
+		std::shared_ptr<void> ReadDerivedBlob(const std::shared_ptr<MappedFile>& blob, const std::string& sourcePath) override;
+		size_t GetMemoryUsage(const std::shared_ptr<void>& asset) const override;
 	};
 
 } // namespace AstralEngine
@@ -0,0 +1,338 @@
+#include "TextureContainer.h"
+#include "BlockCompressor.h"
+#include "TextureCooker.h"
+#include "../../Core/Logger.h"
+#include "../../Core/MappedFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+namespace AstralEngine {
+
+	namespace {
+
+		constexpr uint8_t KTX2_IDENTIFIER[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+		constexpr size_t KTX2_LEVEL_INDEX_OFFSET = 80;
+
+		constexpr uint32_t DDS_MAGIC = 0x20534444; // "DDS "
+		constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+		constexpr uint32_t DDPF_FOURCC = 0x4;
+		constexpr uint32_t DDPF_RGB = 0x40;
+		constexpr uint32_t DDSCAPS2_CUBEMAP = 0x200;
+		constexpr uint32_t DDSCAPS2_VOLUME = 0x200000;
+		constexpr uint32_t DDS_RESOURCE_MISC_TEXTURECUBE = 0x4;
+		constexpr uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+
+		constexpr uint32_t FourCC(char a, char b, char c, char d) {
+			return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) | (static_cast<uint32_t>(c) << 16) |
+				   (static_cast<uint32_t>(d) << 24);
+		}
+
+		struct DDSPixelFormat {
+			uint32_t size;
+			uint32_t flags;
+			uint32_t fourCC;
+			uint32_t rgbBitCount;
+			uint32_t rBitMask;
+			uint32_t gBitMask;
+			uint32_t bBitMask;
+			uint32_t aBitMask;
+		};
+
+		struct DDSHeader {
+			uint32_t size;
+			uint32_t flags;
+			uint32_t height;
+			uint32_t width;
+			uint32_t pitchOrLinearSize;
+			uint32_t depth;
+			uint32_t mipMapCount;
+			uint32_t reserved1[11];
+			DDSPixelFormat pixelFormat;
+			uint32_t caps;
+			uint32_t caps2;
+			uint32_t caps3;
+			uint32_t caps4;
+			uint32_t reserved2;
+		};
+
+		struct DDSHeaderDX10 {
+			uint32_t dxgiFormat;
+			uint32_t resourceDimension;
+			uint32_t miscFlag;
+			uint32_t arraySize;
+			uint32_t miscFlags2;
+		};
+
+		struct KTX2Header {
+			uint8_t identifier[12];
+			uint32_t vkFormat;
+			uint32_t typeSize;
+			uint32_t pixelWidth;
+			uint32_t pixelHeight;
+			uint32_t pixelDepth;
+			uint32_t layerCount;
+			uint32_t faceCount;
+			uint32_t levelCount;
+			uint32_t supercompressionScheme;
+		};
+
+		struct KTX2LevelIndex {
+			uint64_t byteOffset;
+			uint64_t byteLength;
+			uint64_t uncompressedByteLength;
+		};
+
+		static_assert(sizeof(DDSHeader) == 124, "DDS header layout");
+		static_assert(sizeof(KTX2Header) == 48, "KTX2 header layout");
+
+		struct ContainerFormat {
+			TextureCompression compression = TextureCompression::None;
+			bool isSRGB = false;
+			bool isHDR = false;
+		};
+
+		// VkFormat values, so the asset layer does not need the Vulkan headers
+		bool FromVkFormat(uint32_t vkFormat, ContainerFormat& format) {
+			switch (vkFormat) {
+				case 37: format = { TextureCompression::None, false, false }; return true;  // R8G8B8A8_UNORM
+				case 43: format = { TextureCompression::None, true, false }; return true;   // R8G8B8A8_SRGB
+				case 109: format = { TextureCompression::None, false, true }; return true;  // R32G32B32A32_SFLOAT
+				case 133: format = { TextureCompression::BC1, false, false }; return true;  // BC1_RGBA_UNORM_BLOCK
+				case 134: format = { TextureCompression::BC1, true, false }; return true;   // BC1_RGBA_SRGB_BLOCK
+				case 137: format = { TextureCompression::BC3, false, false }; return true;  // BC3_UNORM_BLOCK
+				case 138: format = { TextureCompression::BC3, true, false }; return true;   // BC3_SRGB_BLOCK
+				case 141: format = { TextureCompression::BC5, false, false }; return true;  // BC5_UNORM_BLOCK
+				case 143: format = { TextureCompression::BC6H, false, true }; return true;  // BC6H_UFLOAT_BLOCK
+				case 145: format = { TextureCompression::BC7, false, false }; return true;  // BC7_UNORM_BLOCK
+				case 146: format = { TextureCompression::BC7, true, false }; return true;   // BC7_SRGB_BLOCK
+				default: return false;
+			}
+		}
+
+		bool FromDxgiFormat(uint32_t dxgiFormat, ContainerFormat& format) {
+			switch (dxgiFormat) {
+				case 2: format = { TextureCompression::None, false, true }; return true;   // R32G32B32A32_FLOAT
+				case 28: format = { TextureCompression::None, false, false }; return true; // R8G8B8A8_UNORM
+				case 29: format = { TextureCompression::None, true, false }; return true;  // R8G8B8A8_UNORM_SRGB
+				case 71: format = { TextureCompression::BC1, false, false }; return true;  // BC1_UNORM
+				case 72: format = { TextureCompression::BC1, true, false }; return true;   // BC1_UNORM_SRGB
+				case 77: format = { TextureCompression::BC3, false, false }; return true;  // BC3_UNORM
+				case 78: format = { TextureCompression::BC3, true, false }; return true;   // BC3_UNORM_SRGB
+				case 83: format = { TextureCompression::BC5, false, false }; return true;  // BC5_UNORM
+				case 95: format = { TextureCompression::BC6H, false, true }; return true;  // BC6H_UF16
+				case 98: format = { TextureCompression::BC7, false, false }; return true;  // BC7_UNORM
+				case 99: format = { TextureCompression::BC7, true, false }; return true;   // BC7_UNORM_SRGB
+				default: return false;
+			}
+		}
+
+		// Pre-DX10 files do not say whether color is sRGB; go by the texture's usage
+		bool FromLegacyPixelFormat(const DDSPixelFormat& pixelFormat, const std::string& filePath, ContainerFormat& format) {
+			const bool color = TextureCooker::GuessUsage(filePath, false) == TextureUsage::Albedo;
+			if (pixelFormat.flags & DDPF_FOURCC) {
+				switch (pixelFormat.fourCC) {
+					case FourCC('D', 'X', 'T', '1'): format = { TextureCompression::BC1, color, false }; return true;
+					case FourCC('D', 'X', 'T', '5'): format = { TextureCompression::BC3, color, false }; return true;
+					case FourCC('A', 'T', 'I', '2'):
+					case FourCC('B', 'C', '5', 'U'): format = { TextureCompression::BC5, false, false }; return true;
+					case 116: format = { TextureCompression::None, false, true }; return true; // D3DFMT_A32B32G32R32F
+					default: return false;
+				}
+			}
+			if ((pixelFormat.flags & DDPF_RGB) && pixelFormat.rgbBitCount == 32 && pixelFormat.rBitMask == 0x000000FF &&
+				pixelFormat.gBitMask == 0x0000FF00 && pixelFormat.bBitMask == 0x00FF0000) {
+				format = { TextureCompression::None, color, false };
+				return true;
+			}
+			return false;
+		}
+
+		uint64_t GetLevelSize(const ContainerFormat& format, uint32_t width, uint32_t height) {
+			if (format.compression != TextureCompression::None) {
+				return BlockCompressor::GetCompressedSize(format.compression, width, height);
+			}
+			return static_cast<uint64_t>(width) * height * (format.isHDR ? 16 : 4);
+		}
+
+		// Wraps the mapping; mip offsets are file offsets since data is the file start
+		std::shared_ptr<TextureData> CreateMappedTexture(const std::string& filePath, std::shared_ptr<MappedFile> file,
+														 const ContainerFormat& format, uint32_t width, uint32_t height,
+														 std::vector<TextureMip> mips) {
+			// Tail first, so the levels streaming wants first arrive first
+			for (auto it = mips.rbegin(); it != mips.rend(); ++it) {
+				file->Prefetch(it->offset, it->size);
+			}
+
+			auto textureData = std::make_shared<TextureData>(filePath);
+			textureData->data = const_cast<uint8_t*>(file->GetData());
+			textureData->dataSize = file->GetSize();
+			textureData->width = width;
+			textureData->height = height;
+			textureData->channels = 4;
+			textureData->bytesPerChannel = format.isHDR ? 4 : 1;
+			textureData->isHDR = format.isHDR;
+			textureData->isSRGB = format.isSRGB;
+			textureData->compression = format.compression;
+			textureData->mips = std::move(mips);
+			textureData->storage = std::move(file);
+			textureData->isValid = true;
+			textureData->name = std::filesystem::path(filePath).filename().string();
+			return textureData;
+		}
+
+	} // namespace
+
+	bool TextureContainer::IsContainer(const std::string& filePath) {
+		std::string extension = std::filesystem::path(filePath).extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+		return extension == ".ktx2" || extension == ".dds";
+	}
+
+	std::shared_ptr<TextureData> TextureContainer::Load(const std::string& filePath) {
+		std::string extension = std::filesystem::path(filePath).extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+		return extension == ".ktx2" ? LoadKTX2(filePath) : LoadDDS(filePath);
+	}
+
+	std::shared_ptr<TextureData> TextureContainer::LoadKTX2(const std::string& filePath) {
+		auto file = MappedFile::Open(filePath, false);
+		if (!file) {
+			Logger::Error("TextureContainer", "Failed to open '{}'", filePath);
+			return nullptr;
+		}
+
+		const uint8_t* base = file->GetData();
+		const size_t size = file->GetSize();
+		if (size < KTX2_LEVEL_INDEX_OFFSET || std::memcmp(base, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) != 0) {
+			Logger::Error("TextureContainer", "'{}' is not a KTX2 file", filePath);
+			return nullptr;
+		}
+		KTX2Header header;
+		std::memcpy(&header, base, sizeof(header));
+
+		ContainerFormat format;
+		if (!FromVkFormat(header.vkFormat, format)) {
+			Logger::Error("TextureContainer", "KTX2 '{}' uses unsupported VkFormat {}", filePath, header.vkFormat);
+			return nullptr;
+		}
+		if (header.supercompressionScheme != 0) {
+			Logger::Error("TextureContainer", "KTX2 '{}' is supercompressed (scheme {}), which is not supported",
+						  filePath, header.supercompressionScheme);
+			return nullptr;
+		}
+		if (header.pixelWidth == 0 || header.pixelHeight == 0 || header.pixelDepth > 1 || header.layerCount > 1 ||
+			header.faceCount != 1) {
+			Logger::Error("TextureContainer", "KTX2 '{}' is not a single 2D texture", filePath);
+			return nullptr;
+		}
+
+		// levelCount 0 asks the loader to generate mips; we upload the base only
+		const uint32_t levelCount = std::max(header.levelCount, 1u);
+		if (header.pixelWidth > MAX_TEXTURE_DIMENSION || header.pixelHeight > MAX_TEXTURE_DIMENSION ||
+			levelCount > MAX_TEXTURE_MIPS) {
+			Logger::Error("TextureContainer", "KTX2 '{}' is {}x{} with {} levels, larger than supported", filePath,
+						  header.pixelWidth, header.pixelHeight, levelCount);
+			return nullptr;
+		}
+		if (!MappedFile::RangeFits(KTX2_LEVEL_INDEX_OFFSET, levelCount, sizeof(KTX2LevelIndex), size)) {
+			Logger::Error("TextureContainer", "KTX2 '{}' is truncated", filePath);
+			return nullptr;
+		}
+
+		std::vector<TextureMip> mips(levelCount);
+		for (uint32_t level = 0; level < levelCount; ++level) {
+			KTX2LevelIndex index;
+			std::memcpy(&index, base + KTX2_LEVEL_INDEX_OFFSET + sizeof(KTX2LevelIndex) * level, sizeof(index));
+			TextureMip& mip = mips[level];
+			mip.width = std::max(header.pixelWidth >> level, 1u);
+			mip.height = std::max(header.pixelHeight >> level, 1u);
+			mip.offset = index.byteOffset;
+			mip.size = index.byteLength;
+			if (mip.size != GetLevelSize(format, mip.width, mip.height) || !MappedFile::RangeFits(mip.offset, mip.size, 1, size)) {
+				Logger::Error("TextureContainer", "KTX2 '{}' has an invalid level {}", filePath, level);
+				return nullptr;
+			}
+		}
+
+		return CreateMappedTexture(filePath, std::move(file), format, header.pixelWidth, header.pixelHeight, std::move(mips));
+	}
+
+	std::shared_ptr<TextureData> TextureContainer::LoadDDS(const std::string& filePath) {
+		auto file = MappedFile::Open(filePath, false);
+		if (!file) {
+			Logger::Error("TextureContainer", "Failed to open '{}'", filePath);
+			return nullptr;
+		}
+
+		const uint8_t* base = file->GetData();
+		const size_t size = file->GetSize();
+		uint32_t magic = 0;
+		if (size >= sizeof(magic) + sizeof(DDSHeader)) {
+			std::memcpy(&magic, base, sizeof(magic));
+		}
+		if (magic != DDS_MAGIC) {
+			Logger::Error("TextureContainer", "'{}' is not a DDS file", filePath);
+			return nullptr;
+		}
+		DDSHeader header;
+		std::memcpy(&header, base + sizeof(magic), sizeof(header));
+		uint64_t dataOffset = sizeof(magic) + sizeof(header);
+
+		ContainerFormat format;
+		bool supported = false;
+		if ((header.pixelFormat.flags & DDPF_FOURCC) && header.pixelFormat.fourCC == FourCC('D', 'X', '1', '0')) {
+			DDSHeaderDX10 extension;
+			if (size < dataOffset + sizeof(extension)) {
+				Logger::Error("TextureContainer", "DDS '{}' is truncated", filePath);
+				return nullptr;
+			}
+			std::memcpy(&extension, base + dataOffset, sizeof(extension));
+			dataOffset += sizeof(extension);
+			if (extension.resourceDimension != DDS_DIMENSION_TEXTURE2D || extension.arraySize > 1 ||
+				(extension.miscFlag & DDS_RESOURCE_MISC_TEXTURECUBE)) {
+				Logger::Error("TextureContainer", "DDS '{}' is not a single 2D texture", filePath);
+				return nullptr;
+			}
+			supported = FromDxgiFormat(extension.dxgiFormat, format);
+		} else {
+			supported = FromLegacyPixelFormat(header.pixelFormat, filePath, format);
+		}
+		if (!supported) {
+			Logger::Error("TextureContainer", "DDS '{}' uses an unsupported pixel format", filePath);
+			return nullptr;
+		}
+		if (header.width == 0 || header.height == 0 || (header.caps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME))) {
+			Logger::Error("TextureContainer", "DDS '{}' is not a single 2D texture", filePath);
+			return nullptr;
+		}
+
+		const uint32_t levelCount = (header.flags & DDSD_MIPMAPCOUNT) ? std::max(header.mipMapCount, 1u) : 1u;
+		if (header.width > MAX_TEXTURE_DIMENSION || header.height > MAX_TEXTURE_DIMENSION || levelCount > MAX_TEXTURE_MIPS) {
+			Logger::Error("TextureContainer", "DDS '{}' is {}x{} with {} levels, larger than supported", filePath,
+						  header.width, header.height, levelCount);
+			return nullptr;
+		}
+
+		// Levels follow the header largest first, tightly packed
+		std::vector<TextureMip> mips(levelCount);
+		uint64_t offset = dataOffset;
+		for (uint32_t level = 0; level < levelCount; ++level) {
+			TextureMip& mip = mips[level];
+			mip.width = std::max(header.width >> level, 1u);
+			mip.height = std::max(header.height >> level, 1u);
+			mip.offset = offset;
+			mip.size = GetLevelSize(format, mip.width, mip.height);
+			if (!MappedFile::RangeFits(mip.offset, mip.size, 1, size)) {
+				Logger::Error("TextureContainer", "DDS '{}' is truncated", filePath);
+				return nullptr;
+			}
+			offset += mip.size;
+		}
+
+		return CreateMappedTexture(filePath, std::move(file), format, header.width, header.height, std::move(mips));
+	}
+
+} // namespace AstralEngine
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "AssetData.h"
+#include <memory>
+#include <string>
+
+namespace AstralEngine {
+
+	/**
+	 * @class TextureContainer
+	 * @brief Önceden sıkıştırılmış KTX2 ve DDS dosyalarını decode etmeden yükler.
+	 *
+	 * Dosya map edilir ve mip seviyeleri yerinde kullanılır; GPU'ya yüklerken
+	 * tek kopya staging buffer'a yapılır. KTX2 seviyeleri dosyada zaten en
+	 * küçükten büyüğe sıralıdır. Yalnızca RHIFormat karşılığı olan 2D
+	 * formatlar (BC1/3/5/6H/7, RGBA8, RGBA32F) ve süper sıkıştırmasız KTX2
+	 * desteklenir.
+	 */
+	class TextureContainer {
+	public:
+		static bool IsContainer(const std::string& filePath); // .ktx2 or .dds
+
+		// Returns nullptr (and logs why) for unsupported or malformed files
+		static std::shared_ptr<TextureData> Load(const std::string& filePath);
+		static std::shared_ptr<TextureData> LoadKTX2(const std::string& filePath);
+		static std::shared_ptr<TextureData> LoadDDS(const std::string& filePath);
+	};
+
+} // namespace AstralEngine
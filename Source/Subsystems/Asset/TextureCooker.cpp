@@ -0,0 +1,435 @@
+#include "TextureCooker.h"
+#include "BlockCompressor.h"
+#include "../../Core/Logger.h"
+#include "../../Core/MappedFile.h"
+#include "../../Core/ThreadPool.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace AstralEngine {
+
+	namespace {
+
+		constexpr size_t LINEAR_TO_SRGB_STEPS = 4096;
+
+		static_assert(std::is_trivially_copyable_v<TextureMip>, "Mips are stored in cooked files");
+
+		const std::array<float, 256>& GetSrgbToLinearTable() {
+			static const std::array<float, 256> table = [] {
+				std::array<float, 256> result{};
+				for (size_t i = 0; i < result.size(); ++i) {
+					float c = static_cast<float>(i) / 255.0f;
+					result[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+				}
+				return result;
+			}();
+			return table;
+		}
+
+		const std::array<uint8_t, LINEAR_TO_SRGB_STEPS>& GetLinearToSrgbTable() {
+			static const std::array<uint8_t, LINEAR_TO_SRGB_STEPS> table = [] {
+				std::array<uint8_t, LINEAR_TO_SRGB_STEPS> result{};
+				for (size_t i = 0; i < result.size(); ++i) {
+					float c = static_cast<float>(i) / (LINEAR_TO_SRGB_STEPS - 1);
+					float s = c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+					result[i] = static_cast<uint8_t>(std::lround(std::clamp(s, 0.0f, 1.0f) * 255.0f));
+				}
+				return result;
+			}();
+			return table;
+		}
+
+		uint8_t ToUnorm8(float value) {
+			return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+		}
+
+		// Splits rows across the pool; small levels are not worth the hand-off
+		void ForEachRow(ThreadPool* threadPool, uint32_t rows, const std::function<void(size_t)>& function) {
+			if (threadPool && rows >= 64) {
+				threadPool->ParallelFor(rows, function);
+				return;
+			}
+			for (uint32_t y = 0; y < rows; ++y) {
+				function(y);
+			}
+		}
+
+		// 2x2 box filter over linear RGBA floats; odd edges reuse the last texel
+		void Downsample(const std::vector<float>& source, uint32_t width, uint32_t height, std::vector<float>& target,
+						uint32_t targetWidth, uint32_t targetHeight, bool renormalize, ThreadPool* threadPool) {
+			target.resize(static_cast<size_t>(targetWidth) * targetHeight * 4);
+			ForEachRow(threadPool, targetHeight, [&](size_t y) {
+				const float* row0 = &source[std::min<size_t>(y * 2, height - 1) * width * 4];
+				const float* row1 = &source[std::min<size_t>(y * 2 + 1, height - 1) * width * 4];
+				float* out = &target[y * targetWidth * 4];
+				for (uint32_t x = 0; x < targetWidth; ++x) {
+					size_t x0 = std::min<size_t>(x * 2, width - 1) * 4;
+					size_t x1 = std::min<size_t>(x * 2 + 1, width - 1) * 4;
+					for (size_t c = 0; c < 4; ++c) {
+						out[x * 4 + c] = 0.25f * (row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c]);
+					}
+				}
+				if (!renormalize) {
+					return;
+				}
+				// Averaged normals shorten; keep them unit length so lighting does
+				// not darken at a distance
+				for (uint32_t x = 0; x < targetWidth; ++x) {
+					float* n = &out[x * 4];
+					float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+					if (length > 1e-6f) {
+						n[0] /= length;
+						n[1] /= length;
+						n[2] /= length;
+					} else {
+						n[0] = 0.0f;
+						n[1] = 0.0f;
+						n[2] = 1.0f;
+					}
+				}
+			});
+		}
+
+		// Linear working values back to the 8-bit texel encoding of the usage
+		void StoreLevel(const std::vector<float>& level, TextureUsage usage, std::vector<uint8_t>& out,
+						uint32_t width, uint32_t height, ThreadPool* threadPool) {
+			out.resize(level.size());
+			const auto& toSrgb = GetLinearToSrgbTable();
+			ForEachRow(threadPool, height, [&](size_t y) {
+				const size_t begin = y * width * 4;
+				const size_t end = begin + static_cast<size_t>(width) * 4;
+				for (size_t i = begin; i < end; i += 4) {
+					for (size_t c = 0; c < 3; ++c) {
+						float value = level[i + c];
+						if (usage == TextureUsage::Albedo) {
+							size_t index = static_cast<size_t>(std::clamp(value, 0.0f, 1.0f) * (LINEAR_TO_SRGB_STEPS - 1) + 0.5f);
+							out[i + c] = toSrgb[index];
+						} else if (usage == TextureUsage::Normal) {
+							out[i + c] = ToUnorm8(value * 0.5f + 0.5f);
+						} else {
+							out[i + c] = ToUnorm8(value);
+						}
+					}
+					out[i + 3] = ToUnorm8(level[i + 3]); // Alpha is always linear
+				}
+			});
+		}
+
+		std::string ToLower(std::string text) {
+			std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+			return text;
+		}
+
+		double ElapsedMs(std::chrono::steady_clock::time_point start) {
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+	} // namespace
+
+	TextureCompression TextureCooker::GetDefaultCompression(TextureUsage usage) {
+		switch (usage) {
+			case TextureUsage::Normal: return TextureCompression::BC5;
+			case TextureUsage::HDR: return TextureCompression::BC6H;
+			default: return TextureCompression::BC7;
+		}
+	}
+
+	TextureUsage TextureCooker::GuessUsage(const std::string& filePath, bool isHDR) {
+		if (isHDR) {
+			return TextureUsage::HDR;
+		}
+		std::string stem = ToLower(std::filesystem::path(filePath).stem().string());
+		auto contains = [&](const char* word) { return stem.find(word) != std::string::npos; };
+
+		// Short suffixes only count as whole words ("_n", "-orm"), so "storm" stays albedo
+		std::vector<std::string> words(1);
+		for (char c : stem) {
+			if (std::isalnum(static_cast<unsigned char>(c))) {
+				words.back() += c;
+			} else if (!words.back().empty()) {
+				words.emplace_back();
+			}
+		}
+		auto hasWord = [&](std::initializer_list<const char*> candidates) {
+			for (const char* candidate : candidates) {
+				if (std::find(words.begin(), words.end(), candidate) != words.end()) return true;
+			}
+			return false;
+		};
+
+		if (contains("normal") || hasWord({ "n", "nrm", "nor" })) {
+			return TextureUsage::Normal;
+		}
+		if (contains("roughness") || contains("metallic") || contains("metalness") || contains("occlusion") ||
+			hasWord({ "orm", "rma", "arm", "ao", "rough", "metal" })) {
+			return TextureUsage::ORM;
+		}
+		return TextureUsage::Albedo;
+	}
+
+	bool TextureCooker::Cook(TextureData& texture, const TextureCookSettings& settings, ThreadPool* threadPool) {
+		auto start = std::chrono::steady_clock::now();
+		const bool hdr = texture.isHDR;
+		const uint32_t expectedBytesPerChannel = hdr ? 4 : 1;
+		if (!texture.IsValid() || texture.compression != TextureCompression::None || !texture.mips.empty() ||
+			texture.channels != 4 || texture.bytesPerChannel != expectedBytesPerChannel) {
+			Logger::Error("TextureCooker", "Texture '{}' is not a single-level RGBA image", texture.name);
+			return false;
+		}
+
+		// BC6H is the only float format; everything else encodes 8-bit texels
+		TextureUsage usage = settings.usage;
+		if (hdr) {
+			usage = TextureUsage::HDR;
+		} else if (usage == TextureUsage::HDR) {
+			usage = TextureUsage::Albedo;
+		}
+		TextureCompression compression = settings.compression;
+		if (hdr && compression != TextureCompression::None && compression != TextureCompression::BC6H) {
+			compression = TextureCompression::BC6H;
+		} else if (!hdr && compression == TextureCompression::BC6H) {
+			Logger::Warning("TextureCooker", "BC6H needs HDR input, using BC7 for '{}'", texture.name);
+			compression = TextureCompression::BC7;
+		}
+
+		const uint32_t width = texture.width;
+		const uint32_t height = texture.height;
+		const uint32_t mipCount = settings.generateMips
+			? static_cast<uint32_t>(std::floor(std::log2(static_cast<double>(std::max(width, height))))) + 1
+			: 1;
+
+		// Nothing to filter or encode: keep the decoded buffer as is, so it
+		// reaches the staging buffer without another copy
+		if (compression == TextureCompression::None && mipCount == 1) {
+			texture.isSRGB = usage == TextureUsage::Albedo;
+			Logger::Debug("TextureCooker", "Kept '{}' ({}x{}) uncompressed without mips", texture.name, width, height);
+			return true;
+		}
+
+		// Level 0 in linear float; the source buffer is released once converted
+		std::vector<float> level(static_cast<size_t>(width) * height * 4);
+		if (hdr) {
+			std::memcpy(level.data(), texture.data, level.size() * sizeof(float));
+		} else {
+			const auto& toLinear = GetSrgbToLinearTable();
+			const uint8_t* pixels = static_cast<const uint8_t*>(texture.data);
+			ForEachRow(threadPool, height, [&](size_t y) {
+				const size_t begin = y * width * 4;
+				const size_t end = begin + static_cast<size_t>(width) * 4;
+				for (size_t i = begin; i < end; i += 4) {
+					for (size_t c = 0; c < 3; ++c) {
+						if (usage == TextureUsage::Albedo) {
+							level[i + c] = toLinear[pixels[i + c]];
+						} else if (usage == TextureUsage::Normal) {
+							level[i + c] = pixels[i + c] * (2.0f / 255.0f) - 1.0f;
+						} else {
+							level[i + c] = pixels[i + c] * (1.0f / 255.0f);
+						}
+					}
+					level[i + 3] = pixels[i + 3] * (1.0f / 255.0f);
+				}
+			});
+		}
+
+		std::vector<TextureMip> mips(mipCount);
+		uint64_t totalSize = 0;
+		for (uint32_t i = 0; i < mipCount; ++i) {
+			mips[i].width = std::max(width >> i, 1u);
+			mips[i].height = std::max(height >> i, 1u);
+			mips[i].offset = totalSize;
+			mips[i].size = compression == TextureCompression::None
+				? static_cast<uint64_t>(mips[i].width) * mips[i].height * 4 * expectedBytesPerChannel
+				: BlockCompressor::GetCompressedSize(compression, mips[i].width, mips[i].height);
+			totalSize += mips[i].size;
+		}
+
+		const size_t sourceSize = texture.dataSize;
+		if (!texture.AllocateBytes(width, height, 4, totalSize)) {
+			Logger::Error("TextureCooker", "Failed to allocate {} bytes for cooked texture '{}'", totalSize, texture.name);
+			return false;
+		}
+		uint8_t* chain = static_cast<uint8_t*>(texture.data);
+
+		std::vector<float> nextLevel;
+		std::vector<uint8_t> texels;
+		for (uint32_t i = 0; i < mipCount; ++i) {
+			const TextureMip& mip = mips[i];
+			if (i > 0) {
+				Downsample(level, mips[i - 1].width, mips[i - 1].height, nextLevel, mip.width, mip.height,
+						   usage == TextureUsage::Normal, threadPool);
+				level.swap(nextLevel);
+			}
+
+			const void* pixels = level.data();
+			if (!hdr) {
+				StoreLevel(level, usage, texels, mip.width, mip.height, threadPool);
+				pixels = texels.data();
+			}
+			if (compression == TextureCompression::None) {
+				std::memcpy(chain + mip.offset, pixels, mip.size);
+			} else {
+				BlockCompressor::Compress(compression, pixels, mip.width, mip.height, chain + mip.offset, threadPool);
+			}
+		}
+
+		texture.mips = std::move(mips);
+		texture.compression = compression;
+		texture.bytesPerChannel = expectedBytesPerChannel;
+		texture.isSRGB = usage == TextureUsage::Albedo;
+
+		Logger::Debug("TextureCooker", "Cooked '{}' ({}x{}, {} mips, compression {}) {} KB -> {} KB in {:.2f} ms",
+					  texture.name, width, height, mipCount, static_cast<uint32_t>(compression), sourceSize / 1024,
+					  totalSize / 1024, ElapsedMs(start));
+		return true;
+	}
+
+	bool TextureCooker::Write(const TextureData& texture, const std::string& cookedPath) {
+		if (!texture.IsValid()) {
+			return false;
+		}
+
+		// Uncooked textures are stored as a one-level chain
+		std::vector<TextureMip> mips = texture.mips;
+		if (mips.empty()) {
+			mips.push_back({ 0, texture.dataSize, texture.width, texture.height });
+		}
+
+		// Smallest level first in the file; the table keeps level order
+		std::vector<TextureMip> fileMips = mips;
+		uint64_t blobSize = 0;
+		for (auto it = fileMips.rbegin(); it != fileMips.rend(); ++it) {
+			it->offset = blobSize;
+			blobSize += it->size;
+		}
+
+		CookedTextureHeader header{};
+		header.magic = MAGIC;
+		header.version = FORMAT_VERSION;
+		header.width = texture.width;
+		header.height = texture.height;
+		header.channels = texture.channels;
+		header.bytesPerChannel = texture.bytesPerChannel;
+		header.compression = static_cast<uint32_t>(texture.compression);
+		header.flags = (texture.isHDR ? FLAG_HDR : 0) | (texture.isSRGB ? FLAG_SRGB : 0);
+		header.mipCount = static_cast<uint32_t>(mips.size());
+		header.mipTableOffset = sizeof(CookedTextureHeader);
+		header.dataOffset = (header.mipTableOffset + sizeof(TextureMip) * mips.size() + BLOB_ALIGNMENT - 1) & ~(BLOB_ALIGNMENT - 1);
+		header.dataSize = blobSize;
+
+		std::error_code ec;
+		std::filesystem::path path(cookedPath);
+		if (path.has_parent_path()) {
+			std::filesystem::create_directories(path.parent_path(), ec);
+		}
+
+		std::string tempPath = cookedPath + ".tmp";
+		{
+			std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+			if (!file.is_open()) {
+				Logger::Error("TextureCooker", "Failed to open '{}' for writing", tempPath);
+				return false;
+			}
+
+			static const char zeros[BLOB_ALIGNMENT] = {};
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.write(reinterpret_cast<const char*>(fileMips.data()), static_cast<std::streamsize>(sizeof(TextureMip) * fileMips.size()));
+			file.write(zeros, static_cast<std::streamsize>(header.dataOffset - static_cast<uint64_t>(file.tellp())));
+			for (size_t level = mips.size(); level-- > 0;) {
+				file.write(static_cast<const char*>(texture.data) + mips[level].offset, static_cast<std::streamsize>(mips[level].size));
+			}
+
+			if (!file.good()) {
+				Logger::Error("TextureCooker", "Failed to write cooked texture '{}'", tempPath);
+				file.close();
+				std::filesystem::remove(tempPath, ec);
+				return false;
+			}
+		}
+
+		std::filesystem::rename(tempPath, cookedPath, ec);
+		if (ec) {
+			Logger::Error("TextureCooker", "Failed to move cooked texture into place '{}': {}", cookedPath, ec.message());
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+		return true;
+	}
+
+	std::shared_ptr<TextureData> TextureCooker::Load(const std::string& cookedPath) {
+		auto file = MappedFile::Open(cookedPath, false);
+		if (!file) {
+			return nullptr;
+		}
+		return Load(std::move(file), cookedPath);
+	}
+
+	std::shared_ptr<TextureData> TextureCooker::Load(std::shared_ptr<MappedFile> file, const std::string& name) {
+		const uint8_t* base = file->GetData();
+		size_t size = file->GetSize();
+		if (size < sizeof(CookedTextureHeader)) {
+			Logger::Warning("TextureCooker", "Cooked texture '{}' is truncated", name);
+			return nullptr;
+		}
+
+		CookedTextureHeader header;
+		std::memcpy(&header, base, sizeof(header));
+		if (header.magic != MAGIC || header.version != FORMAT_VERSION ||
+			header.compression > static_cast<uint32_t>(TextureCompression::BC7)) {
+			Logger::Debug("TextureCooker", "Cooked texture '{}' has an incompatible format, ignoring", name);
+			return nullptr;
+		}
+		if (header.width == 0 || header.height == 0 || header.width > MAX_TEXTURE_DIMENSION ||
+			header.height > MAX_TEXTURE_DIMENSION || header.mipCount == 0 || header.mipCount > MAX_TEXTURE_MIPS ||
+			!MappedFile::RangeFits(header.mipTableOffset, header.mipCount, sizeof(TextureMip), size) ||
+			!MappedFile::RangeFits(header.dataOffset, header.dataSize, 1, size)) {
+			Logger::Warning("TextureCooker", "Cooked texture '{}' is corrupt", name);
+			return nullptr;
+		}
+
+		std::vector<TextureMip> mips(header.mipCount);
+		std::memcpy(mips.data(), base + header.mipTableOffset, sizeof(TextureMip) * mips.size());
+		for (const auto& mip : mips) {
+			if (mip.width > header.width || mip.height > header.height ||
+				!MappedFile::RangeFits(mip.offset, mip.size, 1, header.dataSize)) {
+				Logger::Warning("TextureCooker", "Cooked texture '{}' has an invalid mip table", name);
+				return nullptr;
+			}
+		}
+
+		// Tail first, so the levels streaming wants first arrive first
+		for (auto it = mips.rbegin(); it != mips.rend(); ++it) {
+			file->Prefetch(header.dataOffset + it->offset, it->size);
+		}
+
+		auto textureData = std::make_shared<TextureData>(name);
+		textureData->data = const_cast<uint8_t*>(base + header.dataOffset);
+		textureData->dataSize = header.dataSize;
+		textureData->width = header.width;
+		textureData->height = header.height;
+		textureData->channels = header.channels;
+		textureData->storage = file;
+		textureData->isValid = true;
+		textureData->bytesPerChannel = header.bytesPerChannel;
+		textureData->compression = static_cast<TextureCompression>(header.compression);
+		textureData->isHDR = (header.flags & FLAG_HDR) != 0;
+		textureData->isSRGB = (header.flags & FLAG_SRGB) != 0;
+		if (header.mipCount > 1 || textureData->compression != TextureCompression::None) {
+			textureData->mips = std::move(mips);
+		}
+		textureData->name = std::filesystem::path(name).stem().string();
+		return textureData;
+	}
+
+} // namespace AstralEngine
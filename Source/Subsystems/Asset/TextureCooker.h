@@ -0,0 +1,88 @@
+#pragma once
+
+#include "AssetData.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace AstralEngine {
+
+	class MappedFile;
+
+	class ThreadPool;
+
+	/// What a texture is sampled as; decides color space, mip filtering and BC format
+	enum class TextureUsage : uint32_t {
+		Albedo, ///< sRGB color (BC7 sRGB)
+		Normal, ///< Tangent-space normal, XY only (BC5); z is rebuilt in the shader
+		ORM,    ///< Linear data such as occlusion/roughness/metallic (BC7)
+		HDR     ///< Linear float color (BC6H)
+	};
+
+	struct TextureCookSettings {
+		TextureUsage usage = TextureUsage::Albedo;
+		TextureCompression compression = TextureCompression::BC7;
+		bool generateMips = true;
+	};
+
+	/**
+	 * @brief Cooked texture (.atex) dosya başlığı.
+	 *
+	 * Dosya düzeni: başlık, mip tablosu (TextureMip), veri blob'u. Mip
+	 * ofsetleri veri blob'unun başına göredir. Blob'da en küçük mip önce
+	 * gelir; streaming önce ucuz kuyruğu okuyup büyük seviyeleri sonra ekler.
+	 */
+	struct CookedTextureHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t width;
+		uint32_t height;
+		uint32_t channels;
+		uint32_t bytesPerChannel;
+		uint32_t compression;
+		uint32_t flags;
+		uint32_t mipCount;
+		uint32_t reserved;
+		uint64_t mipTableOffset;
+		uint64_t dataOffset;
+		uint64_t dataSize;
+	};
+
+	/**
+	 * @class TextureCooker
+	 * @brief Decode edilmiş texture'lar için mip zinciri üretir ve BC formatına kodlar.
+	 *
+	 * Mip'ler CPU'da 2x2 kutu filtresi ile üretilir: albedo doğrusal uzayda
+	 * ortalanır (gamma-doğru), normal haritaları her seviyede yeniden
+	 * normalize edilir. Seviyeler BlockCompressor ile kodlanır.
+	 */
+	class TextureCooker {
+	public:
+		static constexpr uint32_t MAGIC = 0x58455441; // "ATEX"
+		static constexpr uint32_t FORMAT_VERSION = 2;
+		static constexpr uint32_t FLAG_HDR = 1u << 0;
+		static constexpr uint32_t FLAG_SRGB = 1u << 1;
+		static constexpr uint64_t BLOB_ALIGNMENT = 64;
+		static constexpr const char* EXTENSION = ".atex";
+
+		static TextureCompression GetDefaultCompression(TextureUsage usage);
+
+		// Guess from the file name ("_normal", "_roughness", "_orm", ...) and pixel format
+		static TextureUsage GuessUsage(const std::string& filePath, bool isHDR);
+
+		// Replaces the single RGBA8 (RGBA32F for HDR) level in texture with the
+		// cooked mip chain. Levels are filtered and encoded on the pool if given.
+		static bool Cook(TextureData& texture, const TextureCookSettings& settings, ThreadPool* threadPool = nullptr);
+
+		// Writes to a temp file and renames it, so readers never see a partial file
+		static bool Write(const TextureData& texture, const std::string& cookedPath);
+
+		// Maps the file; mip data is used in place. Returns nullptr if the file is
+		// missing, malformed or from another format version
+		static std::shared_ptr<TextureData> Load(const std::string& cookedPath);
+		// Same, for a blob that is already mapped (e.g. a packed archive entry);
+		// name is only used in messages
+		static std::shared_ptr<TextureData> Load(std::shared_ptr<MappedFile> file, const std::string& name);
+	};
+
+} // namespace AstralEngine
@@ -1,14 +1,76 @@
 #include "TextureImporter.h"
 #include "AssetData.h"
+#include "DerivedDataCache.h"
+#include "TextureContainer.h"
+#include "TextureCooker.h"
 #include "../../Core/Logger.h"
 
+#include <nlohmann/json.hpp>
+#include <chrono>
 #include <filesystem>
 
 #include <stb_image.h>
 
 namespace AstralEngine {
 
+	namespace {
+
+		TextureCookSettings ReadImportSettings(const std::string& filePath, bool isHDR) {
+			TextureCookSettings settings;
+			settings.usage = TextureCooker::GuessUsage(filePath, isHDR);
+			settings.compression = TextureCooker::GetDefaultCompression(settings.usage);
+
+			nlohmann::json json = DerivedDataCache::ReadImportSettings(filePath);
+
+			static const std::pair<const char*, TextureUsage> USAGES[] = {
+				{ "albedo", TextureUsage::Albedo }, { "normal", TextureUsage::Normal },
+				{ "orm", TextureUsage::ORM }, { "hdr", TextureUsage::HDR } };
+			static const std::pair<const char*, TextureCompression> COMPRESSIONS[] = {
+				{ "none", TextureCompression::None }, { "bc1", TextureCompression::BC1 },
+				{ "bc3", TextureCompression::BC3 }, { "bc5", TextureCompression::BC5 },
+				{ "bc6h", TextureCompression::BC6H }, { "bc7", TextureCompression::BC7 } };
+
+			std::string usage = json.value("usage", std::string());
+			for (const auto& [name, value] : USAGES) {
+				if (usage == name) {
+					settings.usage = value;
+					settings.compression = TextureCooker::GetDefaultCompression(value);
+				}
+			}
+			std::string compression = json.value("compression", std::string());
+			for (const auto& [name, value] : COMPRESSIONS) {
+				if (compression == name) {
+					settings.compression = value;
+				}
+			}
+			settings.generateMips = json.value("mips", true);
+			return settings;
+		}
+
+	} // namespace
+
+	TextureImporter::TextureImporter(ThreadPool* threadPool) : m_threadPool(threadPool) {}
+
 	std::shared_ptr<void> TextureImporter::Import(const std::string& filePath) {
+		// Already-cooked file referenced directly
+		if (std::filesystem::path(filePath).extension() == TextureCooker::EXTENSION) {
+			auto textureData = TextureCooker::Load(filePath);
+			if (!textureData) {
+				Logger::Error("TextureImporter", "Failed to load cooked texture '{}'", filePath);
+			}
+			return textureData;
+		}
+
+		// KTX2/DDS are already GPU-ready; map them instead of decoding
+		if (TextureContainer::IsContainer(filePath)) {
+			auto textureData = TextureContainer::Load(filePath);
+			if (textureData) {
+				Logger::Info("TextureImporter", "Mapped texture '{}' ({}x{}, {} mips)", textureData->name,
+							 textureData->width, textureData->height, textureData->GetMipCount());
+			}
+			return textureData;
+		}
+
 		Logger::Trace("TextureImporter", "Loading TextureData from file: '{}'", filePath);
 
 		auto textureData = std::make_shared<TextureData>(filePath);
@@ -36,22 +98,55 @@ namespace AstralEngine {
 		// Since we forced RGBA, channels will be 4 in the output buffer
 		channels = 4;
 
-		if (!textureData->Allocate(width, height, channels, bpc)) {
-			Logger::Error("TextureImporter", "Failed to allocate memory for texture '{}'", filePath);
-			stbi_image_free(data);
+		// Keep the decoder's buffer instead of copying it; stb frees it with the texture
+		textureData->Adopt(data, (size_t)width * height * channels * bpc, width, height, channels, bpc,
+						   std::shared_ptr<const void>(data, [](const void* pixels) { stbi_image_free(const_cast<void*>(pixels)); }));
+		textureData->name = std::filesystem::path(filePath).filename().string();
+
+		auto start = std::chrono::steady_clock::now();
+		if (!TextureCooker::Cook(*textureData, ReadImportSettings(filePath, isHDR), m_threadPool)) {
+			Logger::Error("TextureImporter", "Failed to cook texture '{}'", filePath);
 			return nullptr;
 		}
 
-		memcpy(textureData->data, data, (size_t)width * height * channels * bpc);
-		stbi_image_free(data);
+		Logger::Info("TextureImporter", "Successfully loaded texture '{}' ({}x{}, {} mips, HDR: {}), cooked in {:.2f} ms",
+					 textureData->name, width, height, textureData->GetMipCount(), isHDR,
+					 std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
 
-		textureData->isValid = true;
-		textureData->name = std::filesystem::path(filePath).filename().string();
+		return textureData;
+	}
+
+	bool TextureImporter::SupportsDerivedData(const std::string& filePath) const {
+		return std::filesystem::path(filePath).extension() != TextureCooker::EXTENSION &&
+			   !TextureContainer::IsContainer(filePath);
+	}
+
+	std::vector<std::string> TextureImporter::GetSourceFiles(const std::string& filePath) const {
+		return { filePath, DerivedDataCache::GetImportSettingsPath(filePath) };
+	}
 
-		Logger::Info("TextureImporter", "Successfully loaded texture '{}' ({}x{}, {} channels, HDR: {})", 
-					 textureData->name, width, height, channels, isHDR);
+	bool TextureImporter::WriteDerivedData(const std::shared_ptr<void>& asset, const std::string& cachePath) {
+		return TextureCooker::Write(*std::static_pointer_cast<TextureData>(asset), cachePath);
+	}
+
+	std::shared_ptr<void> TextureImporter::ReadDerivedData(const std::string& cachePath, const std::string& sourcePath) {
+		// Not prefetched; the cooker prefetches the mips it maps
+		auto file = MappedFile::Open(cachePath, false);
+		return file ? ReadDerivedBlob(file, sourcePath) : nullptr;
+	}
 
+	std::shared_ptr<void> TextureImporter::ReadDerivedBlob(const std::shared_ptr<MappedFile>& blob, const std::string& sourcePath) {
+		auto textureData = TextureCooker::Load(blob, sourcePath);
+		if (!textureData) {
+			return nullptr;
+		}
+		textureData->filePath = sourcePath;
+		textureData->name = std::filesystem::path(sourcePath).filename().string();
 		return textureData;
 	}
 
+	size_t TextureImporter::GetMemoryUsage(const std::shared_ptr<void>& asset) const {
+		return std::static_pointer_cast<TextureData>(asset)->GetMemoryUsage();
+	}
+
 } // namespace AstralEngine
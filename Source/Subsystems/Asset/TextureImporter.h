@@ -1,16 +1,42 @@
 #pragma once
 
 #include "IAssetImporter.h"
+#include <string>
 
 namespace AstralEngine {
 
+	class ThreadPool;
+
 	/**
 	 * @class TextureImporter
 	 * @brief Görüntü dosyalarını (PNG, JPG, vb.) TextureData'ya dönüştürür.
+	 *
+	 * Decode edilen görüntü TextureCooker ile mip zincirine ve kullanıma göre
+	 * seçilen BC formatına pişirilir; önbelleğe .atex olarak yazılır. Kullanım
+	 * dosya adından tahmin edilir ya da "<texture>.import.json" ile verilir:
+	 * { "usage": "albedo|normal|orm|hdr", "compression": "bc1|bc3|bc5|bc6h|bc7|none", "mips": true }
+	 *
+	 * KTX2 ve DDS dosyaları pişirilmez; TextureContainer ile map edilip
+	 * olduğu gibi kullanılır.
 	 */
 	class TextureImporter : public IAssetImporter {
 	public:
+		explicit TextureImporter(ThreadPool* threadPool = nullptr);
+
 		std::shared_ptr<void> Import(const std::string& filePath) override;
+
+		// Caches the cooked mip chain so warm loads skip decoding and encoding
+		bool SupportsDerivedData(const std::string& filePath) const override;
+		uint32_t GetVersion() const override { return 3; } // 2: cooked BC mip chains, 3: smallest mip first
+		std::vector<std::string> GetSourceFiles(const std::string& filePath) const override;
+		bool WriteDerivedData(const std::shared_ptr<void>& asset, const std::string& cachePath) override;
+		std::shared_ptr<void> ReadDerivedData(const std::string& cachePath, const std::string& sourcePath) override;
+		std::shared_ptr<void> ReadDerivedBlob(const std::shared_ptr<MappedFile>& blob, const std::string& sourcePath) override;
+
+		size_t GetMemoryUsage(const std::shared_ptr<void>& asset) const override;
+
+	private:
+		ThreadPool* m_threadPool = nullptr;
 	};
 
 } // namespace AstralEngine
@@ -0,0 +1,115 @@
+#include "VertexQuantizer.h"
+#include "../../Core/Logger.h"
+
+#include <glm/gtc/packing.hpp>
+#include <cmath>
+
+namespace AstralEngine {
+
+	namespace {
+
+		glm::vec3 SafeNormalize(const glm::vec3& v, const glm::vec3& fallback) {
+			float length = glm::length(v);
+			return length > 1e-8f ? v / length : fallback;
+		}
+
+		// Any unit vector perpendicular to n; used when a mesh has no tangents
+		glm::vec3 Perpendicular(const glm::vec3& n) {
+			glm::vec3 axis = std::abs(n.x) < 0.9f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+			return glm::normalize(glm::cross(axis, n));
+		}
+
+	} // namespace
+
+	glm::vec2 VertexQuantizer::OctEncode(const glm::vec3& n) {
+		glm::vec2 p = glm::vec2(n.x, n.y) / (std::abs(n.x) + std::abs(n.y) + std::abs(n.z));
+		if (n.z < 0.0f) {
+			glm::vec2 signs(p.x >= 0.0f ? 1.0f : -1.0f, p.y >= 0.0f ? 1.0f : -1.0f);
+			p = (1.0f - glm::abs(glm::vec2(p.y, p.x))) * signs;
+		}
+		return p;
+	}
+
+	glm::vec3 VertexQuantizer::OctDecode(const glm::vec2& e) {
+		glm::vec3 n(e.x, e.y, 1.0f - std::abs(e.x) - std::abs(e.y));
+		float t = std::max(-n.z, 0.0f);
+		n.x += n.x >= 0.0f ? -t : t;
+		n.y += n.y >= 0.0f ? -t : t;
+		return glm::normalize(n);
+	}
+
+	glm::vec3 VertexQuantizer::GetPositionScale(const AABB& bounds) {
+		return bounds.IsValid() ? bounds.GetExtent() : glm::vec3(0.0f);
+	}
+
+	PackedVertex VertexQuantizer::PackVertex(const Vertex& vertex, const AABB& bounds) {
+		PackedVertex packed{};
+
+		glm::vec3 extent = GetPositionScale(bounds);
+		for (int i = 0; i < 3; ++i) {
+			float t = extent[i] > 0.0f ? (vertex.position[i] - bounds.min[i]) / extent[i] : 0.0f;
+			packed.position[i] = glm::packUnorm1x16(t);
+		}
+
+		glm::vec3 normal = SafeNormalize(vertex.normal, glm::vec3(0.0f, 0.0f, 1.0f));
+		// Gram-Schmidt so the decoded frame is orthonormal
+		glm::vec3 tangent = vertex.tangent - normal * glm::dot(normal, vertex.tangent);
+		tangent = SafeNormalize(tangent, Perpendicular(normal));
+
+		bool flipped = glm::dot(glm::cross(normal, tangent), vertex.bitangent) < 0.0f;
+		packed.position[3] = flipped ? 0 : 0xFFFF;
+
+		glm::vec2 n = OctEncode(normal);
+		glm::vec2 t = OctEncode(tangent);
+		packed.normal[0] = static_cast<int16_t>(glm::packSnorm1x16(n.x));
+		packed.normal[1] = static_cast<int16_t>(glm::packSnorm1x16(n.y));
+		packed.tangent[0] = static_cast<int16_t>(glm::packSnorm1x16(t.x));
+		packed.tangent[1] = static_cast<int16_t>(glm::packSnorm1x16(t.y));
+
+		packed.texCoord[0] = glm::packHalf1x16(vertex.texCoord.x);
+		packed.texCoord[1] = glm::packHalf1x16(vertex.texCoord.y);
+		return packed;
+	}
+
+	Vertex VertexQuantizer::UnpackVertex(const PackedVertex& packed, const AABB& bounds) {
+		Vertex vertex;
+		glm::vec3 quantized(glm::unpackUnorm1x16(packed.position[0]), glm::unpackUnorm1x16(packed.position[1]),
+							glm::unpackUnorm1x16(packed.position[2]));
+		vertex.position = quantized * GetPositionScale(bounds) + GetPositionOffset(bounds);
+
+		vertex.normal = OctDecode(glm::vec2(glm::unpackSnorm1x16(static_cast<uint16_t>(packed.normal[0])),
+											glm::unpackSnorm1x16(static_cast<uint16_t>(packed.normal[1]))));
+		vertex.tangent = OctDecode(glm::vec2(glm::unpackSnorm1x16(static_cast<uint16_t>(packed.tangent[0])),
+											 glm::unpackSnorm1x16(static_cast<uint16_t>(packed.tangent[1]))));
+		float sign = packed.position[3] != 0 ? 1.0f : -1.0f;
+		vertex.bitangent = glm::cross(vertex.normal, vertex.tangent) * sign;
+
+		vertex.texCoord = glm::vec2(glm::unpackHalf1x16(packed.texCoord[0]), glm::unpackHalf1x16(packed.texCoord[1]));
+		return vertex;
+	}
+
+	bool VertexQuantizer::Pack(ModelData& model) {
+		if (model.mappedStorage || model.vertexFormat == VertexFormat::Packed) {
+			return model.vertexFormat == VertexFormat::Packed;
+		}
+		if (!model.boundingBox.IsValid()) {
+			Logger::Warning("VertexQuantizer", "Model '{}' has no bounds; keeping float vertices", model.name);
+			return false;
+		}
+
+		model.packedVertices.resize(model.vertices.size());
+		for (size_t i = 0; i < model.vertices.size(); ++i) {
+			model.packedVertices[i] = PackVertex(model.vertices[i], model.boundingBox);
+		}
+
+		size_t before = model.vertices.size() * sizeof(Vertex);
+		model.vertices.clear();
+		model.vertices.shrink_to_fit();
+		model.vertexFormat = VertexFormat::Packed;
+
+		Logger::Debug("VertexQuantizer", "Packed '{}': {:.2f} MB -> {:.2f} MB of vertices", model.name,
+					  before / (1024.0 * 1024.0), model.GetVertexData().size() / (1024.0 * 1024.0));
+		return true;
+	}
+
+} // namespace AstralEngine
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "AssetData.h"
+#include <glm/glm.hpp>
+
+namespace AstralEngine {
+
+	/**
+	 * @class VertexQuantizer
+	 * @brief Vertex'leri PackedVertex formatına sıkıştırır ve geri açar.
+	 *
+	 * Açma işlemi PBR.vert içindeki decode ile birebir aynıdır; CPU tarafı
+	 * (picking, araçlar) için sağlanır.
+	 */
+	class VertexQuantizer {
+	public:
+		// Converts model.vertices to packedVertices (relative to model.boundingBox)
+		// and releases the float vertices; needs owned (non-mapped) data
+		static bool Pack(ModelData& model);
+
+		static PackedVertex PackVertex(const Vertex& vertex, const AABB& bounds);
+		static Vertex UnpackVertex(const PackedVertex& vertex, const AABB& bounds);
+
+		// Shader decode: position = quantized * scale + offset
+		static glm::vec3 GetPositionScale(const AABB& bounds);
+		static glm::vec3 GetPositionOffset(const AABB& bounds) { return bounds.min; }
+
+		static glm::vec2 OctEncode(const glm::vec3& n);
+		static glm::vec3 OctDecode(const glm::vec2& e);
+	};
+
+} // namespace AstralEngine
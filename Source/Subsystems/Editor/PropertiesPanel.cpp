@@ -4,6 +4,7 @@
 #include "../../Subsystems/Scene/Scene.h"
 #include "Subsystems/Editor/SceneEditorSubsystem.h" // Added
 #include "Subsystems/Renderer/Core/Material.h"      // Added for Material class
+#include <algorithm>
 #include <glm/gtc/type_ptr.hpp>
 #include <imgui.h>
 #include <imgui_internal.h>
@@ -156,8 +157,17 @@ void PropertiesPanel::DrawComponents(uint32_t entityID) {
     ImGui::Checkbox("Cast Shadows", &component.castsShadows);
     ImGui::Checkbox("Receive Shadows", &component.receivesShadows);
 
+    ImGui::DragFloat("LOD Bias", &component.lodBias, 0.05f, 0.1f, 8.0f, "%.2f");
+    ImGui::InputInt("Forced LOD", &component.forcedLod);
+    component.forcedLod = std::max(component.forcedLod, -1);
+    ImGui::Text("Current LOD: %u", component.currentLod);
+
     ImGui::Text("Model (ID): %llu", component.modelHandle.GetID());
     ImGui::Text("Material (ID): %llu", component.materialHandle.GetID());
+    for (size_t slot = 0; slot < component.materialSlots.size(); ++slot) {
+      ImGui::Text("Material Slot %zu (ID): %llu", slot,
+                  component.materialSlots[slot].GetID());
+    }
 
     if (m_editor) {
       auto material = m_editor->GetOrLoadMaterial(component.materialHandle);
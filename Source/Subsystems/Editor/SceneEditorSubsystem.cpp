@@ -9,9 +9,10 @@
 #include "../../Subsystems/Renderer/RHI/IRHICommandList.h"
 #include "../../Subsystems/Scene/Entity.h"
 #include "../../Subsystems/Scene/SceneSerializer.h"
-#include "../Renderer/RHI/Vulkan/VulkanCommandList.h"
+#include "../Renderer/Core/VertexLayout.h"
 #include "../Renderer/RHI/Vulkan/VulkanResources.h"
 #include "../UI/UISubsystem.h"
+#include <algorithm>
 #include <entt/entt.hpp>
 #include <filesystem>
 #include <iomanip>
@@ -38,6 +39,12 @@ void SceneEditorSubsystem::OnInitialize(Engine *owner) {
   m_activeScene->OnInitialize(owner);
 
   InitializeDefaultResources();
+  m_renderGraph = std::make_unique<RenderGraph>(m_renderSubsystem->GetDevice());
+  m_textureStreamer = std::make_unique<TextureStreamer>(m_renderSubsystem->GetDevice());
+  if (auto *assetManager = m_assetSubsystem->GetAssetManager()) {
+    m_reloadListener = assetManager->AddReloadListener(
+        [this](const AssetHandle &handle) { OnAssetReloaded(handle); });
+  }
   SetupViewportResources();
   SetupShadowResources();
   SetupIBLResources();
@@ -133,8 +140,15 @@ void SceneEditorSubsystem::OnShutdown() {
     m_renderSubsystem->SetPreRenderCallback(nullptr);
   }
 
+  if (auto *assetManager = m_assetSubsystem ? m_assetSubsystem->GetAssetManager() : nullptr) {
+    assetManager->RemoveReloadListener(m_reloadListener);
+  }
+
   m_meshCache.clear();
   m_materialCache.clear();
+  m_textureStreamer.reset();
+  m_defaultMaterial.reset();
+  m_renderGraph.reset();
 }
 
 void SceneEditorSubsystem::SetSelectedEntity(uint32_t entity) {
@@ -383,6 +397,39 @@ void SceneEditorSubsystem::InitializeDefaultResources() {
   AssetHandle whiteTexHandle =
       assetManager->RegisterAsset("Textures/Default/White.png");
 
+  // Default material is the placeholder drawn while other materials'
+  // pipelines compile, so its standard variant is waited for here. It still
+  // compiles on the pool (and through the pipeline cache) like any other, and
+  // the packed variant starts now rather than on the first packed mesh.
+  std::string vPath = assetManager->GetFullPath("Shaders/Bin/PBR.vert.spv");
+  std::string fPath = assetManager->GetFullPath("Shaders/Bin/PBR.frag.spv");
+  if (std::filesystem::exists(vPath) && std::filesystem::exists(fPath)) {
+    try {
+      MaterialData defaultData;
+      defaultData.name = "DefaultPBR";
+      defaultData.vertexShaderPath = vPath;
+      defaultData.fragmentShaderPath = fPath;
+      defaultData.isValid = true;
+
+      m_defaultMaterial = std::make_unique<Material>(
+          device, defaultData, m_globalDescriptorSetLayout.get(),
+          m_renderSubsystem->GetPipelineCompilePool());
+      if (m_defaultMaterial->WaitForPipeline(VertexFormat::Standard)) {
+        m_defaultMaterial->IsPipelineReady(VertexFormat::Packed);
+        m_defaultMaterial->UpdateDescriptorSet();
+      } else {
+        // The material has logged why
+        m_defaultMaterial.reset();
+      }
+    } catch (const std::exception &e) {
+      Logger::Error("SceneEditorSubsystem",
+                    "Failed to create default material: {}", e.what());
+    }
+  } else {
+    Logger::Warning("SceneEditorSubsystem",
+                    "Default PBR shaders not found, no placeholder material");
+  }
+
   // We'll lazy load them in GetOrLoad functions
 }
 
@@ -404,9 +451,13 @@ void SceneEditorSubsystem::ResizeViewport(uint32_t width, uint32_t height) {
       width, height, RHIFormat::B8G8R8A8_UNORM,
       (RHITextureUsage)(RHITextureUsage::ColorAttachment |
                         RHITextureUsage::Sampled));
-  m_viewportDepth =
-      device->CreateTexture2D(width, height, RHIFormat::D32_FLOAT,
-                              RHITextureUsage::DepthStencilAttachment);
+
+  // Depth and other size-dependent targets are graph transients; drop the
+  // old-size ones now rather than waiting for them to age out of the pool.
+  if (m_renderGraph) {
+    m_renderGraph->ReleaseTransientPool();
+    m_boundShadowMaps.fill(nullptr);
+  }
 
   auto vkTexture = std::dynamic_pointer_cast<VulkanTexture>(m_viewportTexture);
   if (vkTexture) {
@@ -428,9 +479,8 @@ void SceneEditorSubsystem::ResizeViewport(uint32_t width, uint32_t height) {
     // Initial transition to SHADER_READ_ONLY_OPTIMAL so ImGui doesn't complain
     auto cmd = device->CreateCommandList();
     cmd->Begin();
-    static_cast<VulkanCommandList *>(cmd.get())->TransitionImageLayout(
-        vkTexture->GetImage(), VK_IMAGE_LAYOUT_UNDEFINED,
-        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    cmd->ResourceBarrier(m_viewportTexture.get(), RHIResourceState::Undefined,
+                         RHIResourceState::ShaderRead);
     cmd->End();
     device->SubmitCommandList(cmd.get());
     device->WaitIdle();
@@ -452,10 +502,7 @@ void SceneEditorSubsystem::UpdateGlobalDescriptorSets() {
     // Binding 0: UBO
     set->UpdateUniformBuffer(0, m_uniformBuffers[i].get(), 0, sizeof(GlobalUBO));
     
-    // Binding 1: Shadow Map
-    if (m_shadowMap && m_shadowSampler) {
-        set->UpdateCombinedImageSampler(1, m_shadowMap.get(), m_shadowSampler.get());
-    }
+    // Binding 1 (shadow map) is a render graph transient, bound per frame in RenderScene
 
     // Binding 2, 3, 4: IBL
     if (m_irradianceMap && m_iblSampler) {
@@ -467,6 +514,8 @@ void SceneEditorSubsystem::UpdateGlobalDescriptorSets() {
     if (m_brdfLUT && m_iblSampler) {
         set->UpdateCombinedImageSampler(4, m_brdfLUT.get(), m_iblSampler.get());
     }
+
+    set->CommitUpdates();
   }
 }
 
@@ -495,11 +544,7 @@ void SceneEditorSubsystem::SetupShadowResources() {
   IRHIDevice *device = m_renderSubsystem->GetDevice();
   if (!device) return;
 
-  // 1. Create Shadow Map Texture
-  m_shadowMap = device->CreateTexture2D(
-      m_shadowMapSize, m_shadowMapSize, RHIFormat::D32_FLOAT,
-      (RHITextureUsage)(RHITextureUsage::DepthStencilAttachment | RHITextureUsage::Sampled));
-
+  // 1. Shadow map itself is a render graph transient; only the sampler lives here
   RHISamplerDescriptor samplerDesc = {};
   samplerDesc.minFilter = RHIFilter::Linear;
   samplerDesc.magFilter = RHIFilter::Linear;
@@ -520,12 +565,7 @@ void SceneEditorSubsystem::SetupShadowResources() {
           shadowDesc.vertexShader = vertShader.get();
           shadowDesc.fragmentShader = nullptr; // Depth only
           
-          // Vertex Layout
-          shadowDesc.vertexBindings = { {0, sizeof(Vertex), false} };
-          shadowDesc.vertexAttributes = {
-              {0, 0, RHIFormat::R32G32B32_FLOAT, offsetof(Vertex, position)}
-          };
-          
+          shadowDesc.pushConstants = { { RHIShaderStage::Vertex, 0, sizeof(ShadowPushConstants) } };
           shadowDesc.descriptorSetLayouts = { m_globalDescriptorSetLayout.get() };
           shadowDesc.cullMode = RHICullMode::Back;
           shadowDesc.depthTestEnabled = true;
@@ -535,8 +575,13 @@ void SceneEditorSubsystem::SetupShadowResources() {
           shadowDesc.colorFormats = {}; // Depth only
           shadowDesc.depthFormat = RHIFormat::D32_FLOAT;
           
-          m_shadowPipeline = device->CreateGraphicsPipeline(shadowDesc);
-          Logger::Info("SceneEditorSubsystem", "Shadow pipeline created successfully.");
+          // One variant per vertex layout; packed positions are dequantized
+          // through the model matrix, so the shader is shared
+          for (uint32_t format = 0; format < VERTEX_FORMAT_COUNT; ++format) {
+              VertexLayout::ApplyPositionOnly(shadowDesc, static_cast<VertexFormat>(format));
+              m_shadowPipelines[format] = device->CreateGraphicsPipeline(shadowDesc);
+          }
+          Logger::Info("SceneEditorSubsystem", "Shadow pipelines created successfully.");
       }
   } else {
       Logger::Error("SceneEditorSubsystem", "Shadow shader not found at: {}", shadowShaderPath);
@@ -545,7 +590,7 @@ void SceneEditorSubsystem::SetupShadowResources() {
 
 
 void SceneEditorSubsystem::RenderScene(IRHICommandList *cmdList) {
-  if (!m_viewportTexture || !m_viewportDepth || !m_viewportPanel || !m_activeScene)
+  if (!m_viewportTexture || !m_viewportPanel || !m_activeScene || !m_renderGraph)
     return;
   if (m_globalDescriptorSets.empty())
     return;
@@ -557,14 +602,60 @@ void SceneEditorSubsystem::RenderScene(IRHICommandList *cmdList) {
   Camera *camera = m_viewportPanel->GetCamera();
   if (!camera) return;
 
-  // Define UBO early to avoid "undeclared identifier" issues in shadow pass if used
   GlobalUBO ubo{};
   ubo.view = camera->GetViewMatrix();
   ubo.proj = camera->GetProjectionMatrix(m_viewportPanel->GetSize().x / m_viewportPanel->GetSize().y);
   ubo.proj[1][1] *= -1;
   ubo.viewPos = glm::vec4(camera->GetPosition(), 1.0f);
 
-  // 1. Shadow Pass
+  // Pick each entity's LOD once per frame; shadow and main passes both use it.
+  // The same pass reports how large visible objects are on screen so the
+  // texture streamer knows which mips they need.
+  float pixelsPerUnit = std::abs(ubo.proj[1][1]) * 0.5f * m_viewportPanel->GetSize().y;
+  float viewportPixels = std::max(m_viewportPanel->GetSize().x, m_viewportPanel->GetSize().y);
+  Frustum viewFrustum = Frustum::FromMatrix(ubo.proj * ubo.view);
+  auto lodView = m_activeScene->Reg().view<TransformComponent, RenderComponent>();
+  for (auto entity : lodView) {
+    auto &render = lodView.get<RenderComponent>(entity);
+    if (!render.visible)
+      continue;
+    auto mesh = GetOrLoadMesh(render.modelHandle);
+    if (!mesh)
+      continue;
+
+    glm::mat4 model = lodView.get<TransformComponent>(entity).GetLocalMatrix();
+    if (m_activeScene->Reg().all_of<WorldTransformComponent>(entity)) {
+      model = m_activeScene->Reg().get<WorldTransformComponent>(entity).Transform;
+    }
+
+    if (m_textureStreamer) {
+      AABB bounds = mesh->GetAABB().IsValid() ? mesh->GetAABB().Transformed(model) : AABB();
+      if (!bounds.IsValid() || viewFrustum.IntersectsAABB(bounds)) {
+        // Assume each texture spans the object once; inside the bounds it may fill the view
+        float screenPixels = viewportPixels;
+        if (bounds.IsValid()) {
+          float radius = glm::length(bounds.GetExtent()) * 0.5f;
+          float distance = glm::length(bounds.GetCenter() - camera->GetPosition());
+          if (distance > radius)
+            screenPixels = std::min(2.0f * radius * pixelsPerUnit / distance, viewportPixels);
+        }
+        RequestTextureResidency(render, mesh.get(), screenPixels);
+      }
+    }
+
+    if (render.forcedLod >= 0) {
+      render.currentLod = std::min(static_cast<uint32_t>(render.forcedLod), mesh->GetLodCount() - 1);
+      continue;
+    }
+
+    LodSelectionSettings lodSettings = m_lodSettings;
+    lodSettings.maxScreenError *= render.lodBias;
+    render.currentLod = mesh->SelectLod(model, camera->GetPosition(), pixelsPerUnit, render.currentLod, lodSettings);
+  }
+
+  if (m_textureStreamer)
+    UpdateTextureStreaming();
+
   // Find main directional light for shadow casting
   Entity mainLight;
   auto lightView = m_activeScene->Reg().view<TransformComponent, LightComponent>();
@@ -576,154 +667,282 @@ void SceneEditorSubsystem::RenderScene(IRHICommandList *cmdList) {
       }
   }
 
-  glm::mat4 lightSpaceMatrix = glm::mat4(1.0f);
   bool hasShadows = false;
-
-  if (mainLight) {
+  std::vector<ShadowCascade> cascades;
+
+  // Shadow casters with their light-space bounds, computed once and shared by
+  // every cascade's culling test
+  struct ShadowCaster {
+    std::shared_ptr<Mesh> mesh;
+    glm::mat4 model; // Includes vertex dequantization for packed meshes
+    AABB boundsLS;
+    uint32_t lod;
+  };
+  std::vector<ShadowCaster> casters;
+
+  if (mainLight && m_shadowPipelines[static_cast<size_t>(VertexFormat::Standard)]) {
       const auto& transform = mainLight.GetComponent<TransformComponent>();
       glm::vec3 lightDir = glm::normalize(glm::mat3(transform.GetLocalMatrix()) * glm::vec3(0, 0, -1));
-      
-      glm::mat4 lView = glm::lookAt(-lightDir * 20.0f, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-      glm::mat4 lProj = glm::ortho(-20.0f, 20.0f, -20.0f, 20.0f, 0.1f, 100.0f);
-      lightSpaceMatrix = lProj * lView;
-      hasShadows = true;
-
-      // Render to Shadow Map
-      RHIRect2D shadowRect = { {0, 0}, {m_shadowMapSize, m_shadowMapSize} };
-      
-      auto vkShadowMap = std::dynamic_pointer_cast<VulkanTexture>(m_shadowMap);
-      if (vkShadowMap) {
-          static_cast<VulkanCommandList*>(cmdList)->TransitionImageLayout(
-              vkShadowMap->GetImage(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
-      }
-
-      cmdList->BeginRendering({}, m_shadowMap.get(), shadowRect);
-      
-      RHIViewport shadowViewport = { 0.0f, 0.0f, (float)m_shadowMapSize, (float)m_shadowMapSize, 0.0f, 1.0f };
-      cmdList->SetViewport(shadowViewport);
-      cmdList->SetScissor(shadowRect);
-
-  if (m_shadowPipeline) {
-      cmdList->BindPipeline(m_shadowPipeline.get());
-      cmdList->BindDescriptorSet(m_shadowPipeline.get(), m_globalDescriptorSets[frameIndex].get(), 0);
-
-      // Update Global UBO once for the shadow pass (if needed, though shadow pass usually just needs light space matrix)
-      // Actually, let's just update the UBO once before any rendering
-      ubo.lightSpaceMatrix = lightSpaceMatrix;
-      void* uboData = m_uniformBuffers[frameIndex]->Map();
-      memcpy(uboData, &ubo, sizeof(GlobalUBO));
-      m_uniformBuffers[frameIndex]->Unmap();
+      glm::mat4 lightViewMatrix = ShadowCascades::ComputeLightView(lightDir);
 
+      AABB casterBoundsLS;
       auto renderView = m_activeScene->Reg().view<TransformComponent, RenderComponent>();
       for (auto entity : renderView) {
           const auto& rc = renderView.get<RenderComponent>(entity);
           if (!rc.visible || !rc.castsShadows) continue;
 
           auto mesh = GetOrLoadMesh(rc.modelHandle);
-          if (mesh) {
-              const auto& tc = renderView.get<TransformComponent>(entity);
-              glm::mat4 model = tc.GetLocalMatrix();
-              
-              cmdList->BindPipeline(m_shadowPipeline.get());
-              
-              // Use push constants for model matrix
-              cmdList->PushConstants(m_shadowPipeline.get(), RHIShaderStage::Vertex, 0, sizeof(glm::mat4), &model);
-
-              cmdList->BindVertexBuffer(0, mesh->GetVertexBuffer(), 0);
-              cmdList->BindIndexBuffer(mesh->GetIndexBuffer(), 0, true);
-              cmdList->DrawIndexed(mesh->GetIndexCount(), 1, 0, 0, 0);
+          if (!mesh) continue;
+
+          glm::mat4 model = renderView.get<TransformComponent>(entity).GetLocalMatrix();
+          if (m_activeScene->Reg().all_of<WorldTransformComponent>(entity)) {
+            model = m_activeScene->Reg().get<WorldTransformComponent>(entity).Transform;
           }
-      }
-  }
-      cmdList->EndRendering();
 
-      if (vkShadowMap) {
-          static_cast<VulkanCommandList*>(cmdList)->TransitionImageLayout(
-              vkShadowMap->GetImage(), VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+          AABB boundsLS;
+          if (mesh->GetAABB().IsValid()) {
+            boundsLS = mesh->GetAABB().Transformed(lightViewMatrix * model);
+            casterBoundsLS.Merge(boundsLS);
+          }
+          if (mesh->GetVertexFormat() != VertexFormat::Standard) {
+            model = model * mesh->GetDecodeParams().ToMatrix();
+          }
+          casters.push_back({mesh, model, boundsLS, rc.currentLod});
       }
+
+      float aspect = m_viewportPanel->GetSize().x / m_viewportPanel->GetSize().y;
+      cascades = ShadowCascades::Compute(ubo.view, glm::radians(camera->GetZoom()), aspect,
+                                         camera->GetNearPlane(), camera->GetFarPlane(),
+                                         lightViewMatrix, m_shadowSettings, casterBoundsLS);
+      hasShadows = true;
   }
 
-  // 2. Main Pass
-  ubo.lightSpaceMatrix = lightSpaceMatrix;
+  ubo.cascadeCount = static_cast<int>(cascades.size());
+  for (size_t i = 0; i < cascades.size(); ++i) {
+      ubo.cascadeViewProj[i] = cascades[i].viewProj;
+      ubo.cascadeSplits[static_cast<int>(i)] = cascades[i].splitFar;
+  }
+  ubo.lightSpaceMatrix = cascades.empty() ? glm::mat4(1.0f) : cascades[0].viewProj;
   ubo.hasShadows = hasShadows ? 1 : 0;
   ubo.hasIBL = (m_irradianceMap && m_prefilterMap && m_brdfLUT) ? 1 : 0;
-   
-   // Fill lights
-   ubo.lightCount = 0;
-   auto lView = m_activeScene->Reg().view<TransformComponent, LightComponent>();
-   for (auto entity : lView) {
-       if (ubo.lightCount >= 4) break;
-       const auto& transform = lView.get<TransformComponent>(entity);
-       const auto& light = lView.get<LightComponent>(entity);
-
-       auto& gpuLight = ubo.lights[ubo.lightCount];
-       gpuLight.position = glm::vec4(transform.position, (float)light.type);
-       
-       glm::vec3 direction = glm::normalize(glm::mat3(transform.GetLocalMatrix()) * glm::vec3(0, 0, -1));
-       gpuLight.direction = glm::vec4(direction, light.range);
-       gpuLight.color = glm::vec4(light.color, light.intensity);
-       gpuLight.params = glm::vec4(light.innerConeAngle, light.outerConeAngle, 0.0f, 0.0f);
-       
-       ubo.lightCount++;
-   }
-
-   // 2. Render Loop
-   std::vector<IRHITexture *> colorAttachments = {m_viewportTexture.get()};
-   RHIRect2D renderArea;
-   renderArea.offset = {0, 0};
-   renderArea.extent = {m_viewportTexture->GetWidth(),
-                        m_viewportTexture->GetHeight()};
-
-   auto vkViewportTex = std::dynamic_pointer_cast<VulkanTexture>(m_viewportTexture);
-   if (vkViewportTex) {
-       static_cast<VulkanCommandList*>(cmdList)->TransitionImageLayout(
-           vkViewportTex->GetImage(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
-   }
-
-   cmdList->BeginRendering(colorAttachments, m_viewportDepth.get(), renderArea);
-
-   RHIViewport viewport = { 0.0f, 0.0f, (float)renderArea.extent.width, (float)renderArea.extent.height, 0.0f, 1.0f };
-   cmdList->SetViewport(viewport);
-   cmdList->SetScissor(renderArea);
-
-   auto view = m_activeScene->Reg().view<TransformComponent, RenderComponent>();
-  for (auto entity : view) {
-    const auto &transform = view.get<TransformComponent>(entity);
-    const auto &render = view.get<RenderComponent>(entity);
 
-    if (!render.visible)
-      continue;
+  // Fill lights
+  ubo.lightCount = 0;
+  for (auto entity : lightView) {
+      if (ubo.lightCount >= 4) break;
+      const auto& transform = lightView.get<TransformComponent>(entity);
+      const auto& light = lightView.get<LightComponent>(entity);
 
-    auto mesh = GetOrLoadMesh(render.modelHandle);
-    auto material = GetOrLoadMaterial(render.materialHandle);
+      auto& gpuLight = ubo.lights[ubo.lightCount];
+      gpuLight.position = glm::vec4(transform.position, (float)light.type);
 
-    if (mesh && material) {
-      cmdList->BindPipeline(material->GetPipeline());
+      glm::vec3 direction = glm::normalize(glm::mat3(transform.GetLocalMatrix()) * glm::vec3(0, 0, -1));
+      gpuLight.direction = glm::vec4(direction, light.range);
+      gpuLight.color = glm::vec4(light.color, light.intensity);
+      gpuLight.params = glm::vec4(light.innerConeAngle, light.outerConeAngle, 0.0f, 0.0f);
 
-      // Use push constants for model matrix
-      glm::mat4 model = transform.GetLocalMatrix();
-      if (m_activeScene->Reg().all_of<WorldTransformComponent>(entity)) {
-        model = m_activeScene->Reg().get<WorldTransformComponent>(entity).Transform;
-      }
-      
-      cmdList->PushConstants(material->GetPipeline(), RHIShaderStage::Vertex, 0, sizeof(glm::mat4), &model);
+      ubo.lightCount++;
+  }
 
-      // Bind descriptor sets individually
-      cmdList->BindDescriptorSet(material->GetPipeline(),
-                                 m_globalDescriptorSets[frameIndex].get(), 0);
-      cmdList->BindDescriptorSet(material->GetPipeline(),
-                                 material->GetDescriptorSet(), 1);
+  // Both passes read the same UBO, so upload it once up front
+  void* uboData = m_uniformBuffers[frameIndex]->Map();
+  memcpy(uboData, &ubo, sizeof(GlobalUBO));
+  m_uniformBuffers[frameIndex]->Unmap();
 
-      mesh->Draw(cmdList);
-    }
-  }
+  // Build this frame's graph; the graph owns every layout transition
+  m_renderGraph->Reset();
+
+  // ImGui samples the viewport texture, so it enters and leaves as ShaderRead
+  RGTextureHandle viewportColor = m_renderGraph->ImportTexture(
+      "ViewportColor", m_viewportTexture.get(), RHIResourceState::ShaderRead, RHIResourceState::ShaderRead);
+  RGTextureHandle shadowMap = RG_INVALID_HANDLE;
+  RGTextureHandle viewportDepth = RG_INVALID_HANDLE;
+
+  // 1. Shadow Pass
+  // Cascades are laid out side by side in one atlas. Always recorded (cleared
+  // when there is no caster light) so binding 1 of the global set is a valid
+  // depth texture either way.
+  uint32_t cascadeCount = std::max<uint32_t>(1, static_cast<uint32_t>(cascades.size()));
+  uint32_t cascadeSize = m_shadowSettings.resolution;
+
+  m_renderGraph->AddPass("ShadowPass",
+      [&](RenderGraphBuilder &builder) {
+          RGTextureDesc desc;
+          desc.width = cascadeSize * cascadeCount;
+          desc.height = cascadeSize;
+          desc.format = RHIFormat::D32_FLOAT;
+          desc.usage = (RHITextureUsage)(RHITextureUsage::DepthStencilAttachment | RHITextureUsage::Sampled);
+          shadowMap = builder.CreateTexture("ShadowMap", desc);
+          builder.Write(shadowMap, RHIResourceState::DepthAttachment);
+      },
+      [&](const RenderGraphResources &resources, IRHICommandList *cmd) {
+          RHIRect2D atlasRect = { {0, 0}, {cascadeSize * cascadeCount, cascadeSize} };
+          cmd->BeginRendering({}, resources.GetTexture(shadowMap), atlasRect);
+
+          if (hasShadows) {
+              for (uint32_t c = 0; c < cascades.size(); ++c) {
+                  RHIRect2D cascadeRect = { {static_cast<int32_t>(c * cascadeSize), 0}, {cascadeSize, cascadeSize} };
+                  RHIViewport cascadeViewport = { (float)(c * cascadeSize), 0.0f, (float)cascadeSize, (float)cascadeSize, 0.0f, 1.0f };
+                  cmd->SetViewport(cascadeViewport);
+                  cmd->SetScissor(cascadeRect);
+
+                  ShadowPushConstants push;
+                  push.lightViewProj = cascades[c].viewProj;
+                  IRHIPipeline* boundPipeline = nullptr;
+
+                  for (const auto& caster : casters) {
+                      if (!ShadowCascades::Overlaps(cascades[c], caster.boundsLS)) continue;
+
+                      IRHIPipeline* pipeline = m_shadowPipelines[static_cast<size_t>(caster.mesh->GetVertexFormat())].get();
+                      if (!pipeline) continue;
+                      if (pipeline != boundPipeline) {
+                          cmd->BindPipeline(pipeline);
+                          boundPipeline = pipeline;
+                      }
+
+                      push.model = caster.model;
+                      cmd->PushConstants(pipeline, RHIShaderStage::Vertex, 0, sizeof(ShadowPushConstants), &push);
+
+                      caster.mesh->Draw(cmd, caster.lod);
+                  }
+              }
+          }
+
+          cmd->EndRendering();
+      });
+
+  // 2. Main Pass
+  m_renderGraph->AddPass("MainPass",
+      [&](RenderGraphBuilder &builder) {
+          RGTextureDesc depthDesc;
+          depthDesc.width = m_viewportTexture->GetWidth();
+          depthDesc.height = m_viewportTexture->GetHeight();
+          depthDesc.format = RHIFormat::D32_FLOAT;
+          depthDesc.usage = RHITextureUsage::DepthStencilAttachment;
+          viewportDepth = builder.CreateTexture("ViewportDepth", depthDesc);
+
+          builder.Write(viewportColor, RHIResourceState::ColorAttachment);
+          builder.Write(viewportDepth, RHIResourceState::DepthAttachment);
+          builder.Read(shadowMap, RHIResourceState::ShaderRead);
+      },
+      [&](const RenderGraphResources &resources, IRHICommandList *cmd) {
+          std::vector<IRHITexture *> colorAttachments = {resources.GetTexture(viewportColor)};
+          RHIRect2D renderArea;
+          renderArea.offset = {0, 0};
+          renderArea.extent = {m_viewportTexture->GetWidth(),
+                               m_viewportTexture->GetHeight()};
+
+          cmd->BeginRendering(colorAttachments, resources.GetTexture(viewportDepth), renderArea);
+
+          RHIViewport viewport = { 0.0f, 0.0f, (float)renderArea.extent.width, (float)renderArea.extent.height, 0.0f, 1.0f };
+          cmd->SetViewport(viewport);
+          cmd->SetScissor(renderArea);
+
+          Frustum frustum = Frustum::FromMatrix(ubo.proj * ubo.view);
+          glm::vec3 cameraPosition = glm::vec3(ubo.viewPos);
+          m_clusterCullStats = {};
+
+          auto view = m_activeScene->Reg().view<TransformComponent, RenderComponent>();
+          for (auto entity : view) {
+            const auto &transform = view.get<TransformComponent>(entity);
+            const auto &render = view.get<RenderComponent>(entity);
+
+            if (!render.visible)
+              continue;
+
+            auto mesh = GetOrLoadMesh(render.modelHandle);
+
+            if (!mesh)
+              continue;
+            VertexFormat vertexFormat = mesh->GetVertexFormat();
+
+            // Draw with the default material until the real pipeline has compiled
+            auto resolveMaterial = [&](const AssetHandle &handle) -> Material * {
+              auto material = GetOrLoadMaterial(handle);
+              Material *drawMaterial = material.get();
+              if (drawMaterial && !drawMaterial->IsPipelineReady(vertexFormat)) {
+                drawMaterial = m_defaultMaterial ? m_defaultMaterial.get() : nullptr;
+              }
+              if (drawMaterial && !drawMaterial->IsPipelineReady(vertexFormat)) {
+                drawMaterial = nullptr;
+              }
+              return drawMaterial;
+            };
+
+            // Use push constants for model matrix and vertex decode params
+            PushConstants push;
+            push.model = transform.GetLocalMatrix();
+            if (m_activeScene->Reg().all_of<WorldTransformComponent>(entity)) {
+              push.model = m_activeScene->Reg().get<WorldTransformComponent>(entity).Transform;
+            }
+            push.positionScale = mesh->GetDecodeParams().positionScale;
+            push.positionOffset = mesh->GetDecodeParams().positionOffset;
+            const glm::mat4 &model = push.model;
+
+            Material *boundMaterial = nullptr;
+            auto bindMaterial = [&](Material *drawMaterial) {
+              if (drawMaterial == boundMaterial)
+                return;
+              IRHIPipeline *pipeline = drawMaterial->GetPipeline(vertexFormat);
+              cmd->BindPipeline(pipeline);
+              cmd->PushConstants(pipeline, RHIShaderStage::Vertex, 0, sizeof(PushConstants), &push);
+
+              // Bind descriptor sets individually
+              cmd->BindDescriptorSet(pipeline,
+                                     m_globalDescriptorSets[frameIndex].get(), 0);
+              cmd->BindDescriptorSet(pipeline,
+                                     drawMaterial->GetDescriptorSet(), 1);
+              boundMaterial = drawMaterial;
+            };
+
+            if (render.materialSlots.empty()) {
+              Material *drawMaterial = resolveMaterial(render.materialHandle);
+              if (drawMaterial) {
+                bindMaterial(drawMaterial);
+                mesh->DrawCulled(cmd, model, frustum, cameraPosition, &m_clusterCullStats, render.currentLod);
+              }
+              continue;
+            }
+
+            // Per-slot materials: cull the object once, then draw its submeshes
+            // sorted by material so each pipeline and set binds once
+            if (mesh->GetAABB().IsValid() && !frustum.IntersectsAABB(mesh->GetAABB().Transformed(model)))
+              continue;
+
+            std::vector<std::pair<Material *, uint32_t>> submeshDraws;
+            submeshDraws.reserve(mesh->GetSubmeshCount());
+            for (uint32_t i = 0; i < mesh->GetSubmeshCount(); ++i) {
+              Material *drawMaterial = resolveMaterial(render.GetMaterialHandle(mesh->GetSubmesh(i).materialIndex));
+              if (drawMaterial) {
+                submeshDraws.emplace_back(drawMaterial, i);
+              }
+            }
+            std::sort(submeshDraws.begin(), submeshDraws.end());
+
+            mesh->Bind(cmd);
+            for (const auto &[drawMaterial, submesh] : submeshDraws) {
+              bindMaterial(drawMaterial);
+              mesh->DrawSubmeshCulled(cmd, submesh, model, frustum, cameraPosition, &m_clusterCullStats,
+                                      render.currentLod);
+            }
+          }
+
+          cmd->EndRendering();
+      });
 
-  cmdList->EndRendering();
+  m_renderGraph->Compile();
 
-  if (vkViewportTex) {
-      static_cast<VulkanCommandList*>(cmdList)->TransitionImageLayout(
-          vkViewportTex->GetImage(), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+  // The physical shadow map may change when the transient pool is rebuilt;
+  // repoint binding 1 before any pass binds the set.
+  IRHITexture *shadowTexture = m_renderGraph->GetTexture(shadowMap);
+  if (shadowTexture && m_shadowSampler && m_boundShadowMaps[frameIndex] != shadowTexture) {
+    auto &set = m_globalDescriptorSets[frameIndex];
+    set->UpdateCombinedImageSampler(1, shadowTexture, m_shadowSampler.get());
+    set->CommitUpdates();
+    m_boundShadowMaps[frameIndex] = shadowTexture;
   }
+
+  m_renderGraph->Execute(cmdList);
 }
 
 std::shared_ptr<Mesh>
@@ -755,6 +974,8 @@ SceneEditorSubsystem::GetOrLoadMaterial(const AssetHandle &handle) {
     return m_materialCache[handle];
 
   auto *assetManager = m_assetSubsystem->GetAssetManager();
+  // Material data is published only once its textures have settled, so the
+  // texture lookups below find them loaded on the first try
   auto matData = assetManager->GetAsset<MaterialData>(handle);
 
   if (matData && matData->IsValid()) {
@@ -786,7 +1007,8 @@ SceneEditorSubsystem::GetOrLoadMaterial(const AssetHandle &handle) {
 
       auto material =
           std::make_shared<Material>(m_renderSubsystem->GetDevice(), fixedData,
-                                     m_globalDescriptorSetLayout.get());
+                                     m_globalDescriptorSetLayout.get(),
+                                     m_renderSubsystem->GetPipelineCompilePool());
 
       // Helper to load and set a texture
       auto loadAndSetTexture =
@@ -799,9 +1021,19 @@ SceneEditorSubsystem::GetOrLoadMaterial(const AssetHandle &handle) {
             auto texData = assetManager->GetAsset<TextureData>(texHandle);
 
             if (texData && texData->IsValid()) {
-              auto texture = std::make_shared<Texture>(
-                  m_renderSubsystem->GetDevice(), *texData);
-              (material.get()->*setter)(texture);
+              // A texture the device cannot sample (e.g. BC without
+              // textureCompressionBC) leaves the slot on its default
+              try {
+                // Starts with the low mips; RenderScene streams in the rest
+                auto texture = m_textureStreamer
+                                   ? m_textureStreamer->GetOrCreate(texHandle, texData)
+                                   : std::make_shared<Texture>(m_renderSubsystem->GetDevice(), *texData);
+                if (texture)
+                  (material.get()->*setter)(texture);
+              } catch (const std::exception &e) {
+                Logger::Warning("SceneEditorSubsystem",
+                                "Skipping texture '{}': {}", path, e.what());
+              }
             }
           };
 
@@ -832,6 +1064,80 @@ SceneEditorSubsystem::GetOrLoadMaterial(const AssetHandle &handle) {
   return nullptr;
 }
 
+void SceneEditorSubsystem::OnAssetReloaded(const AssetHandle &handle) {
+  bool cached = m_meshCache.count(handle) || m_materialCache.count(handle) ||
+                (m_textureStreamer && m_textureStreamer->Contains(handle));
+  if (!cached)
+    return;
+
+  // Frames in flight may still read the old buffers and images. Reloads
+  // follow a file save, so a stall here is not noticeable.
+  m_renderSubsystem->GetDevice()->WaitIdle();
+
+  // Rebuilt from the new data the next time the scene asks for them. A
+  // material is reported too when one of its textures changed.
+  m_meshCache.erase(handle);
+  m_materialCache.erase(handle);
+  if (m_textureStreamer)
+    m_textureStreamer->Remove(handle);
+  Logger::Info("SceneEditorSubsystem", "Reloaded '{}'",
+               m_assetSubsystem->GetAssetManager()->GetAssetPath(handle));
+}
+
+void SceneEditorSubsystem::RequestTextureResidency(const RenderComponent &render, const Mesh *mesh,
+                                                   float screenPixels) {
+  auto request = [&](const AssetHandle &handle) {
+    auto material = GetOrLoadMaterial(handle);
+    if (!material)
+      return;
+    for (Texture *texture : material->GetTextureMaps()) {
+      if (texture)
+        m_textureStreamer->RequestResidency(texture, screenPixels);
+    }
+  };
+
+  if (render.materialSlots.empty()) {
+    request(render.materialHandle);
+    return;
+  }
+  for (uint32_t i = 0; i < mesh->GetSubmeshCount(); ++i) {
+    request(render.GetMaterialHandle(mesh->GetSubmesh(i).materialIndex));
+  }
+}
+
+void SceneEditorSubsystem::UpdateTextureStreaming() {
+  m_textureStreamer->Update();
+
+  const auto &changed = m_textureStreamer->GetChangedTextures();
+  if (changed.empty())
+    return;
+
+  std::unordered_set<const Texture *> changedSet(changed.begin(), changed.end());
+  for (auto &[handle, material] : m_materialCache) {
+    if (!material)
+      continue;
+    for (Texture *texture : material->GetTextureMaps()) {
+      if (texture && changedSet.count(texture)) {
+        material->UpdateDescriptorSet();
+        break;
+      }
+    }
+  }
+}
+
+void SceneEditorSubsystem::SetTextureBudget(uint64_t bytes) {
+  if (!m_textureStreamer)
+    return;
+  TextureStreamingSettings settings = m_textureStreamer->GetSettings();
+  settings.budgetBytes = bytes;
+  m_textureStreamer->SetSettings(settings);
+}
+
+const TextureStreamingStats &SceneEditorSubsystem::GetTextureStreamingStats() const {
+  static const TextureStreamingStats empty{};
+  return m_textureStreamer ? m_textureStreamer->GetStats() : empty;
+}
+
 void SceneEditorSubsystem::ExecuteCommand(uint32_t type) { (void)type; }
 
 void SceneEditorSubsystem::HandleFileDrop(FileDropEvent &e) {
@@ -8,7 +8,11 @@
 #include "../../Subsystems/Scene/Scene.h"
 #include "../Renderer/Core/Material.h"
 #include "../Renderer/Core/Mesh.h"
+#include "../Renderer/Core/RenderGraph.h"
+#include "../Renderer/Core/ShadowCascades.h"
 #include "../Renderer/Core/Texture.h"
+#include "../Renderer/Core/TextureStreamer.h"
+#include <array>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -60,10 +64,22 @@ public:
       glm::vec4 color;     // w = intensity
       glm::vec4 params;    // x = inner, y = outer
     } lights[4];
+    glm::mat4 cascadeViewProj[MAX_SHADOW_CASCADES];
+    glm::vec4 cascadeSplits; // View-space far distance of each cascade
+    int cascadeCount = 0;
+    int cascadePadding[3];
   };
 
+  struct ShadowPushConstants {
+      glm::mat4 model;
+      glm::mat4 lightViewProj;
+  };
+
+  // Must match the push block in PBR.vert
   struct PushConstants {
       glm::mat4 model;
+      glm::vec4 positionScale;
+      glm::vec4 positionOffset;
   };
 
   SceneEditorSubsystem();
@@ -88,6 +104,27 @@ public:
 
   std::shared_ptr<Material> GetOrLoadMaterial(const AssetHandle &handle);
 
+  // Shadow Settings
+  void SetShadowCascadeCount(uint32_t count) {
+    m_shadowSettings.cascadeCount = glm::clamp(count, 1u, MAX_SHADOW_CASCADES);
+  }
+  void SetShadowSplitLambda(float lambda) {
+    m_shadowSettings.splitLambda = glm::clamp(lambda, 0.0f, 1.0f);
+  }
+  const ShadowCascadeSettings &GetShadowSettings() const { return m_shadowSettings; }
+
+  // LOD selection
+  void SetLodMaxScreenError(float pixels) { m_lodSettings.maxScreenError = std::max(pixels, 0.0f); }
+  void SetLodHysteresis(float hysteresis) { m_lodSettings.hysteresis = glm::clamp(hysteresis, 0.0f, 0.9f); }
+  const LodSelectionSettings &GetLodSettings() const { return m_lodSettings; }
+
+  // Meshlet culling results of the last rendered frame (main pass)
+  const ClusterCullStats &GetClusterCullStats() const { return m_clusterCullStats; }
+
+  // Texture streaming
+  void SetTextureBudget(uint64_t bytes);
+  const TextureStreamingStats &GetTextureStreamingStats() const;
+
   // UI Draw (Called by UISubsystem)
 
   // UI Draw (Called by UISubsystem)
@@ -138,17 +175,22 @@ private:
 
   // Viewport & Rendering Resources
   std::shared_ptr<IRHITexture> m_viewportTexture;
-  std::shared_ptr<IRHITexture> m_viewportDepth;
   std::shared_ptr<IRHISampler> m_viewportSampler;
   void *m_viewportDescriptorSet = nullptr;
 
+  // Frame graph; owns transient attachments (viewport depth, shadow map)
+  std::unique_ptr<RenderGraph> m_renderGraph;
+
   // Shadow Mapping Resources
-  std::shared_ptr<IRHITexture> m_shadowMap;
+  std::array<IRHITexture *, MAX_FRAMES_IN_FLIGHT> m_boundShadowMaps{};
   std::shared_ptr<IRHISampler> m_shadowSampler;
-  uint32_t m_shadowMapSize = 2048;
-  std::shared_ptr<IRHIPipeline> m_shadowPipeline;
+  ShadowCascadeSettings m_shadowSettings;
+  std::array<std::shared_ptr<IRHIPipeline>, VERTEX_FORMAT_COUNT> m_shadowPipelines; // Per VertexFormat
   std::shared_ptr<IRHIDescriptorSetLayout> m_shadowDescriptorSetLayout;
 
+  ClusterCullStats m_clusterCullStats;
+  LodSelectionSettings m_lodSettings;
+
   // IBL Resources
   std::shared_ptr<IRHITexture> m_irradianceMap;
   std::shared_ptr<IRHITexture> m_prefilterMap;
@@ -159,9 +201,19 @@ private:
   std::unordered_map<AssetHandle, std::shared_ptr<Mesh>> m_meshCache;
   std::unordered_map<AssetHandle, std::shared_ptr<Material>> m_materialCache;
 
+  // Drops GPU resources built from an asset that was hot-reloaded
+  void OnAssetReloaded(const AssetHandle &handle);
+  uint64_t m_reloadListener = 0;
+
   // Helpers
   std::shared_ptr<Mesh> GetOrLoadMesh(const AssetHandle &handle);
 
+  // Reports the screen size of an entity's materials to the texture streamer
+  void RequestTextureResidency(const RenderComponent &render, const Mesh *mesh, float screenPixels);
+  // Applies streaming requests and rebinds materials whose textures changed
+  void UpdateTextureStreaming();
+  std::unique_ptr<TextureStreamer> m_textureStreamer;
+
   // UI Layout
   void RenderMainMenuBar();
   void ResetLayout(); // Reconfigures DockSpace to UE5 style
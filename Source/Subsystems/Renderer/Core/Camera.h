@@ -48,6 +48,8 @@ public:
     glm::vec3 GetFront() const { return m_front; }
     float GetYaw() const { return m_yaw; }
     float GetPitch() const { return m_pitch; }
+    float GetNearPlane() const { return m_nearPlane; }
+    float GetFarPlane() const { return m_farPlane; }
 
 private:
     // Calculates the front vector from the Camera's (updated) Euler Angles
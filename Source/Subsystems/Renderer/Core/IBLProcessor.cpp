@@ -45,6 +45,7 @@ std::shared_ptr<Texture> IBLProcessor::ConvertEquirectangularToCubemap(const std
     
     auto sampler = m_device->CreateSampler(samplerDesc);
     descriptorSet->UpdateCombinedImageSampler(0, equirectTexture->GetRHITexture(), sampler.get());
+    descriptorSet->CommitUpdates();
 
     // Create Pipeline
     RHIPipelineStateDescriptor pipelineDesc{};
@@ -145,6 +146,7 @@ std::shared_ptr<Texture> IBLProcessor::CreateIrradianceMap(const std::shared_ptr
     auto sampler = m_device->CreateSampler(samplerDesc);
 
     descriptorSet->UpdateCombinedImageSampler(0, cubemap->GetRHITexture(), sampler.get());
+    descriptorSet->CommitUpdates();
 
     RHIPipelineStateDescriptor pipelineDesc{};
     pipelineDesc.vertexShader = vertShader.get();
@@ -241,6 +243,7 @@ std::shared_ptr<Texture> IBLProcessor::CreatePrefilteredMap(const std::shared_pt
     auto sampler = m_device->CreateSampler(samplerDesc);
 
     descriptorSet->UpdateCombinedImageSampler(0, cubemap->GetRHITexture(), sampler.get());
+    descriptorSet->CommitUpdates();
 
     RHIPipelineStateDescriptor pipelineDesc{};
     pipelineDesc.vertexShader = vertShader.get();
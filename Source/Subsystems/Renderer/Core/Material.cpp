@@ -1,4 +1,9 @@
 #include "Material.h"
+#include "Core/Logger.h"
+#include "Core/ThreadPool.h"
+#include "VertexLayout.h"
+#include <chrono>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 
@@ -9,7 +14,8 @@ std::shared_ptr<Texture> Material::s_defaultBlackTexture = nullptr;
 std::shared_ptr<Texture> Material::s_defaultNormalTexture = nullptr;
 
 Material::Material(IRHIDevice *device, const MaterialData &data,
-                   IRHIDescriptorSetLayout *globalLayout)
+                   IRHIDescriptorSetLayout *globalLayout,
+                   ThreadPool *compilePool)
     : m_device(device), m_data(data) {
 
   if (!s_defaultWhiteTexture) {
@@ -18,12 +24,52 @@ Material::Material(IRHIDevice *device, const MaterialData &data,
     s_defaultNormalTexture = Texture::CreateFlatTexture(m_device, 1, 1, glm::vec4(0.5f, 0.5f, 1.0f, 1.0f));
   }
 
-  CreateUniformBuffer();
-  CreatePipeline(data.vertexShaderPath, data.fragmentShaderPath, globalLayout);
+  CreateUniformBuffer(BuildUniforms());
+  CreatePipeline(data.vertexShaderPath, data.fragmentShaderPath, globalLayout,
+                 compilePool);
   CreateDescriptorSet();
 }
 
-Material::~Material() {}
+Material::~Material() {
+  // Compile tasks reference our layouts; don't tear down under them
+  for (auto &variant : m_pipelines) {
+    if (variant.pending.valid()) {
+      variant.pending.wait();
+    }
+  }
+}
+
+bool Material::IsPipelineReady(VertexFormat format) {
+  auto &variant = m_pipelines[static_cast<size_t>(format)];
+  if (variant.pipeline)
+    return true;
+  if (!variant.requested)
+    RequestPipeline(format);
+  if (!variant.pending.valid())
+    return variant.pipeline != nullptr;
+
+  if (variant.pending.wait_for(std::chrono::seconds(0)) !=
+      std::future_status::ready)
+    return false;
+
+  try {
+    variant.pipeline = variant.pending.get();
+  } catch (const std::exception &e) {
+    Logger::Error("Material", "Pipeline compilation failed for '{}': {}",
+                  m_data.name, e.what());
+    variant.failed = true;
+  }
+  return variant.pipeline != nullptr;
+}
+
+bool Material::WaitForPipeline(VertexFormat format) {
+  auto &variant = m_pipelines[static_cast<size_t>(format)];
+  if (!variant.pipeline && !variant.requested)
+    RequestPipeline(format);
+  if (variant.pending.valid())
+    variant.pending.wait();
+  return IsPipelineReady(format);
+}
 
 void Material::SetAlbedoMap(std::shared_ptr<Texture> texture) {
   m_albedoMap = texture;
@@ -89,13 +135,7 @@ std::vector<uint8_t> Material::ReadShaderFile(const std::string &filepath) {
   return buffer;
 }
 
-void Material::CreateUniformBuffer() {
-  // Create buffer for MaterialUniforms
-  m_uniformBuffer = m_device->CreateBuffer(
-      sizeof(MaterialUniforms), RHIBufferUsage::Uniform,
-      RHIMemoryProperty::HostVisible | RHIMemoryProperty::HostCoherent);
-
-  // Initialize with default data
+MaterialUniforms Material::BuildUniforms() const {
   MaterialUniforms uniforms{};
   uniforms.baseColor =
       glm::vec4(m_data.properties.baseColor, m_data.properties.opacity);
@@ -105,91 +145,93 @@ void Material::CreateUniformBuffer() {
   uniforms.emissiveIntensity = m_data.properties.emissiveIntensity;
   uniforms.emissiveColor = glm::vec4(m_data.properties.emissiveColor, 1.0f);
 
-  uniforms.useNormalMap = 0;
-  uniforms.useMetallicMap = 0;
-  uniforms.useRoughnessMap = 0;
-  uniforms.useAOMap = 0;
-  uniforms.useEmissiveMap = 0;
+  uniforms.useNormalMap = m_normalMap ? 1 : 0;
+  uniforms.useMetallicMap = m_metallicMap ? 1 : 0;
+  uniforms.useRoughnessMap = m_roughnessMap ? 1 : 0;
+  uniforms.useAOMap = m_aoMap ? 1 : 0;
+  uniforms.useEmissiveMap = m_emissiveMap ? 1 : 0;
+  return uniforms;
+}
+
+void Material::CreateUniformBuffer(const MaterialUniforms &uniforms) {
+  // Filled once, before any frame can read it
+  m_uniformBuffer = m_device->CreateBuffer(
+      sizeof(MaterialUniforms), RHIBufferUsage::Uniform,
+      RHIMemoryProperty::HostVisible | RHIMemoryProperty::HostCoherent);
 
   void *data = m_uniformBuffer->Map();
   memcpy(data, &uniforms, sizeof(MaterialUniforms));
   m_uniformBuffer->Unmap();
+  m_uniforms = uniforms;
 }
 
 void Material::CreateDescriptorSet() {
   if (!m_descriptorSetLayout)
     return;
 
-  m_descriptorSet =
-      m_device->AllocateDescriptorSet(m_descriptorSetLayout.get());
   UpdateDescriptorSet();
 }
 
 void Material::UpdateDescriptorSet() {
-  if (!m_descriptorSet)
+  if (!m_descriptorSetLayout)
     return;
 
-  // Update Uniforms state based on texture presence
-  MaterialUniforms uniforms{};
-  uniforms.baseColor =
-      glm::vec4(m_data.properties.baseColor, m_data.properties.opacity);
-  uniforms.metallic = m_data.properties.metallic;
-  uniforms.roughness = m_data.properties.roughness;
-  uniforms.ao = m_data.properties.ao;
-  uniforms.emissiveIntensity = m_data.properties.emissiveIntensity;
-  uniforms.emissiveColor = glm::vec4(m_data.properties.emissiveColor, 1.0f);
-
-  uniforms.useNormalMap = m_normalMap ? 1 : 0;
-  uniforms.useMetallicMap = m_metallicMap ? 1 : 0;
-  uniforms.useRoughnessMap = m_roughnessMap ? 1 : 0;
-  uniforms.useAOMap = m_aoMap ? 1 : 0;
-  uniforms.useEmissiveMap = m_emissiveMap ? 1 : 0;
+  // A frame may still read the current buffer; write a new one instead
+  MaterialUniforms uniforms = BuildUniforms();
+  if (memcmp(&uniforms, &m_uniforms, sizeof(MaterialUniforms)) != 0) {
+    m_device->ReleaseDeferred(std::move(m_uniformBuffer));
+    CreateUniformBuffer(uniforms);
+  }
 
-  // Upload uniforms
-  void *data = m_uniformBuffer->Map();
-  memcpy(data, &uniforms, sizeof(MaterialUniforms));
-  m_uniformBuffer->Unmap();
+  // Likewise for the set: the old one is freed once its frames retire
+  auto descriptorSet =
+      m_device->AllocateDescriptorSet(m_descriptorSetLayout.get());
 
   // Binding 0: Material Uniforms
   if (m_uniformBuffer) {
-    m_descriptorSet->UpdateUniformBuffer(0, m_uniformBuffer.get(), 0,
-                                         sizeof(MaterialUniforms));
+    descriptorSet->UpdateUniformBuffer(0, m_uniformBuffer.get(), 0,
+                                       sizeof(MaterialUniforms));
   }
 
   // Binding 1: Albedo Map
   auto albedo = m_albedoMap ? m_albedoMap : s_defaultWhiteTexture;
-  m_descriptorSet->UpdateCombinedImageSampler(1, albedo->GetRHITexture(),
-                                              albedo->GetRHISampler());
+  descriptorSet->UpdateCombinedImageSampler(1, albedo->GetRHITexture(),
+                                            albedo->GetRHISampler());
 
   // Binding 2: Normal Map
   auto normal = m_normalMap ? m_normalMap : s_defaultNormalTexture;
-  m_descriptorSet->UpdateCombinedImageSampler(2, normal->GetRHITexture(),
-                                              normal->GetRHISampler());
+  descriptorSet->UpdateCombinedImageSampler(2, normal->GetRHITexture(),
+                                            normal->GetRHISampler());
 
   // Binding 3: Metallic Map
   auto metallic = m_metallicMap ? m_metallicMap : s_defaultBlackTexture;
-  m_descriptorSet->UpdateCombinedImageSampler(
+  descriptorSet->UpdateCombinedImageSampler(
       3, metallic->GetRHITexture(), metallic->GetRHISampler());
 
   // Binding 4: Roughness Map
   auto roughness = m_roughnessMap ? m_roughnessMap : s_defaultWhiteTexture;
-  m_descriptorSet->UpdateCombinedImageSampler(
+  descriptorSet->UpdateCombinedImageSampler(
       4, roughness->GetRHITexture(), roughness->GetRHISampler());
 
   // Binding 5: AO Map
   auto ao = m_aoMap ? m_aoMap : s_defaultWhiteTexture;
-  m_descriptorSet->UpdateCombinedImageSampler(5, ao->GetRHITexture(),
-                                              ao->GetRHISampler());
+  descriptorSet->UpdateCombinedImageSampler(5, ao->GetRHITexture(),
+                                            ao->GetRHISampler());
 
   // Binding 6: Emissive Map
   auto emissive = m_emissiveMap ? m_emissiveMap : s_defaultBlackTexture;
-  m_descriptorSet->UpdateCombinedImageSampler(
+  descriptorSet->UpdateCombinedImageSampler(
       6, emissive->GetRHITexture(), emissive->GetRHISampler());
+
+  // All 7 bindings go to the driver in one vkUpdateDescriptorSets call
+  descriptorSet->CommitUpdates();
+  m_descriptorSet = std::move(descriptorSet);
 }
 
 void Material::CreatePipeline(const std::string &vertPath,
                               const std::string &fragPath,
-                              IRHIDescriptorSetLayout *globalLayout) {
+                              IRHIDescriptorSetLayout *globalLayout,
+                              ThreadPool *compilePool) {
   // 1. Create Descriptor Set Layout (Set 1: Material)
   std::vector<RHIDescriptorSetLayoutBinding> bindings;
 
@@ -274,53 +316,7 @@ void Material::CreatePipeline(const std::string &vertPath,
   // Set 1: Material
   pipelineDesc.descriptorSetLayouts.push_back(m_descriptorSetLayout.get());
 
-  // Vertex Bindings (Standard Layout - Hardcoded for now)
-  RHIVertexInputBinding binding{};
-  binding.binding = 0;
-  binding.stride = 56; // sizeof(Vertex)
-  binding.isInstanced = false;
-  pipelineDesc.vertexBindings.push_back(binding);
-
-  // Vertex Attributes
-  // Position
-  RHIVertexInputAttribute posAttr{};
-  posAttr.location = 0;
-  posAttr.binding = 0;
-  posAttr.format = RHIFormat::R32G32B32_FLOAT;
-  posAttr.offset = 0;
-  pipelineDesc.vertexAttributes.push_back(posAttr);
-
-  // Normal
-  RHIVertexInputAttribute normAttr{};
-  normAttr.location = 1;
-  normAttr.binding = 0;
-  normAttr.format = RHIFormat::R32G32B32_FLOAT;
-  normAttr.offset = 12;
-  pipelineDesc.vertexAttributes.push_back(normAttr);
-
-  // TexCoord
-  RHIVertexInputAttribute uvAttr{};
-  uvAttr.location = 2;
-  uvAttr.binding = 0;
-  uvAttr.format = RHIFormat::R32G32_FLOAT;
-  uvAttr.offset = 24;
-  pipelineDesc.vertexAttributes.push_back(uvAttr);
-
-  // Tangent
-  RHIVertexInputAttribute tanAttr{};
-  tanAttr.location = 3;
-  tanAttr.binding = 0;
-  tanAttr.format = RHIFormat::R32G32B32_FLOAT;
-  tanAttr.offset = 32;
-  pipelineDesc.vertexAttributes.push_back(tanAttr);
-
-  // Bitangent
-  RHIVertexInputAttribute bitanAttr{};
-  bitanAttr.location = 4;
-  bitanAttr.binding = 0;
-  bitanAttr.format = RHIFormat::R32G32B32_FLOAT;
-  bitanAttr.offset = 44;
-  pipelineDesc.vertexAttributes.push_back(bitanAttr);
+  // Vertex bindings/attributes are filled per VertexFormat in RequestPipeline
 
   // Rasterizer
   pipelineDesc.cullMode = RHICullMode::Back;
@@ -335,14 +331,52 @@ void Material::CreatePipeline(const std::string &vertPath,
   pipelineDesc.colorFormats = {RHIFormat::B8G8R8A8_SRGB};
   pipelineDesc.depthFormat = RHIFormat::D32_FLOAT;
 
-  // Push Constants for model matrix
+  // Push Constants: model matrix + vertex decode params (Mesh::VertexDecodeParams)
   RHIPushConstantRange pushConstant{};
   pushConstant.stageFlags = RHIShaderStage::Vertex;
   pushConstant.offset = 0;
-  pushConstant.size = sizeof(glm::mat4);
+  pushConstant.size = sizeof(glm::mat4) + 2 * sizeof(glm::vec4);
   pipelineDesc.pushConstants.push_back(pushConstant);
 
-  m_pipeline = m_device->CreateGraphicsPipeline(pipelineDesc);
+  m_pipelineDesc = pipelineDesc;
+  m_vertexShader = vertexShader;
+  m_fragmentShader = fragmentShader;
+  m_compilePool = compilePool;
+
+  // Nearly every mesh uses the standard layout; start it right away
+  RequestPipeline(VertexFormat::Standard);
+}
+
+void Material::RequestPipeline(VertexFormat format) {
+  auto &variant = m_pipelines[static_cast<size_t>(format)];
+  variant.requested = true;
+
+  RHIPipelineStateDescriptor pipelineDesc = m_pipelineDesc;
+  VertexLayout::Apply(pipelineDesc, format);
+
+  if (!m_compilePool) {
+    if (format == VertexFormat::Standard) {
+      // Constructor path: let failures propagate as before
+      variant.pipeline = m_device->CreateGraphicsPipeline(pipelineDesc);
+      return;
+    }
+    try {
+      variant.pipeline = m_device->CreateGraphicsPipeline(pipelineDesc);
+    } catch (const std::exception &e) {
+      Logger::Error("Material", "Pipeline compilation failed for '{}': {}",
+                    m_data.name, e.what());
+      variant.failed = true;
+    }
+    return;
+  }
+
+  // Shaders and the material layout are captured so they outlive the task;
+  // the global layout is owned by the caller, and ~Material waits on us.
+  variant.pending = m_compilePool->Submit(
+      [device = m_device, pipelineDesc, vertexShader = m_vertexShader,
+       fragmentShader = m_fragmentShader, layout = m_descriptorSetLayout]() {
+        return device->CreateGraphicsPipeline(pipelineDesc);
+      });
 }
 
 } // namespace AstralEngine
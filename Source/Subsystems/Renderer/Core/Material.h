@@ -5,13 +5,17 @@
 #include "Subsystems/Renderer/RHI/IRHIDevice.h"
 #include "Subsystems/Renderer/RHI/IRHIPipeline.h"
 #include "Texture.h"
+#include <array>
 #include <glm/glm.hpp>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace AstralEngine {
 
+class ThreadPool;
+
 struct MaterialUniforms {
   glm::vec4 baseColor;
   float metallic;
@@ -30,8 +34,11 @@ struct MaterialUniforms {
 
 class Material {
 public:
+  // With a compile pool the pipeline is built on a worker thread; until
+  // IsPipelineReady() returns true callers should draw with a fallback.
   Material(IRHIDevice *device, const MaterialData &data,
-           IRHIDescriptorSetLayout *globalLayout);
+           IRHIDescriptorSetLayout *globalLayout,
+           ThreadPool *compilePool = nullptr);
   ~Material();
 
   void SetAlbedoMap(std::shared_ptr<Texture> texture);
@@ -63,9 +70,28 @@ public:
     return m_data.properties.emissiveIntensity;
   }
 
+  // Writes the current maps and properties into a freshly allocated
+  // descriptor set (and a new uniform buffer if the properties changed).
+  // Sets and buffers are never modified once written, since frames in flight
+  // may still read them; the old ones are released through the device's
+  // deferred frees.
   void UpdateDescriptorSet();
 
-  IRHIPipeline *GetPipeline() const { return m_pipeline.get(); }
+  // Picks up a finished background compile; call from the render thread.
+  // The first query for a vertex format other than Standard starts its
+  // compile, so packed meshes only pay for the variant when one is drawn.
+  bool IsPipelineReady(VertexFormat format = VertexFormat::Standard);
+  // Blocks until the variant's compile has finished (starting it if needed);
+  // false if it failed. For load time, never the render loop.
+  bool WaitForPipeline(VertexFormat format = VertexFormat::Standard);
+  bool HasPipelineFailed(VertexFormat format = VertexFormat::Standard) const {
+    return m_pipelines[static_cast<size_t>(format)].failed;
+  }
+
+  IRHIPipeline *
+  GetPipeline(VertexFormat format = VertexFormat::Standard) const {
+    return m_pipelines[static_cast<size_t>(format)].pipeline.get();
+  }
   IRHIDescriptorSetLayout *GetDescriptorSetLayout() const {
     return m_descriptorSetLayout.get();
   }
@@ -73,20 +99,43 @@ public:
 
   std::shared_ptr<Texture> GetAlbedoMap() const { return m_albedoMap; }
 
+  // Assigned maps (albedo, normal, metallic, roughness, AO, emissive); null
+  // where the default texture is bound
+  std::array<Texture *, 6> GetTextureMaps() const {
+    return {m_albedoMap.get(),    m_normalMap.get(), m_metallicMap.get(),
+            m_roughnessMap.get(), m_aoMap.get(),     m_emissiveMap.get()};
+  }
+
 private:
   void CreatePipeline(const std::string &vertPath, const std::string &fragPath,
-                      IRHIDescriptorSetLayout *globalLayout);
+                      IRHIDescriptorSetLayout *globalLayout,
+                      ThreadPool *compilePool);
+  void RequestPipeline(VertexFormat format);
   std::vector<uint8_t> ReadShaderFile(const std::string &filepath);
-  void CreateUniformBuffer();
+  MaterialUniforms BuildUniforms() const;
+  void CreateUniformBuffer(const MaterialUniforms &uniforms);
   void CreateDescriptorSet();
 
   IRHIDevice *m_device;
   MaterialData m_data;
 
-  std::shared_ptr<IRHIPipeline> m_pipeline;
+  struct PipelineVariant {
+    std::shared_ptr<IRHIPipeline> pipeline;
+    std::future<std::shared_ptr<IRHIPipeline>> pending;
+    bool requested = false;
+    bool failed = false;
+  };
+  std::array<PipelineVariant, VERTEX_FORMAT_COUNT> m_pipelines;
+
+  // Everything but the vertex input; kept to build further variants
+  RHIPipelineStateDescriptor m_pipelineDesc{};
+  std::shared_ptr<IRHIShader> m_vertexShader;
+  std::shared_ptr<IRHIShader> m_fragmentShader;
+  ThreadPool *m_compilePool = nullptr;
   std::shared_ptr<IRHIDescriptorSetLayout> m_descriptorSetLayout;
   std::shared_ptr<IRHIDescriptorSet> m_descriptorSet;
   std::shared_ptr<IRHIBuffer> m_uniformBuffer;
+  MaterialUniforms m_uniforms{}; // Contents of m_uniformBuffer
 
   std::shared_ptr<Texture> m_albedoMap;
   std::shared_ptr<Texture> m_normalMap;
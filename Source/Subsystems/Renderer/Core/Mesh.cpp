@@ -1,25 +1,108 @@
 #include "Mesh.h"
 #include "Core/Logger.h"
+#include "../../Asset/VertexQuantizer.h"
+
+#include <algorithm>
 
 namespace AstralEngine {
 
+    namespace {
+
+        // Meshlet visibility for one object transform; adjacent survivors are
+        // merged into a single draw until Flush
+        class MeshletCuller {
+        public:
+            MeshletCuller(IRHICommandList* cmdList, const glm::mat4& model, const Frustum& frustum,
+                          const glm::vec3& cameraPosition, ClusterCullStats* stats)
+                : m_cmdList(cmdList), m_model(model), m_linear(model), m_frustum(frustum),
+                  m_cameraPosition(cameraPosition), m_stats(stats) {
+                // Spheres scale by the largest axis; cones only survive rotation and
+                // uniform scale, and mirroring flips the winding they were built from
+                glm::vec3 axisScale(glm::length(m_linear[0]), glm::length(m_linear[1]), glm::length(m_linear[2]));
+                m_maxScale = std::max(axisScale.x, std::max(axisScale.y, axisScale.z));
+                float minScale = std::min(axisScale.x, std::min(axisScale.y, axisScale.z));
+                m_coneCulling = minScale > 0.0f && m_maxScale / minScale < 1.01f && glm::determinant(m_linear) > 0.0f;
+            }
+
+            void Cull(const Meshlet& meshlet) {
+                glm::vec3 center = glm::vec3(m_model * glm::vec4(meshlet.center, 1.0f));
+                float radius = meshlet.radius * m_maxScale;
+
+                bool visible = m_frustum.IntersectsSphere(center, radius);
+                if (visible && m_coneCulling && meshlet.coneCutoff < 1.0f) {
+                    glm::vec3 axis = glm::normalize(m_linear * meshlet.coneAxis);
+                    glm::vec3 toCenter = center - m_cameraPosition;
+                    visible = glm::dot(toCenter, axis) < meshlet.coneCutoff * glm::length(toCenter) + radius;
+                }
+
+                if (m_stats) {
+                    m_stats->meshletsTested++;
+                    m_stats->meshletsVisible += visible ? 1 : 0;
+                }
+                if (!visible) {
+                    Flush();
+                    return;
+                }
+
+                if (m_runCount > 0 && m_runStart + m_runCount == meshlet.indexOffset) {
+                    m_runCount += meshlet.triangleCount * 3;
+                } else {
+                    Flush();
+                    m_runStart = meshlet.indexOffset;
+                    m_runCount = meshlet.triangleCount * 3;
+                }
+            }
+
+            void Flush() {
+                if (m_runCount == 0) return;
+                m_cmdList->DrawIndexed(m_runCount, 1, m_runStart, 0, 0);
+                if (m_stats) {
+                    m_stats->trianglesSubmitted += m_runCount / 3;
+                    m_stats->drawCalls++;
+                }
+                m_runCount = 0;
+            }
+
+        private:
+            IRHICommandList* m_cmdList;
+            glm::mat4 m_model;
+            glm::mat3 m_linear;
+            const Frustum& m_frustum;
+            glm::vec3 m_cameraPosition;
+            ClusterCullStats* m_stats;
+            float m_maxScale = 1.0f;
+            bool m_coneCulling = false;
+            uint32_t m_runStart = 0;
+            uint32_t m_runCount = 0;
+        };
+
+    } // namespace
+
     Mesh::Mesh(IRHIDevice* device, const ModelData& modelData)
-        : m_device(device), m_vertexCount(0), m_indexCount(0), m_boundingBox(modelData.boundingBox) {
+        : m_device(device), m_vertexCount(0), m_indexCount(0), m_boundingBox(modelData.boundingBox),
+          m_vertexFormat(modelData.vertexFormat) {
+
+        auto vertexData = modelData.GetVertexData();
+        auto indices = modelData.GetIndices();
 
-        if (modelData.vertices.empty()) {
+        if (vertexData.empty()) {
             Logger::Warning("Mesh", "Attempted to create mesh with no vertices.");
             return;
         }
 
-        m_vertexCount = static_cast<uint32_t>(modelData.vertices.size());
-        m_indexCount = static_cast<uint32_t>(modelData.indices.size());
+        m_vertexCount = static_cast<uint32_t>(modelData.GetVertexCount());
+        m_indexCount = static_cast<uint32_t>(indices.size());
 
-        // Create Vertex Buffer
-        size_t vertexBufferSize = sizeof(Vertex) * m_vertexCount;
+        if (m_vertexFormat == VertexFormat::Packed) {
+            m_decodeParams.positionScale = glm::vec4(VertexQuantizer::GetPositionScale(m_boundingBox), 1.0f);
+            m_decodeParams.positionOffset = glm::vec4(VertexQuantizer::GetPositionOffset(m_boundingBox), 0.0f);
+        }
+
+        // Create Vertex Buffer (raw bytes of whichever layout the model uses)
         m_vertexBuffer = m_device->CreateAndUploadBuffer(
-            vertexBufferSize,
+            vertexData.size(),
             RHIBufferUsage::Vertex,
-            modelData.vertices.data()
+            vertexData.data()
         );
 
         // Create Index Buffer (if indices exist)
@@ -28,11 +111,38 @@ namespace AstralEngine {
             m_indexBuffer = m_device->CreateAndUploadBuffer(
                 indexBufferSize,
                 RHIBufferUsage::Index,
-                modelData.indices.data()
+                indices.data()
             );
         }
 
-        Logger::Info("Mesh", "Created mesh with {} vertices and {} indices.", m_vertexCount, m_indexCount);
+        auto meshlets = modelData.GetMeshlets();
+        if (m_indexBuffer && !meshlets.empty()) {
+            m_meshlets.assign(meshlets.begin(), meshlets.end());
+        }
+
+        auto lods = modelData.GetLods();
+        if (m_indexBuffer && !lods.empty()) {
+            m_lods.assign(lods.begin(), lods.end());
+        } else {
+            m_lods.push_back({ 0, m_indexCount, 0, static_cast<uint32_t>(m_meshlets.size()), 0.0f });
+        }
+
+        auto submeshes = modelData.GetSubmeshes();
+        if (m_indexBuffer && !submeshes.empty()) {
+            m_submeshes.assign(submeshes.begin(), submeshes.end());
+        } else {
+            Submesh whole;
+            whole.vertexCount = m_vertexCount;
+            whole.bounds = m_boundingBox;
+            for (size_t i = 0; i < std::min<size_t>(m_lods.size(), MAX_MESH_LODS); ++i) {
+                whole.lods[i] = m_lods[i];
+            }
+            m_submeshes.push_back(whole);
+        }
+
+        Logger::Info("Mesh", "Created mesh with {} {} vertices, {} indices, {} submeshes, {} meshlets and {} LODs.",
+                     m_vertexCount, m_vertexFormat == VertexFormat::Packed ? "packed" : "standard", m_indexCount,
+                     m_submeshes.size(), m_meshlets.size(), m_lods.size());
     }
 
     Mesh::~Mesh() {
@@ -87,16 +197,138 @@ namespace AstralEngine {
         }
     }
 
-    void Mesh::Draw(IRHICommandList* cmdList) {
+    void Mesh::Draw(IRHICommandList* cmdList, uint32_t lod) {
         if (!m_vertexBuffer) return;
 
         Bind(cmdList);
 
         if (m_indexBuffer) {
-            cmdList->DrawIndexed(m_indexCount, 1, 0, 0, 0);
+            const MeshLod& range = GetLod(lod);
+            cmdList->DrawIndexed(range.indexCount, 1, range.indexOffset, 0, 0);
         } else {
             cmdList->Draw(m_vertexCount, 1, 0, 0);
         }
     }
 
+    void Mesh::DrawSubmesh(IRHICommandList* cmdList, uint32_t submesh, uint32_t lod) {
+        if (!m_vertexBuffer || submesh >= m_submeshes.size()) return;
+
+        if (m_indexBuffer) {
+            const MeshLod& range = GetSubmeshLod(submesh, lod);
+            cmdList->DrawIndexed(range.indexCount, 1, range.indexOffset, 0, 0);
+        } else {
+            cmdList->Draw(m_vertexCount, 1, 0, 0);
+        }
+    }
+
+    void Mesh::DrawCulled(IRHICommandList* cmdList, const glm::mat4& model, const Frustum& frustum,
+                          const glm::vec3& cameraPosition, ClusterCullStats* stats, uint32_t lod) {
+        if (!m_vertexBuffer) return;
+
+        if (m_boundingBox.IsValid() && !frustum.IntersectsAABB(m_boundingBox.Transformed(model))) {
+            return;
+        }
+
+        const MeshLod& range = GetLod(lod);
+        if (range.meshletCount == 0) {
+            Draw(cmdList, lod);
+            if (stats) {
+                stats->trianglesSubmitted += (m_indexBuffer ? range.indexCount : m_vertexCount) / 3;
+                stats->drawCalls++;
+            }
+            return;
+        }
+
+        Bind(cmdList);
+
+        // One culler across submeshes so runs merge over submesh boundaries
+        MeshletCuller culler(cmdList, model, frustum, cameraPosition, stats);
+        for (uint32_t index = 0; index < m_submeshes.size(); ++index) {
+            const Submesh& submesh = m_submeshes[index];
+            bool visible = m_submeshes.size() == 1 || !submesh.bounds.IsValid() ||
+                           frustum.IntersectsAABB(submesh.bounds.Transformed(model));
+            if (stats) {
+                stats->submeshesTested++;
+                stats->submeshesVisible += visible ? 1 : 0;
+            }
+            if (!visible) {
+                culler.Flush();
+                continue;
+            }
+
+            const MeshLod& submeshRange = GetSubmeshLod(index, lod);
+            for (uint32_t i = submeshRange.meshletOffset; i < submeshRange.meshletOffset + submeshRange.meshletCount; ++i) {
+                culler.Cull(m_meshlets[i]);
+            }
+        }
+        culler.Flush();
+    }
+
+    void Mesh::DrawSubmeshCulled(IRHICommandList* cmdList, uint32_t submesh, const glm::mat4& model, const Frustum& frustum,
+                                 const glm::vec3& cameraPosition, ClusterCullStats* stats, uint32_t lod) {
+        if (!m_vertexBuffer || submesh >= m_submeshes.size()) return;
+
+        const AABB& bounds = m_submeshes[submesh].bounds;
+        bool visible = !bounds.IsValid() || frustum.IntersectsAABB(bounds.Transformed(model));
+        if (stats) {
+            stats->submeshesTested++;
+            stats->submeshesVisible += visible ? 1 : 0;
+        }
+        if (!visible) return;
+
+        const MeshLod& range = GetSubmeshLod(submesh, lod);
+        if (range.meshletCount == 0) {
+            DrawSubmesh(cmdList, submesh, lod);
+            if (stats) {
+                stats->trianglesSubmitted += (m_indexBuffer ? range.indexCount : m_vertexCount) / 3;
+                stats->drawCalls++;
+            }
+            return;
+        }
+
+        MeshletCuller culler(cmdList, model, frustum, cameraPosition, stats);
+        for (uint32_t i = range.meshletOffset; i < range.meshletOffset + range.meshletCount; ++i) {
+            culler.Cull(m_meshlets[i]);
+        }
+        culler.Flush();
+    }
+
+    uint32_t Mesh::SelectLod(const glm::mat4& model, const glm::vec3& cameraPosition, float pixelsPerUnit,
+                             uint32_t currentLod, const LodSelectionSettings& settings) const {
+        if (m_lods.size() <= 1 || !m_boundingBox.IsValid()) {
+            return 0;
+        }
+
+        glm::mat3 linear(model);
+        float maxScale = std::max(glm::length(linear[0]), std::max(glm::length(linear[1]), glm::length(linear[2])));
+        glm::vec3 extent = m_boundingBox.GetExtent();
+        // LOD errors are relative to the largest extent (see MeshSimplifier)
+        float worldSize = std::max(extent.x, std::max(extent.y, extent.z)) * maxScale;
+
+        // Nearest point of the bounding sphere; inside it nothing may be dropped
+        glm::vec3 center = glm::vec3(model * glm::vec4(m_boundingBox.GetCenter(), 1.0f));
+        float distance = glm::length(center - cameraPosition) - 0.5f * glm::length(extent) * maxScale;
+        if (distance <= 0.0f) {
+            return 0;
+        }
+
+        float pixelsPerError = worldSize * pixelsPerUnit / distance;
+        auto coarsestWithin = [&](float limit) {
+            uint32_t selected = 0;
+            for (uint32_t i = 1; i < m_lods.size(); ++i) {
+                if (m_lods[i].error * pixelsPerError > limit) break; // Errors grow with the level
+                selected = i;
+            }
+            return selected;
+        };
+
+        uint32_t ideal = coarsestWithin(settings.maxScreenError);
+        if (ideal < currentLod) {
+            return ideal; // Refine immediately so the error limit holds
+        }
+        // Coarsen only once the error is clearly below the limit, so objects near
+        // a threshold don't flip every frame
+        return std::max(std::min(currentLod, ideal), coarsestWithin(settings.maxScreenError * (1.0f - settings.hysteresis)));
+    }
+
 }
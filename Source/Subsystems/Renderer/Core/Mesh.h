@@ -5,11 +5,46 @@
 #include "../RHI/IRHICommandList.h"
 #include "../../Asset/AssetData.h"
 #include "Core/Math/Bounds.h"
+#include "Core/Math/Frustum.h"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace AstralEngine {
 
+    struct ClusterCullStats {
+        uint32_t submeshesTested = 0;
+        uint32_t submeshesVisible = 0;
+        uint32_t meshletsTested = 0;
+        uint32_t meshletsVisible = 0;
+        uint32_t trianglesSubmitted = 0;
+        uint32_t drawCalls = 0;
+    };
+
+    struct LodSelectionSettings {
+        float maxScreenError = 1.0f; // Simplification error tolerated on screen, in pixels
+        float hysteresis = 0.25f;    // Moving to a coarser LOD needs error below (1 - hysteresis) * limit
+    };
+
+    // Pushed per draw; the shader computes position = attribute * scale + offset.
+    // positionScale.w is 1 for VertexFormat::Packed.
+    struct VertexDecodeParams {
+        glm::vec4 positionScale = glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);
+        glm::vec4 positionOffset = glm::vec4(0.0f);
+
+        // Same decode as an affine transform, for passes whose push constants
+        // have no room for the params (applied before the model matrix)
+        glm::mat4 ToMatrix() const {
+            glm::mat4 decode(1.0f);
+            decode[0][0] = positionScale.x;
+            decode[1][1] = positionScale.y;
+            decode[2][2] = positionScale.z;
+            decode[3] = glm::vec4(glm::vec3(positionOffset), 1.0f);
+            return decode;
+        }
+    };
+
     class Mesh {
     public:
         Mesh(IRHIDevice* device, const ModelData& modelData);
@@ -19,11 +54,42 @@ namespace AstralEngine {
         static std::shared_ptr<Mesh> CreateQuad(IRHIDevice* device);
 
         void Bind(IRHICommandList* cmdList);
-        void Draw(IRHICommandList* cmdList);
+        void Draw(IRHICommandList* cmdList, uint32_t lod = 0);
+
+        // Draws one submesh's range of the given LOD; the caller binds the mesh first
+        void DrawSubmesh(IRHICommandList* cmdList, uint32_t submesh, uint32_t lod = 0);
+
+        // Draws only meshlets inside the world-space frustum that are not entirely
+        // back-facing, merging adjacent survivors into one draw. Requires back-face
+        // culling in the bound pipeline. Meshes without meshlets draw whole.
+        void DrawCulled(IRHICommandList* cmdList, const glm::mat4& model, const Frustum& frustum,
+                        const glm::vec3& cameraPosition, ClusterCullStats* stats = nullptr, uint32_t lod = 0);
+
+        // DrawCulled for a single submesh (its AABB, then its meshlets), so
+        // callers can sort submeshes by material; the caller binds the mesh first
+        void DrawSubmeshCulled(IRHICommandList* cmdList, uint32_t submesh, const glm::mat4& model, const Frustum& frustum,
+                               const glm::vec3& cameraPosition, ClusterCullStats* stats = nullptr, uint32_t lod = 0);
+
+        // Coarsest LOD whose simplification error projects to at most
+        // settings.maxScreenError pixels. pixelsPerUnit is the projected size of
+        // one world unit at distance 1 (proj[1][1] * viewportHeight / 2).
+        // currentLod is the entity's previous choice, for hysteresis.
+        uint32_t SelectLod(const glm::mat4& model, const glm::vec3& cameraPosition, float pixelsPerUnit,
+                           uint32_t currentLod, const LodSelectionSettings& settings) const;
 
         uint32_t GetVertexCount() const { return m_vertexCount; }
-        uint32_t GetIndexCount() const { return m_indexCount; }
+        uint32_t GetIndexCount() const { return m_indexCount; } // All LODs
+        uint32_t GetLodCount() const { return static_cast<uint32_t>(m_lods.size()); }
+        const MeshLod& GetLod(uint32_t lod) const { return m_lods[std::min<size_t>(lod, m_lods.size() - 1)]; }
+        uint32_t GetSubmeshCount() const { return static_cast<uint32_t>(m_submeshes.size()); }
+        const Submesh& GetSubmesh(uint32_t submesh) const { return m_submeshes[submesh]; }
+        const MeshLod& GetSubmeshLod(uint32_t submesh, uint32_t lod) const {
+            return m_submeshes[submesh].lods[std::min<size_t>(lod, std::min<size_t>(m_lods.size(), MAX_MESH_LODS) - 1)];
+        }
         const AABB& GetAABB() const { return m_boundingBox; }
+        const std::vector<Meshlet>& GetMeshlets() const { return m_meshlets; }
+        VertexFormat GetVertexFormat() const { return m_vertexFormat; }
+        const VertexDecodeParams& GetDecodeParams() const { return m_decodeParams; }
 
         IRHIBuffer* GetVertexBuffer() const { return m_vertexBuffer.get(); }
         IRHIBuffer* GetIndexBuffer() const { return m_indexBuffer.get(); }
@@ -35,6 +101,11 @@ namespace AstralEngine {
         uint32_t m_vertexCount;
         uint32_t m_indexCount;
         AABB m_boundingBox;
+        VertexFormat m_vertexFormat = VertexFormat::Standard;
+        VertexDecodeParams m_decodeParams;
+        std::vector<Meshlet> m_meshlets; // CPU copy for cluster culling
+        std::vector<MeshLod> m_lods;     // Never empty; LOD0 covers all indices when the model has no chain
+        std::vector<Submesh> m_submeshes; // Never empty; one covering the whole mesh when the model has none
     };
 
 }
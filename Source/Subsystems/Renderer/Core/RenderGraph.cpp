@@ -0,0 +1,294 @@
+#include "RenderGraph.h"
+#include "Core/Logger.h"
+#include <algorithm>
+
+namespace AstralEngine {
+
+namespace {
+
+// Pooled textures unused for this many compiles are released. Must exceed
+// the number of frames in flight so nothing the GPU still reads is freed.
+constexpr uint64_t kPoolEvictionFrames = 8;
+
+bool IsWriteState(RHIResourceState state) {
+    return state == RHIResourceState::ColorAttachment ||
+           state == RHIResourceState::DepthAttachment ||
+           state == RHIResourceState::TransferDst;
+}
+
+} // namespace
+
+// --- RenderGraphBuilder ---
+
+RGTextureHandle RenderGraphBuilder::CreateTexture(const std::string& name, const RGTextureDesc& desc) {
+    RenderGraph::Resource resource;
+    resource.name = name;
+    resource.desc = desc;
+    m_graph->m_resources.push_back(resource);
+    return static_cast<RGTextureHandle>(m_graph->m_resources.size() - 1);
+}
+
+RGTextureHandle RenderGraphBuilder::Read(RGTextureHandle handle, RHIResourceState state) {
+    if (handle >= m_graph->m_resources.size()) {
+        Logger::Warning("RenderGraph", "Pass '{}' reads an invalid resource", m_graph->m_passes[m_passIndex].name);
+        return RG_INVALID_HANDLE;
+    }
+    m_graph->m_passes[m_passIndex].accesses.push_back({handle, state, false});
+    return handle;
+}
+
+RGTextureHandle RenderGraphBuilder::Write(RGTextureHandle handle, RHIResourceState state) {
+    if (handle >= m_graph->m_resources.size()) {
+        Logger::Warning("RenderGraph", "Pass '{}' writes an invalid resource", m_graph->m_passes[m_passIndex].name);
+        return RG_INVALID_HANDLE;
+    }
+    m_graph->m_passes[m_passIndex].accesses.push_back({handle, state, true});
+    return handle;
+}
+
+void RenderGraphBuilder::SetSideEffect() {
+    m_graph->m_passes[m_passIndex].sideEffect = true;
+}
+
+// --- RenderGraphResources ---
+
+IRHITexture* RenderGraphResources::GetTexture(RGTextureHandle handle) const {
+    return m_graph->GetTexture(handle);
+}
+
+// --- RenderGraph ---
+
+RenderGraph::RenderGraph(IRHIDevice* device) : m_device(device) {}
+
+RenderGraph::~RenderGraph() = default;
+
+RGTextureHandle RenderGraph::ImportTexture(const std::string& name, IRHITexture* texture,
+                                           RHIResourceState initialState, RHIResourceState finalState) {
+    Resource resource;
+    resource.name = name;
+    resource.imported = true;
+    resource.importedTexture = texture;
+    resource.importedState = initialState;
+    resource.finalState = finalState;
+    if (texture) {
+        resource.desc.width = texture->GetWidth();
+        resource.desc.height = texture->GetHeight();
+        resource.desc.format = texture->GetFormat();
+    }
+    m_resources.push_back(resource);
+    return static_cast<RGTextureHandle>(m_resources.size() - 1);
+}
+
+void RenderGraph::AddPass(const std::string& name, const SetupCallback& setup, const ExecuteCallback& execute) {
+    Pass pass;
+    pass.name = name;
+    pass.execute = execute;
+    m_passes.push_back(std::move(pass));
+
+    RenderGraphBuilder builder(this, static_cast<uint32_t>(m_passes.size() - 1));
+    setup(builder);
+    m_compiled = false;
+}
+
+void RenderGraph::Compile() {
+    m_frameCounter++;
+
+    // 1. Reference counts: passes by what they write, resources by who reads them
+    for (auto& pass : m_passes) {
+        pass.culled = false;
+        pass.refCount = 0;
+        for (const auto& access : pass.accesses) {
+            if (access.write) {
+                pass.refCount++;
+            } else {
+                m_resources[access.handle].refCount++;
+            }
+        }
+    }
+    for (auto& resource : m_resources) {
+        if (resource.imported) {
+            resource.refCount++; // Observed outside the graph
+        }
+    }
+
+    // 2. Cull: walk back from unreferenced resources to their producers
+    std::vector<RGTextureHandle> unreferenced;
+    for (RGTextureHandle i = 0; i < m_resources.size(); ++i) {
+        if (m_resources[i].refCount == 0) {
+            unreferenced.push_back(i);
+        }
+    }
+
+    while (!unreferenced.empty()) {
+        RGTextureHandle handle = unreferenced.back();
+        unreferenced.pop_back();
+
+        for (auto& pass : m_passes) {
+            if (pass.culled || pass.sideEffect) continue;
+
+            bool writesHandle = std::any_of(pass.accesses.begin(), pass.accesses.end(),
+                [handle](const Access& a) { return a.write && a.handle == handle; });
+            if (!writesHandle || --pass.refCount > 0) continue;
+
+            pass.culled = true;
+            for (const auto& access : pass.accesses) {
+                if (!access.write && --m_resources[access.handle].refCount == 0) {
+                    unreferenced.push_back(access.handle);
+                }
+            }
+        }
+    }
+
+    // 3. Lifetimes over the surviving passes
+    m_culledPassCount = 0;
+    for (uint32_t passIndex = 0; passIndex < m_passes.size(); ++passIndex) {
+        const auto& pass = m_passes[passIndex];
+        if (pass.culled) {
+            m_culledPassCount++;
+            continue;
+        }
+        for (const auto& access : pass.accesses) {
+            auto& resource = m_resources[access.handle];
+            resource.firstPass = std::min(resource.firstPass, passIndex);
+            resource.lastPass = std::max(resource.lastPass, passIndex);
+        }
+    }
+
+    // 4. Evict pooled textures nobody has asked for in a while
+    m_pool.erase(std::remove_if(m_pool.begin(), m_pool.end(), [this](const PooledTexture& p) {
+        return p.lastUsedFrame + kPoolEvictionFrames < m_frameCounter;
+    }), m_pool.end());
+
+    // 5. Physical assignment: transients in order of first use, sharing a
+    //    pooled texture with any earlier transient whose lifetime has ended.
+    for (auto& pooled : m_pool) {
+        pooled.inUse = false;
+        pooled.busyUntilPass = 0;
+    }
+
+    std::vector<RGTextureHandle> transients;
+    for (RGTextureHandle i = 0; i < m_resources.size(); ++i) {
+        if (!m_resources[i].imported && m_resources[i].firstPass != ~0u) {
+            transients.push_back(i);
+        }
+    }
+    std::sort(transients.begin(), transients.end(), [this](RGTextureHandle a, RGTextureHandle b) {
+        return m_resources[a].firstPass < m_resources[b].firstPass;
+    });
+
+    for (RGTextureHandle handle : transients) {
+        auto& resource = m_resources[handle];
+        resource.pooledIndex = AcquirePooledTexture(resource.desc, resource.firstPass, resource.lastPass);
+    }
+
+    m_transientTextureCount = static_cast<uint32_t>(transients.size());
+    m_physicalTextureCount = static_cast<uint32_t>(
+        std::count_if(m_pool.begin(), m_pool.end(), [](const PooledTexture& p) { return p.inUse; }));
+
+    m_compiled = true;
+}
+
+int32_t RenderGraph::AcquirePooledTexture(const RGTextureDesc& desc, uint32_t firstPass, uint32_t lastPass) {
+    for (size_t i = 0; i < m_pool.size(); ++i) {
+        auto& pooled = m_pool[i];
+        if (!(pooled.desc == desc)) continue;
+
+        // Free this frame, or its previous user this frame is already done
+        if (!pooled.inUse || pooled.busyUntilPass < firstPass) {
+            pooled.inUse = true;
+            pooled.busyUntilPass = lastPass;
+            pooled.lastUsedFrame = m_frameCounter;
+            return static_cast<int32_t>(i);
+        }
+    }
+
+    PooledTexture pooled;
+    pooled.desc = desc;
+    pooled.texture = m_device->CreateTexture2D(desc.width, desc.height, desc.format, desc.usage);
+    pooled.inUse = true;
+    pooled.busyUntilPass = lastPass;
+    pooled.lastUsedFrame = m_frameCounter;
+    m_pool.push_back(std::move(pooled));
+
+    Logger::Debug("RenderGraph", "Allocated transient texture {}x{} (pool size {})",
+                  desc.width, desc.height, m_pool.size());
+    return static_cast<int32_t>(m_pool.size() - 1);
+}
+
+RHIResourceState& RenderGraph::GetCurrentState(Resource& resource) {
+    if (resource.imported) {
+        return resource.importedState;
+    }
+    return m_pool[resource.pooledIndex].state;
+}
+
+IRHITexture* RenderGraph::GetPhysicalTexture(const Resource& resource) const {
+    if (resource.imported) {
+        return resource.importedTexture;
+    }
+    if (resource.pooledIndex < 0) {
+        return nullptr;
+    }
+    return m_pool[resource.pooledIndex].texture.get();
+}
+
+IRHITexture* RenderGraph::GetTexture(RGTextureHandle handle) const {
+    if (handle >= m_resources.size()) {
+        return nullptr;
+    }
+    return GetPhysicalTexture(m_resources[handle]);
+}
+
+void RenderGraph::Execute(IRHICommandList* cmdList) {
+    if (!m_compiled) {
+        Compile();
+    }
+
+    // The graph owns every transition from here on
+    cmdList->SetAutomaticLayoutTransitions(false);
+
+    RenderGraphResources resources(this);
+    for (auto& pass : m_passes) {
+        if (pass.culled) continue;
+
+        for (const auto& access : pass.accesses) {
+            auto& resource = m_resources[access.handle];
+            IRHITexture* texture = GetPhysicalTexture(resource);
+            if (!texture) continue;
+
+            RHIResourceState& current = GetCurrentState(resource);
+            // Write-after-write in the same state still needs a memory barrier
+            if (current != access.state || IsWriteState(access.state)) {
+                cmdList->ResourceBarrier(texture, current, access.state);
+                current = access.state;
+            }
+        }
+
+        if (pass.execute) {
+            pass.execute(resources, cmdList);
+        }
+    }
+
+    // Hand imported textures back in the state their owners expect
+    for (auto& resource : m_resources) {
+        if (!resource.imported || !resource.importedTexture) continue;
+        if (resource.importedState != resource.finalState) {
+            cmdList->ResourceBarrier(resource.importedTexture, resource.importedState, resource.finalState);
+            resource.importedState = resource.finalState;
+        }
+    }
+
+    cmdList->SetAutomaticLayoutTransitions(true);
+}
+
+void RenderGraph::Reset() {
+    m_passes.clear();
+    m_resources.clear();
+    m_compiled = false;
+}
+
+void RenderGraph::ReleaseTransientPool() {
+    m_pool.clear();
+}
+
+} // namespace AstralEngine
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "../RHI/IRHICommandList.h"
+#include "../RHI/IRHIDevice.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace AstralEngine {
+
+using RGTextureHandle = uint32_t;
+constexpr RGTextureHandle RG_INVALID_HANDLE = ~0u;
+
+struct RGTextureDesc {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    RHIFormat format = RHIFormat::Unknown;
+    RHITextureUsage usage = RHITextureUsage::Sampled;
+
+    bool operator==(const RGTextureDesc& other) const {
+        return width == other.width && height == other.height &&
+               format == other.format && usage == other.usage;
+    }
+};
+
+class RenderGraph;
+
+/**
+ * @brief Pass kurulumunda kaynak okuma/yazma bildirimleri için kullanılır.
+ */
+class RenderGraphBuilder {
+public:
+    // Transient texture owned by the graph; memory is shared with other
+    // transients whose lifetimes don't overlap.
+    RGTextureHandle CreateTexture(const std::string& name, const RGTextureDesc& desc);
+
+    RGTextureHandle Read(RGTextureHandle handle, RHIResourceState state = RHIResourceState::ShaderRead);
+    RGTextureHandle Write(RGTextureHandle handle, RHIResourceState state);
+
+    // Pass has effects outside the graph and must never be culled
+    void SetSideEffect();
+
+private:
+    friend class RenderGraph;
+    RenderGraphBuilder(RenderGraph* graph, uint32_t passIndex) : m_graph(graph), m_passIndex(passIndex) {}
+
+    RenderGraph* m_graph;
+    uint32_t m_passIndex;
+};
+
+/**
+ * @brief Pass yürütülürken fiziksel kaynaklara erişim sağlar.
+ */
+class RenderGraphResources {
+public:
+    IRHITexture* GetTexture(RGTextureHandle handle) const;
+
+private:
+    friend class RenderGraph;
+    explicit RenderGraphResources(const RenderGraph* graph) : m_graph(graph) {}
+
+    const RenderGraph* m_graph;
+};
+
+/**
+ * @brief IRHICommandList üzerinde çalışan frame render grafiği.
+ *
+ * Pass'ler okuma/yazma bildirir; grafik bariyerleri hesaplar, çıktısı
+ * kullanılmayan pass'leri eler ve ömürleri çakışmayan geçici attachment'lara
+ * aynı fiziksel dokuyu atar. Graf her frame yeniden kurulur, geçici doku
+ * havuzu ise frame'ler arasında korunur.
+ */
+class RenderGraph {
+public:
+    using SetupCallback = std::function<void(RenderGraphBuilder&)>;
+    using ExecuteCallback = std::function<void(const RenderGraphResources&, IRHICommandList*)>;
+
+    explicit RenderGraph(IRHIDevice* device);
+    ~RenderGraph();
+
+    // External texture; the graph transitions it from initialState and leaves
+    // it in finalState. Imported textures count as graph outputs.
+    RGTextureHandle ImportTexture(const std::string& name, IRHITexture* texture,
+                                  RHIResourceState initialState, RHIResourceState finalState);
+
+    void AddPass(const std::string& name, const SetupCallback& setup, const ExecuteCallback& execute);
+
+    // Culls passes, computes lifetimes and assigns physical textures
+    void Compile();
+    // Records every surviving pass with the barriers it needs
+    void Execute(IRHICommandList* cmdList);
+    // Drops passes and virtual resources; pooled textures are kept
+    void Reset();
+    // Releases all pooled transient textures (e.g. after a resize)
+    void ReleaseTransientPool();
+
+    // Valid after Compile()
+    IRHITexture* GetTexture(RGTextureHandle handle) const;
+
+    // Stats of the last compile
+    uint32_t GetCulledPassCount() const { return m_culledPassCount; }
+    uint32_t GetTransientTextureCount() const { return m_transientTextureCount; }
+    uint32_t GetPhysicalTextureCount() const { return m_physicalTextureCount; }
+
+private:
+    friend class RenderGraphBuilder;
+
+    struct Access {
+        RGTextureHandle handle;
+        RHIResourceState state;
+        bool write;
+    };
+
+    struct Pass {
+        std::string name;
+        ExecuteCallback execute;
+        std::vector<Access> accesses;
+        bool sideEffect = false;
+        bool culled = false;
+        uint32_t refCount = 0;
+    };
+
+    struct PooledTexture {
+        std::shared_ptr<IRHITexture> texture;
+        RGTextureDesc desc;
+        RHIResourceState state = RHIResourceState::Undefined;
+        uint32_t busyUntilPass = 0; // Last pass (this frame) using it
+        bool inUse = false;         // Claimed during the current compile
+        uint64_t lastUsedFrame = 0;
+    };
+
+    struct Resource {
+        std::string name;
+        RGTextureDesc desc;
+        bool imported = false;
+        IRHITexture* importedTexture = nullptr;
+        RHIResourceState importedState = RHIResourceState::Undefined;
+        RHIResourceState finalState = RHIResourceState::Undefined;
+
+        uint32_t refCount = 0;
+        uint32_t firstPass = ~0u;
+        uint32_t lastPass = 0;
+        int32_t pooledIndex = -1;
+    };
+
+    RHIResourceState& GetCurrentState(Resource& resource);
+    IRHITexture* GetPhysicalTexture(const Resource& resource) const;
+    int32_t AcquirePooledTexture(const RGTextureDesc& desc, uint32_t firstPass, uint32_t lastPass);
+
+    IRHIDevice* m_device;
+    std::vector<Pass> m_passes;
+    std::vector<Resource> m_resources;
+    std::vector<PooledTexture> m_pool;
+    uint64_t m_frameCounter = 0;
+    bool m_compiled = false;
+
+    uint32_t m_culledPassCount = 0;
+    uint32_t m_transientTextureCount = 0;
+    uint32_t m_physicalTextureCount = 0;
+};
+
+} // namespace AstralEngine
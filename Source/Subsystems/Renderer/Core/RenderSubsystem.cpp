@@ -2,7 +2,9 @@
 #include "Core/Engine.h"
 #include "Core/Logger.h"
 #include "Subsystems/Platform/PlatformSubsystem.h"
+#include <algorithm>
 #include <stdexcept>
+#include <thread>
 
 #ifdef ASTRAL_USE_IMGUI
 #include "../../UI/UISubsystem.h"
@@ -41,6 +43,11 @@ void RenderSubsystem::OnInitialize(Engine* owner) {
     if (!m_device->Initialize()) {
         throw std::runtime_error("Failed to initialize RHI Device!");
     }
+
+    // 4. Pipeline compile workers (keep most cores free for asset loading)
+    size_t compileThreads = std::max<size_t>(1, std::thread::hardware_concurrency() / 4);
+    m_pipelineCompilePool = std::make_unique<ThreadPool>(compileThreads);
+    Logger::Info("RenderSubsystem", "Pipeline compile pool started with {} threads", compileThreads);
     
     Logger::Info("RenderSubsystem", "RenderSubsystem initialized successfully.");
 }
@@ -104,6 +111,10 @@ void RenderSubsystem::OnUpdate(float /*deltaTime*/) {
 
 void RenderSubsystem::OnShutdown() {
     Logger::Info("RenderSubsystem", "Shutting down RenderSubsystem...");
+
+    // Drain in-flight compiles before the device goes away
+    m_pipelineCompilePool.reset();
+
     if (m_device) {
         m_device->Shutdown();
         m_device.reset();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/ISubsystem.h"
+#include "Core/ThreadPool.h"
 #include "../RHI/IRHIDevice.h"
 #include <memory>
 #include <functional>
@@ -29,6 +30,9 @@ public:
     // RHI Device Access
     IRHIDevice* GetDevice() const { return m_device.get(); }
 
+    // Worker threads for background pipeline compilation
+    ThreadPool* GetPipelineCompilePool() const { return m_pipelineCompilePool.get(); }
+
     using RenderCallback = std::function<void(IRHICommandList*)>;
     void SetRenderCallback(RenderCallback callback) { m_renderCallback = callback; }
 
@@ -38,6 +42,7 @@ public:
 private:
     Engine* m_engine = nullptr;
     std::shared_ptr<IRHIDevice> m_device;
+    std::unique_ptr<ThreadPool> m_pipelineCompilePool;
     RenderCallback m_renderCallback;
     PreRenderCallback m_preRenderCallback;
 };
@@ -0,0 +1,108 @@
+#include "ShadowCascades.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace AstralEngine {
+
+glm::mat4 ShadowCascades::ComputeLightView(const glm::vec3& lightDir) {
+    glm::vec3 dir = glm::normalize(lightDir);
+    glm::vec3 up = std::abs(dir.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+    return glm::lookAt(glm::vec3(0.0f), dir, up);
+}
+
+std::vector<float> ShadowCascades::ComputeSplits(float nearPlane, float farPlane, uint32_t cascadeCount, float lambda) {
+    std::vector<float> splits(cascadeCount);
+    float ratio = farPlane / nearPlane;
+    float range = farPlane - nearPlane;
+
+    // Practical split scheme: blend of logarithmic and uniform distribution
+    for (uint32_t i = 0; i < cascadeCount; ++i) {
+        float p = static_cast<float>(i + 1) / static_cast<float>(cascadeCount);
+        float logSplit = nearPlane * std::pow(ratio, p);
+        float uniformSplit = nearPlane + range * p;
+        splits[i] = lambda * logSplit + (1.0f - lambda) * uniformSplit;
+    }
+    return splits;
+}
+
+std::vector<ShadowCascade> ShadowCascades::Compute(const glm::mat4& cameraView, float fovY, float aspect,
+                                                   float nearPlane, float farPlane,
+                                                   const glm::mat4& lightView,
+                                                   const ShadowCascadeSettings& settings,
+                                                   const AABB& casterBoundsLS) {
+    uint32_t count = std::clamp(settings.cascadeCount, 1u, MAX_SHADOW_CASCADES);
+    float lambda = std::clamp(settings.splitLambda, 0.0f, 1.0f);
+    std::vector<float> splits = ComputeSplits(nearPlane, farPlane, count, lambda);
+
+    glm::mat4 invView = glm::inverse(cameraView);
+    float tanHalfY = std::tan(fovY * 0.5f);
+    float tanHalfX = tanHalfY * aspect;
+
+    std::vector<ShadowCascade> cascades(count);
+    float sliceNear = nearPlane;
+    for (uint32_t i = 0; i < count; ++i) {
+        float sliceFar = splits[i];
+
+        // Slice corners in world space
+        glm::vec3 corners[8];
+        glm::vec3 center(0.0f);
+        for (int c = 0; c < 8; ++c) {
+            float d = (c & 4) ? sliceFar : sliceNear;
+            glm::vec4 viewCorner((c & 1) ? d * tanHalfX : -d * tanHalfX,
+                                 (c & 2) ? d * tanHalfY : -d * tanHalfY,
+                                 -d, 1.0f);
+            corners[c] = glm::vec3(invView * viewCorner);
+            center += corners[c];
+        }
+        center /= 8.0f;
+
+        // Bounding sphere radius depends only on the slice shape, not the
+        // camera orientation; quantize it so float noise can't change it.
+        float radius = 0.0f;
+        for (const auto& corner : corners) {
+            radius = std::max(radius, glm::length(corner - center));
+        }
+        radius = std::ceil(radius * 16.0f) / 16.0f;
+
+        // Snap the center to whole shadow map texels in light space
+        glm::vec3 centerLS = glm::vec3(lightView * glm::vec4(center, 1.0f));
+        float texelSize = (2.0f * radius) / static_cast<float>(settings.resolution);
+        centerLS.x = std::floor(centerLS.x / texelSize) * texelSize;
+        centerLS.y = std::floor(centerLS.y / texelSize) * texelSize;
+
+        // Light looks down -Z; depths are distances along the light direction
+        float nearDepth = -centerLS.z - radius;
+        float farDepth = -centerLS.z + radius;
+        if (casterBoundsLS.IsValid()) {
+            nearDepth = std::min(nearDepth, -casterBoundsLS.max.z);
+        }
+
+        auto& cascade = cascades[i];
+        cascade.lightMin = glm::vec2(centerLS) - glm::vec2(radius);
+        cascade.lightMax = glm::vec2(centerLS) + glm::vec2(radius);
+        cascade.farDepth = farDepth;
+        cascade.splitNear = sliceNear;
+        cascade.splitFar = sliceFar;
+
+        // Zero-to-one depth to match Vulkan clip space
+        glm::mat4 lightProj = glm::orthoRH_ZO(cascade.lightMin.x, cascade.lightMax.x,
+                                              cascade.lightMin.y, cascade.lightMax.y,
+                                              nearDepth, farDepth);
+        cascade.viewProj = lightProj * lightView;
+
+        sliceNear = sliceFar;
+    }
+    return cascades;
+}
+
+bool ShadowCascades::Overlaps(const ShadowCascade& cascade, const AABB& boundsLS) {
+    if (!boundsLS.IsValid()) {
+        return true; // Unknown bounds, never cull
+    }
+    return boundsLS.max.x >= cascade.lightMin.x && boundsLS.min.x <= cascade.lightMax.x &&
+           boundsLS.max.y >= cascade.lightMin.y && boundsLS.min.y <= cascade.lightMax.y &&
+           -boundsLS.max.z <= cascade.farDepth;
+}
+
+} // namespace AstralEngine
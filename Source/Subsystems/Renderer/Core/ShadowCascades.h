@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Core/Math/Bounds.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace AstralEngine {
+
+constexpr uint32_t MAX_SHADOW_CASCADES = 4;
+
+struct ShadowCascadeSettings {
+    uint32_t cascadeCount = 4;
+    // 0 = uniform splits, 1 = logarithmic splits
+    float splitLambda = 0.75f;
+    // Per-cascade resolution; cascades sit side by side in one atlas
+    uint32_t resolution = 1024;
+};
+
+struct ShadowCascade {
+    glm::mat4 viewProj{1.0f};
+    float splitNear = 0.0f; // View-space distance where this cascade starts
+    float splitFar = 0.0f;  // View-space distance where this cascade ends
+
+    // Ortho volume in light view space, used for caster culling
+    glm::vec2 lightMin{0.0f};
+    glm::vec2 lightMax{0.0f};
+    float farDepth = 0.0f;
+};
+
+/**
+ * @brief Directional ışık için kararlı (texel-snapped) cascade hesaplaması.
+ *
+ * Her cascade kamera frustum diliminin sınırlayıcı küresine oturtulur; küre
+ * yarıçapı kamera dönüşünden bağımsız olduğundan ve merkez shadow map texel
+ * ızgarasına yaslandığından kamera hareket ederken gölge kenarları titremez.
+ */
+class ShadowCascades {
+public:
+    // Rotation-only light view; shared by every cascade so snapping is stable
+    static glm::mat4 ComputeLightView(const glm::vec3& lightDir);
+
+    // View-space split distances (far plane of each cascade)
+    static std::vector<float> ComputeSplits(float nearPlane, float farPlane, uint32_t cascadeCount, float lambda);
+
+    // casterBoundsLS: union of every shadow caster in light view space; near
+    // planes are pulled back to it so casters outside a slice still shadow it.
+    static std::vector<ShadowCascade> Compute(const glm::mat4& cameraView, float fovY, float aspect,
+                                              float nearPlane, float farPlane,
+                                              const glm::mat4& lightView,
+                                              const ShadowCascadeSettings& settings,
+                                              const AABB& casterBoundsLS);
+
+    // True if a caster's light-space bounds can cast into the cascade
+    static bool Overlaps(const ShadowCascade& cascade, const AABB& boundsLS);
+};
+
+} // namespace AstralEngine
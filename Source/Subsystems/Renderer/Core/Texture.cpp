@@ -1,12 +1,32 @@
 #include "Texture.h"
 #include <stb_image.h>
 #include <vulkan/vulkan.h>
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 #include <glm/glm.hpp>
 
 namespace AstralEngine {
 
+namespace {
+
+RHIFormat GetTextureFormat(const TextureData& data) {
+    switch (data.compression) {
+        case TextureCompression::BC1: return data.isSRGB ? RHIFormat::BC1_RGBA_SRGB : RHIFormat::BC1_RGBA_UNORM;
+        case TextureCompression::BC3: return data.isSRGB ? RHIFormat::BC3_SRGB : RHIFormat::BC3_UNORM;
+        case TextureCompression::BC5: return RHIFormat::BC5_UNORM;
+        case TextureCompression::BC6H: return RHIFormat::BC6H_UFLOAT;
+        case TextureCompression::BC7: return data.isSRGB ? RHIFormat::BC7_SRGB : RHIFormat::BC7_UNORM;
+        default: break;
+    }
+    if (data.isHDR) {
+        return RHIFormat::R32G32B32A32_FLOAT;
+    }
+    return data.isSRGB ? RHIFormat::R8G8B8A8_SRGB : RHIFormat::R8G8B8A8_UNORM;
+}
+
+} // namespace
+
 Texture::Texture(IRHIDevice* device, const std::string& path) : m_device(device) {
     // Load image
     stbi_set_flip_vertically_on_load(true);
@@ -45,7 +65,7 @@ Texture::Texture(IRHIDevice* device, const std::string& path) : m_device(device)
     m_sampler = device->CreateSampler(samplerDesc);
 }
 
-Texture::Texture(IRHIDevice* device, const TextureData& data) : m_device(device) {
+Texture::Texture(IRHIDevice* device, const TextureData& data, uint32_t firstMip) : m_device(device) {
     if (!data.IsValid()) {
         throw std::runtime_error("Invalid texture data provided");
     }
@@ -53,14 +73,10 @@ Texture::Texture(IRHIDevice* device, const TextureData& data) : m_device(device)
     m_width = data.width;
     m_height = data.height;
     m_channels = data.channels;
+    m_mipCount = data.GetMipCount();
+    m_residentMip = std::min(firstMip, m_mipCount - 1);
 
-    RHIFormat format = RHIFormat::R8G8B8A8_SRGB;
-    if (data.isHDR) {
-        format = RHIFormat::R32G32B32A32_FLOAT;
-    }
-
-    // Create RHI Texture
-    m_texture = device->CreateAndUploadTexture(m_width, m_height, format, data.data);
+    m_texture = UploadMips(device, data, m_residentMip);
 
     // Create Sampler (Default for now)
     RHISamplerDescriptor samplerDesc{};
@@ -71,10 +87,36 @@ Texture::Texture(IRHIDevice* device, const TextureData& data) : m_device(device)
     samplerDesc.addressModeW = RHISamplerAddressMode::Repeat;
     samplerDesc.anisotropyEnable = true;
     samplerDesc.maxAnisotropy = 16.0f;
+    samplerDesc.maxLod = static_cast<float>(m_mipCount);
 
     m_sampler = device->CreateSampler(samplerDesc);
 }
 
+std::shared_ptr<IRHITexture> Texture::UploadMips(IRHIDevice* device, const TextureData& data, uint32_t firstMip) {
+    RHIFormat format = GetTextureFormat(data);
+    if (!device->SupportsSampledFormat(format)) {
+        throw std::runtime_error("Texture format not supported by the device: " + data.name);
+    }
+
+    // Cooked textures carry their whole mip chain; upload the requested tail in one go
+    std::vector<RHITextureMipData> mips;
+    if (data.mips.empty()) {
+        mips.push_back({ data.data, data.dataSize, data.width, data.height });
+    } else {
+        for (size_t level = std::min<size_t>(firstMip, data.mips.size() - 1); level < data.mips.size(); ++level) {
+            const TextureMip& mip = data.mips[level];
+            mips.push_back({ static_cast<const uint8_t*>(data.data) + mip.offset, mip.size, mip.width, mip.height });
+        }
+    }
+    return device->CreateAndUploadTextureMips(format, mips);
+}
+
+std::shared_ptr<IRHITexture> Texture::ReplaceRHITexture(std::shared_ptr<IRHITexture> rhiTexture, uint32_t residentMip) {
+    m_residentMip = residentMip;
+    std::swap(m_texture, rhiTexture);
+    return rhiTexture;
+}
+
 Texture::Texture(IRHIDevice* device, const std::vector<std::string>& facePaths) : m_device(device) {
     if (facePaths.size() != 6) {
         throw std::runtime_error("Cubemap requires 6 face paths");
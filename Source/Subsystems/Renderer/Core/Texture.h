@@ -10,7 +10,8 @@ namespace AstralEngine {
 class Texture {
 public:
     Texture(IRHIDevice* device, const std::string& path);
-    Texture(IRHIDevice* device, const TextureData& data);
+    // firstMip > 0 uploads only the smaller levels (streaming keeps the rest on disk)
+    Texture(IRHIDevice* device, const TextureData& data, uint32_t firstMip = 0);
     Texture(IRHIDevice* device, const std::vector<std::string>& facePaths);
     Texture(IRHIDevice* device, std::shared_ptr<IRHITexture> rhiTexture);
     ~Texture();
@@ -19,12 +20,21 @@ public:
     static std::shared_ptr<Texture> CreateFlatTexture(IRHIDevice* device, uint32_t width, uint32_t height, const glm::vec4& color, RHIFormat format = RHIFormat::R8G8B8A8_SRGB);
     static std::shared_ptr<Texture> CreateFlatCubemap(IRHIDevice* device, uint32_t width, uint32_t height, const glm::vec4& color, RHIFormat format = RHIFormat::R8G8B8A8_UNORM);
 
+    // Uploads levels [firstMip, mipCount) of data; throws if the device cannot sample the format
+    static std::shared_ptr<IRHITexture> UploadMips(IRHIDevice* device, const TextureData& data, uint32_t firstMip);
+
+    // Switches to another upload of the same texture with a different first
+    // mip; returns the previous one, which in-flight frames may still sample
+    std::shared_ptr<IRHITexture> ReplaceRHITexture(std::shared_ptr<IRHITexture> rhiTexture, uint32_t residentMip);
+
     IRHITexture* GetRHITexture() const { return m_texture.get(); }
     IRHISampler* GetRHISampler() const { return m_sampler.get(); }
 
     uint32_t GetWidth() const { return static_cast<uint32_t>(m_width); }
     uint32_t GetHeight() const { return static_cast<uint32_t>(m_height); }
     bool IsCubemap() const { return m_isCubemap; }
+    uint32_t GetMipCount() const { return m_mipCount; }
+    uint32_t GetResidentMip() const { return m_residentMip; } // Largest level on the GPU
 
 private:
     IRHIDevice* m_device;
@@ -35,6 +45,8 @@ private:
     int m_height = 0;
     int m_channels = 0;
     bool m_isCubemap = false;
+    uint32_t m_mipCount = 1;
+    uint32_t m_residentMip = 0;
 };
 
 }
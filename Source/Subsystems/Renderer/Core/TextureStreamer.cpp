@@ -0,0 +1,231 @@
+#include "TextureStreamer.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <cmath>
+
+namespace AstralEngine {
+
+TextureStreamer::TextureStreamer(IRHIDevice* device, const TextureStreamingSettings& settings)
+    : m_device(device), m_settings(settings) {
+}
+
+TextureStreamer::~TextureStreamer() = default;
+
+std::shared_ptr<Texture> TextureStreamer::GetOrCreate(const AssetHandle& handle, std::shared_ptr<TextureData> data) {
+    auto it = m_entryByHandle.find(handle);
+    if (it != m_entryByHandle.end()) {
+        return m_entries[it->second].texture;
+    }
+    if (!data || !data->IsValid()) {
+        return nullptr;
+    }
+
+    Entry entry;
+    entry.handle = handle;
+    entry.baseMip = ComputeBaseMip(*data, m_settings.minResidentSize);
+    entry.wantedMip = entry.baseMip;
+    entry.lastUsedFrame = m_frame;
+    entry.texture = std::make_shared<Texture>(m_device, *data, entry.baseMip);
+    entry.data = std::move(data);
+
+    const size_t index = m_entries.size();
+    m_entryByHandle[handle] = index;
+    m_entryByTexture[entry.texture.get()] = index;
+    m_entries.push_back(std::move(entry));
+    return m_entries[index].texture;
+}
+
+void TextureStreamer::RequestResidency(const Texture* texture, float screenPixels) {
+    auto it = m_entryByTexture.find(texture);
+    if (it == m_entryByTexture.end()) {
+        return;
+    }
+
+    Entry& entry = m_entries[it->second];
+    if (entry.lastUsedFrame != m_frame) {
+        entry.lastUsedFrame = m_frame;
+        entry.screenPixels = 0.0f;
+    }
+    entry.screenPixels = std::max(entry.screenPixels, screenPixels);
+}
+
+void TextureStreamer::Update() {
+    m_changed.clear();
+    m_stats.uploads = 0;
+    m_stats.evictions = 0;
+
+    uint64_t residentBytes = 0;
+    uint64_t requestedBytes = 0;
+    std::vector<size_t> upgrades;
+    std::vector<size_t> victims;
+
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        Entry& entry = m_entries[i];
+        const uint32_t residentMip = entry.texture->GetResidentMip();
+
+        if (entry.lastUsedFrame == m_frame) {
+            // One texel per pixel: each halving of the screen size drops a level
+            const float texels = static_cast<float>(std::max(entry.data->width, entry.data->height));
+            const float level = std::log2(texels / std::max(entry.screenPixels, 1.0f)) + m_settings.mipBias;
+            entry.wantedMip = static_cast<uint32_t>(std::clamp(static_cast<int>(std::floor(level)), 0,
+                                                               static_cast<int>(entry.baseMip)));
+        } else {
+            entry.wantedMip = entry.baseMip;
+        }
+
+        residentBytes += GetResidentBytes(*entry.data, residentMip);
+        requestedBytes += GetResidentBytes(*entry.data, entry.wantedMip);
+
+        if (entry.wantedMip < residentMip) {
+            upgrades.push_back(i);
+        } else if (entry.wantedMip > residentMip) {
+            victims.push_back(i);
+        }
+    }
+
+    // Largest on screen first; it is where missing detail shows the most
+    std::sort(upgrades.begin(), upgrades.end(), [this](size_t a, size_t b) {
+        return m_entries[a].screenPixels > m_entries[b].screenPixels;
+    });
+    // Least recently used first; textures still in view only give up levels
+    // they no longer need, smallest on screen first
+    std::sort(victims.begin(), victims.end(), [this](size_t a, size_t b) {
+        const Entry& lhs = m_entries[a];
+        const Entry& rhs = m_entries[b];
+        if (lhs.lastUsedFrame != rhs.lastUsedFrame) {
+            return lhs.lastUsedFrame < rhs.lastUsedFrame;
+        }
+        return lhs.screenPixels < rhs.screenPixels;
+    });
+
+    // Downgrades re-upload too, so they share the per-frame cap with upgrades
+    auto capReached = [this]() {
+        return m_stats.uploads + m_stats.evictions >= m_settings.maxUploadsPerFrame;
+    };
+
+    size_t nextVictim = 0;
+    auto evictUntil = [&](uint64_t limit) {
+        while (residentBytes > limit && nextVictim < victims.size() && !capReached()) {
+            Entry& victim = m_entries[victims[nextVictim++]];
+            const uint64_t before = GetResidentBytes(*victim.data, victim.texture->GetResidentMip());
+            if (SetResidentMip(victim, victim.wantedMip)) {
+                residentBytes -= before - GetResidentBytes(*victim.data, victim.wantedMip);
+                ++m_stats.evictions;
+            }
+        }
+    };
+
+    // A lowered budget is honoured even when nothing new is requested
+    evictUntil(m_settings.budgetBytes);
+
+    for (size_t index : upgrades) {
+        if (capReached()) {
+            break;
+        }
+
+        Entry& entry = m_entries[index];
+        const uint32_t residentMip = entry.texture->GetResidentMip();
+        const uint64_t currentBytes = GetResidentBytes(*entry.data, residentMip);
+
+        // Settle for a smaller level than wanted if the budget cannot fit it
+        // (or if the cap stopped the evictions that would have made room)
+        uint32_t target = entry.wantedMip;
+        for (; target < residentMip; ++target) {
+            const uint64_t growth = GetResidentBytes(*entry.data, target) - currentBytes;
+            if (growth <= m_settings.budgetBytes) {
+                evictUntil(m_settings.budgetBytes - growth);
+            }
+            if (residentBytes + growth <= m_settings.budgetBytes) {
+                break;
+            }
+        }
+
+        if (target < residentMip && !capReached() && SetResidentMip(entry, target)) {
+            residentBytes += GetResidentBytes(*entry.data, target) - currentBytes;
+            ++m_stats.uploads;
+        }
+    }
+
+    m_stats.pendingCount = 0;
+    for (const Entry& entry : m_entries) {
+        if (entry.wantedMip < entry.texture->GetResidentMip()) {
+            ++m_stats.pendingCount;
+        }
+    }
+    m_stats.residentBytes = residentBytes;
+    m_stats.requestedBytes = requestedBytes;
+    m_stats.budgetBytes = m_settings.budgetBytes;
+    m_stats.textureCount = static_cast<uint32_t>(m_entries.size());
+
+    ++m_frame;
+}
+
+bool TextureStreamer::Remove(const AssetHandle& handle) {
+    auto it = m_entryByHandle.find(handle);
+    if (it == m_entryByHandle.end()) {
+        return false;
+    }
+
+    // The last entry takes the removed one's place
+    const size_t index = it->second;
+    m_entryByTexture.erase(m_entries[index].texture.get());
+    m_entryByHandle.erase(it);
+    if (index + 1 != m_entries.size()) {
+        m_entries[index] = std::move(m_entries.back());
+        m_entryByHandle[m_entries[index].handle] = index;
+        m_entryByTexture[m_entries[index].texture.get()] = index;
+    }
+    m_entries.pop_back();
+    return true;
+}
+
+void TextureStreamer::Clear() {
+    m_entries.clear();
+    m_entryByHandle.clear();
+    m_entryByTexture.clear();
+    m_changed.clear();
+    m_stats = {};
+}
+
+uint32_t TextureStreamer::ComputeBaseMip(const TextureData& data, uint32_t minResidentSize) {
+    if (data.mips.size() <= 1) {
+        return 0;
+    }
+    for (uint32_t level = 0; level < data.mips.size(); ++level) {
+        if (std::max(data.mips[level].width, data.mips[level].height) <= minResidentSize) {
+            return level;
+        }
+    }
+    return static_cast<uint32_t>(data.mips.size() - 1);
+}
+
+uint64_t TextureStreamer::GetResidentBytes(const TextureData& data, uint32_t firstMip) {
+    if (data.mips.empty()) {
+        return data.dataSize;
+    }
+    uint64_t bytes = 0;
+    for (size_t level = firstMip; level < data.mips.size(); ++level) {
+        bytes += data.mips[level].size;
+    }
+    return bytes;
+}
+
+bool TextureStreamer::SetResidentMip(Entry& entry, uint32_t mip) {
+    std::shared_ptr<IRHITexture> rhiTexture;
+    try {
+        rhiTexture = Texture::UploadMips(m_device, *entry.data, mip);
+    } catch (const std::exception& e) {
+        Logger::Error("TextureStreamer", "Failed to stream '{}' to mip {}: {}", entry.data->name, mip, e.what());
+        return false;
+    }
+    if (!rhiTexture) {
+        return false;
+    }
+
+    // In-flight frames may still sample the old image
+    m_device->ReleaseDeferred(entry.texture->ReplaceRHITexture(std::move(rhiTexture), mip));
+    m_changed.push_back(entry.texture.get());
+    return true;
+}
+
+} // namespace AstralEngine
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Texture.h"
+#include "Subsystems/Asset/AssetHandle.h"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace AstralEngine {
+
+struct TextureStreamingSettings {
+    uint64_t budgetBytes = 256ull * 1024 * 1024;
+    // Levels no larger than this stay resident for every texture, budget or not
+    uint32_t minResidentSize = 64;
+    // Upgrades and downgrades both build and copy a new image and make
+    // descriptor sets be rewritten; this caps that work per frame
+    uint32_t maxUploadsPerFrame = 4;
+    // Added to the computed level; positive values request smaller mips
+    float mipBias = 0.0f;
+};
+
+struct TextureStreamingStats {
+    uint64_t residentBytes = 0;
+    uint64_t requestedBytes = 0; // What this frame's views would like resident
+    uint64_t budgetBytes = 0;
+    uint32_t textureCount = 0;
+    uint32_t pendingCount = 0;   // Textures still below their requested level
+    uint32_t uploads = 0;        // Last Update only
+    uint32_t evictions = 0;      // Last Update only
+};
+
+/**
+ * @brief Texture mip seviyelerini VRAM bütçesi içinde görünürlüğe göre yükler.
+ *
+ * Her texture önce yalnızca küçük mip kuyruğu ile oluşturulur. Renderer her
+ * frame görünen nesnelerin ekrandaki piksel boyutunu bildirir; gereken mip
+ * bundan hesaplanır. Update bütçe içinde en büyük görünen texture'ları önce
+ * yükseltir, yer açmak için en uzun süredir kullanılmayanları temel
+ * seviyeye indirir; her iki yön de frame başına kopya sınırına sayılır.
+ * Değiştirilen GPU texture'ları IRHIDevice::ReleaseDeferred ile uçuştaki
+ * frame'ler bitene kadar tutulur.
+ */
+class TextureStreamer {
+public:
+    explicit TextureStreamer(IRHIDevice* device, const TextureStreamingSettings& settings = {});
+    ~TextureStreamer();
+
+    // Returns the streamed texture for handle, creating it with only its
+    // low mips resident. data is kept to re-upload larger levels later.
+    std::shared_ptr<Texture> GetOrCreate(const AssetHandle& handle, std::shared_ptr<TextureData> data);
+
+    // Reports that texture covers about screenPixels pixels (its larger
+    // side) this frame; the largest report wins. Unknown textures are ignored.
+    void RequestResidency(const Texture* texture, float screenPixels);
+
+    // Applies this frame's requests within the budget and the per-frame copy
+    // cap. Call once per frame on the render thread before descriptor sets
+    // are written.
+    void Update();
+
+    // Textures whose GPU image changed in the last Update; descriptor sets
+    // that reference them must be rewritten
+    const std::vector<Texture*>& GetChangedTextures() const { return m_changed; }
+
+    void SetSettings(const TextureStreamingSettings& settings) { m_settings = settings; }
+    const TextureStreamingSettings& GetSettings() const { return m_settings; }
+    const TextureStreamingStats& GetStats() const { return m_stats; }
+
+    bool Contains(const AssetHandle& handle) const { return m_entryByHandle.count(handle) > 0; }
+    // Forgets one texture (e.g. its source changed), so the next GetOrCreate
+    // builds it again; the caller must make sure the GPU no longer uses it
+    bool Remove(const AssetHandle& handle);
+
+    // Drops every texture; the caller must make sure the GPU is idle
+    void Clear();
+
+private:
+    struct Entry {
+        AssetHandle handle;
+        std::shared_ptr<TextureData> data;
+        std::shared_ptr<Texture> texture;
+        uint32_t baseMip = 0;        // Smallest residency, never evicted
+        uint32_t wantedMip = 0;      // From this frame's requests
+        uint64_t lastUsedFrame = 0;
+        float screenPixels = 0.0f;   // Largest request this frame
+    };
+
+    static uint32_t ComputeBaseMip(const TextureData& data, uint32_t minResidentSize);
+    static uint64_t GetResidentBytes(const TextureData& data, uint32_t firstMip);
+
+    // Re-uploads entry from mip; false (and unchanged) if the upload failed
+    bool SetResidentMip(Entry& entry, uint32_t mip);
+
+    IRHIDevice* m_device;
+    TextureStreamingSettings m_settings;
+    TextureStreamingStats m_stats;
+
+    std::vector<Entry> m_entries;
+    std::unordered_map<AssetHandle, size_t> m_entryByHandle;
+    std::unordered_map<const Texture*, size_t> m_entryByTexture;
+
+    std::vector<Texture*> m_changed;
+    uint64_t m_frame = 1;
+};
+
+} // namespace AstralEngine
@@ -0,0 +1,40 @@
+#include "VertexLayout.h"
+
+#include <cstddef>
+
+namespace AstralEngine {
+
+    void VertexLayout::Apply(RHIPipelineStateDescriptor& desc, VertexFormat format) {
+        desc.vertexBindings = { { 0, GetStride(format), false } };
+
+        if (format == VertexFormat::Packed) {
+            // Bitangent is rebuilt in the shader from normal, tangent and the
+            // sign in position.w; location 4 aliases the tangent so the input
+            // interface stays the same for both layouts
+            desc.vertexAttributes = {
+                { 0, 0, RHIFormat::R16G16B16A16_UNORM, offsetof(PackedVertex, position) },
+                { 1, 0, RHIFormat::R16G16_SNORM, offsetof(PackedVertex, normal) },
+                { 2, 0, RHIFormat::R16G16_FLOAT, offsetof(PackedVertex, texCoord) },
+                { 3, 0, RHIFormat::R16G16_SNORM, offsetof(PackedVertex, tangent) },
+                { 4, 0, RHIFormat::R16G16_SNORM, offsetof(PackedVertex, tangent) },
+            };
+            return;
+        }
+
+        desc.vertexAttributes = {
+            { 0, 0, RHIFormat::R32G32B32_FLOAT, offsetof(Vertex, position) },
+            { 1, 0, RHIFormat::R32G32B32_FLOAT, offsetof(Vertex, normal) },
+            { 2, 0, RHIFormat::R32G32_FLOAT, offsetof(Vertex, texCoord) },
+            { 3, 0, RHIFormat::R32G32B32_FLOAT, offsetof(Vertex, tangent) },
+            { 4, 0, RHIFormat::R32G32B32_FLOAT, offsetof(Vertex, bitangent) },
+        };
+    }
+
+    void VertexLayout::ApplyPositionOnly(RHIPipelineStateDescriptor& desc, VertexFormat format) {
+        desc.vertexBindings = { { 0, GetStride(format), false } };
+        desc.vertexAttributes = { format == VertexFormat::Packed
+            ? RHIVertexInputAttribute{ 0, 0, RHIFormat::R16G16B16A16_UNORM, offsetof(PackedVertex, position) }
+            : RHIVertexInputAttribute{ 0, 0, RHIFormat::R32G32B32_FLOAT, offsetof(Vertex, position) } };
+    }
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../RHI/IRHIPipeline.h"
+#include "../../Asset/AssetData.h"
+
+namespace AstralEngine {
+
+    // Vertex input state for each VertexFormat. Locations match PBR.vert:
+    // 0 position, 1 normal, 2 uv, 3 tangent, 4 bitangent.
+    class VertexLayout {
+    public:
+        // Replaces the bindings/attributes of desc with the full layout of format
+        static void Apply(RHIPipelineStateDescriptor& desc, VertexFormat format);
+
+        // Position only (depth/shadow passes)
+        static void ApplyPositionOnly(RHIPipelineStateDescriptor& desc, VertexFormat format);
+
+        static uint32_t GetStride(VertexFormat format) {
+            return format == VertexFormat::Packed ? sizeof(PackedVertex) : sizeof(Vertex);
+        }
+    };
+
+}
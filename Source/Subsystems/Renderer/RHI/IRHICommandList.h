@@ -34,6 +34,13 @@ public:
 
     // Resource transitions (Internal/Utility)
     virtual void TransitionImageLayout(IRHITexture* texture, int oldLayout, int newLayout) = 0;
+
+    // State-based barrier; used by the render graph
+    virtual void ResourceBarrier(IRHITexture* texture, RHIResourceState before, RHIResourceState after) = 0;
+
+    // When disabled, BeginRendering/EndRendering leave attachment layouts alone
+    // and the caller (render graph) is responsible for all transitions.
+    virtual void SetAutomaticLayoutTransitions(bool enabled) = 0;
 };
 
 } // namespace AstralEngine
@@ -14,8 +14,13 @@ class IRHIDescriptorSet : public IRHIResource {
 public:
     virtual ~IRHIDescriptorSet() = default;
 
+    // Updates are recorded and applied together by CommitUpdates()
     virtual void UpdateUniformBuffer(uint32_t binding, IRHIBuffer* buffer, uint64_t offset, uint64_t range) = 0;
     virtual void UpdateCombinedImageSampler(uint32_t binding, IRHITexture* texture, IRHISampler* sampler) = 0;
+
+    // Flushes all pending updates in a single batch; required before the set
+    // is bound, and never while a recorded frame may still use it
+    virtual void CommitUpdates() = 0;
 };
 
 } // namespace AstralEngine
@@ -28,6 +28,9 @@ public:
 
     virtual std::shared_ptr<IRHITexture> CreateTexture2D(uint32_t width, uint32_t height, RHIFormat format, RHITextureUsage usage, uint32_t mipLevels = 1) = 0;
     virtual std::shared_ptr<IRHITexture> CreateAndUploadTexture(uint32_t width, uint32_t height, RHIFormat format, const void* data) = 0;
+    // Uploads a full mip chain (mips[0] is width x height) in one staging copy.
+    // Does not wait for the copy: frames submitted afterwards see the data.
+    virtual std::shared_ptr<IRHITexture> CreateAndUploadTextureMips(RHIFormat format, std::span<const RHITextureMipData> mips) = 0;
     virtual std::shared_ptr<IRHITexture> CreateTextureCube(uint32_t width, uint32_t height, RHIFormat format, RHITextureUsage usage, uint32_t mipLevels = 1) = 0;
     virtual std::shared_ptr<IRHITexture> CreateAndUploadTextureCube(uint32_t width, uint32_t height, RHIFormat format, const std::vector<const void*>& faceData) = 0;
     virtual std::shared_ptr<IRHISampler> CreateSampler(const RHISamplerDescriptor& descriptor) = 0;
@@ -38,6 +41,8 @@ public:
     // Descriptors
     virtual std::shared_ptr<IRHIDescriptorSetLayout> CreateDescriptorSetLayout(const std::vector<RHIDescriptorSetLayoutBinding>& bindings) = 0;
     virtual std::shared_ptr<IRHIDescriptorSet> AllocateDescriptorSet(IRHIDescriptorSetLayout* layout) = 0;
+    // Set valid for the current frame only; its memory is recycled when this frame slot comes around again
+    virtual std::shared_ptr<IRHIDescriptorSet> AllocateTransientDescriptorSet(IRHIDescriptorSetLayout* layout) = 0;
 
     // Command List
     virtual std::shared_ptr<IRHICommandList> CreateCommandList() = 0;
@@ -52,6 +57,13 @@ public:
     virtual IRHITexture* GetDepthBuffer() = 0;
     virtual uint32_t GetCurrentFrameIndex() const = 0;
     
+    // Whether textures of this format can be created and sampled (e.g. BC needs textureCompressionBC)
+    virtual bool SupportsSampledFormat(RHIFormat format) const = 0;
+
+    // Keeps resource alive until every frame already recorded that may use it
+    // has finished on the GPU; call from the render thread
+    virtual void ReleaseDeferred(std::shared_ptr<IRHIResource> resource) = 0;
+
     // Waiting
     virtual void WaitIdle() = 0;
 };
@@ -14,6 +14,8 @@ enum class RHIFormat {
     B8G8R8A8_UNORM,
     B8G8R8A8_SRGB,
     R16G16_FLOAT,
+    R16G16_SNORM,
+    R16G16B16A16_UNORM,
     R16G16B16A16_FLOAT,
     R32_FLOAT,
     R32G32_FLOAT,
@@ -21,9 +23,62 @@ enum class RHIFormat {
     R32G32B32A32_FLOAT,
     D32_FLOAT,
     D24_UNORM_S8_UINT,
-    D32_FLOAT_S8_UINT
+    D32_FLOAT_S8_UINT,
+    // Block-compressed (4x4 texel blocks)
+    BC1_RGBA_UNORM,
+    BC1_RGBA_SRGB,
+    BC3_UNORM,
+    BC3_SRGB,
+    BC5_UNORM,
+    BC6H_UFLOAT,
+    BC7_UNORM,
+    BC7_SRGB
 };
 
+inline bool IsBlockCompressed(RHIFormat format) {
+    return format >= RHIFormat::BC1_RGBA_UNORM && format <= RHIFormat::BC7_SRGB;
+}
+
+// Bytes per 4x4 block for compressed formats, per texel otherwise (0 if unknown)
+inline uint32_t GetFormatBlockSize(RHIFormat format) {
+    switch (format) {
+        case RHIFormat::R8_UNORM: return 1;
+        case RHIFormat::R8G8_UNORM: return 2;
+        case RHIFormat::R8G8B8A8_UNORM:
+        case RHIFormat::R8G8B8A8_SRGB:
+        case RHIFormat::B8G8R8A8_UNORM:
+        case RHIFormat::B8G8R8A8_SRGB:
+        case RHIFormat::R16G16_FLOAT:
+        case RHIFormat::R16G16_SNORM:
+        case RHIFormat::R32_FLOAT:
+        case RHIFormat::D32_FLOAT:
+        case RHIFormat::D24_UNORM_S8_UINT: return 4;
+        case RHIFormat::R16G16B16A16_UNORM:
+        case RHIFormat::R16G16B16A16_FLOAT:
+        case RHIFormat::R32G32_FLOAT:
+        case RHIFormat::D32_FLOAT_S8_UINT: return 8;
+        case RHIFormat::R32G32B32_FLOAT: return 12;
+        case RHIFormat::R32G32B32A32_FLOAT: return 16;
+        case RHIFormat::BC1_RGBA_UNORM:
+        case RHIFormat::BC1_RGBA_SRGB: return 8;
+        case RHIFormat::BC3_UNORM:
+        case RHIFormat::BC3_SRGB:
+        case RHIFormat::BC5_UNORM:
+        case RHIFormat::BC6H_UFLOAT:
+        case RHIFormat::BC7_UNORM:
+        case RHIFormat::BC7_SRGB: return 16;
+        default: return 0;
+    }
+}
+
+// Size of one mip level's data, tightly packed
+inline uint64_t GetFormatImageSize(RHIFormat format, uint32_t width, uint32_t height) {
+    if (IsBlockCompressed(format)) {
+        return static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4) * GetFormatBlockSize(format);
+    }
+    return static_cast<uint64_t>(width) * height * GetFormatBlockSize(format);
+}
+
 enum class RHIShaderStage {
     Vertex = 1 << 0,
     Fragment = 1 << 1,
@@ -119,6 +174,15 @@ struct RHISamplerDescriptor {
     RHISamplerAddressMode addressModeW = RHISamplerAddressMode::Repeat;
     bool anisotropyEnable = true;
     float maxAnisotropy = 16.0f;
+    float maxLod = 0.0f; // 0 samples only the top mip
+};
+
+// One mip level of an uploaded texture, level 0 first
+struct RHITextureMipData {
+    const void* data;
+    uint64_t size;
+    uint32_t width;
+    uint32_t height;
 };
 
 inline RHIMemoryProperty operator|(RHIMemoryProperty a, RHIMemoryProperty b) {
@@ -158,6 +222,19 @@ inline RHIShaderStage operator&(RHIShaderStage a, RHIShaderStage b) {
 }
 
 
+// How a texture is about to be accessed; backends map this to layouts,
+// pipeline stages and access masks when building barriers.
+enum class RHIResourceState {
+    Undefined,
+    ColorAttachment,
+    DepthAttachment,
+    DepthRead,
+    ShaderRead,
+    TransferSrc,
+    TransferDst,
+    Present
+};
+
 enum class RHIDescriptorType {
     Sampler,
     CombinedImageSampler,
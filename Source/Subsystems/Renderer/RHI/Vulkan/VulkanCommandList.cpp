@@ -1,6 +1,7 @@
 #include "VulkanCommandList.h"
 #include "VulkanDevice.h"
 #include "VulkanResources.h"
+#include <cassert>
 #include <stdexcept>
 #include <array>
 #include <vector>
@@ -138,6 +139,87 @@ void VulkanCommandList::TransitionImageLayout(VulkanTexture* texture, VkImageLay
                           baseMipLevel, levelCount, baseArrayLayer, layerCount, isDepth);
 }
 
+namespace {
+
+struct VulkanStateInfo {
+    VkImageLayout layout;
+    VkPipelineStageFlags2 stage;
+    VkAccessFlags2 access;
+};
+
+VulkanStateInfo GetVulkanStateInfo(RHIResourceState state) {
+    switch (state) {
+        case RHIResourceState::ColorAttachment:
+            return { VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                     VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT };
+        case RHIResourceState::DepthAttachment:
+            return { VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                     VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                     VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT };
+        case RHIResourceState::DepthRead:
+            return { VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL,
+                     VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT,
+                     VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_SHADER_SAMPLED_READ_BIT };
+        case RHIResourceState::ShaderRead:
+            return { VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                     VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT,
+                     VK_ACCESS_2_SHADER_SAMPLED_READ_BIT };
+        case RHIResourceState::TransferSrc:
+            return { VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_READ_BIT };
+        case RHIResourceState::TransferDst:
+            return { VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT };
+        case RHIResourceState::Present:
+            return { VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT, 0 };
+        case RHIResourceState::Undefined:
+        default:
+            // Memory may still be in use by an earlier frame or an aliased
+            // resource, so wait on all prior work rather than TOP_OF_PIPE.
+            return { VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, 0 };
+    }
+}
+
+} // namespace
+
+void VulkanCommandList::ResourceBarrier(IRHITexture* texture, RHIResourceState before, RHIResourceState after) {
+    auto* vkTexture = static_cast<VulkanTexture*>(texture);
+    VulkanStateInfo src = GetVulkanStateInfo(before);
+    VulkanStateInfo dst = GetVulkanStateInfo(after);
+
+    RHIFormat format = texture->GetFormat();
+    bool isDepth = (format == RHIFormat::D32_FLOAT || format == RHIFormat::D24_UNORM_S8_UINT ||
+                    format == RHIFormat::D32_FLOAT_S8_UINT);
+
+    VkImageMemoryBarrier2 barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    barrier.srcStageMask = src.stage;
+    barrier.srcAccessMask = src.access;
+    barrier.dstStageMask = dst.stage;
+    barrier.dstAccessMask = dst.access;
+    barrier.oldLayout = src.layout;
+    barrier.newLayout = dst.layout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = vkTexture->GetImage();
+    barrier.subresourceRange.aspectMask = isDepth ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+
+    VkDependencyInfo dependencyInfo{};
+    dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    dependencyInfo.imageMemoryBarrierCount = 1;
+    dependencyInfo.pImageMemoryBarriers = &barrier;
+
+    auto func = (PFN_vkCmdPipelineBarrier2)vkGetDeviceProcAddr(m_device->GetVkDevice(), "vkCmdPipelineBarrier2");
+    if (func) {
+        func(m_commandBuffer, &dependencyInfo);
+    }
+
+    // Keep the tracked layout in sync for code that still relies on it
+    vkTexture->SetLayout(dst.layout);
+}
+
 VulkanCommandList::VulkanCommandList(VulkanDevice* device, VkCommandPool pool)
     : m_device(device), m_pool(pool) {
     
@@ -208,8 +290,10 @@ void VulkanCommandList::BeginRendering(const std::vector<RHIRenderingAttachment>
         m_activeColorAttachments.push_back({ vkTexture, attachment.mipLevel, attachment.arrayLayer });
         
         // Transition only the specific subresource to COLOR_ATTACHMENT_OPTIMAL
-        TransitionImageLayout(vkTexture, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, 
-                                attachment.mipLevel, 1, attachment.arrayLayer, 1);
+        if (m_automaticTransitions) {
+            TransitionImageLayout(vkTexture, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, 
+                                    attachment.mipLevel, 1, attachment.arrayLayer, 1);
+        }
 
         VkRenderingAttachmentInfo colorInfo{};
         colorInfo.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
@@ -236,8 +320,10 @@ void VulkanCommandList::BeginRendering(const std::vector<RHIRenderingAttachment>
         m_hasActiveDepthAttachment = true;
         
         // Transition only the specific subresource to DEPTH_STENCIL_ATTACHMENT_OPTIMAL
-        TransitionImageLayout(vkTexture, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, 
-                                depthAttachment->mipLevel, 1, depthAttachment->arrayLayer, 1, true);
+        if (m_automaticTransitions) {
+            TransitionImageLayout(vkTexture, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, 
+                                    depthAttachment->mipLevel, 1, depthAttachment->arrayLayer, 1, true);
+        }
 
         depthInfo.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
         
@@ -274,6 +360,12 @@ void VulkanCommandList::EndRendering() {
         func(m_commandBuffer);
     }
 
+    if (!m_automaticTransitions) {
+        m_activeColorAttachments.clear();
+        m_hasActiveDepthAttachment = false;
+        return;
+    }
+
     // Transition color attachments to their optimal post-render layout
     for (const auto& activeAtt : m_activeColorAttachments) {
         auto* vkTexture = activeAtt.texture;
@@ -298,7 +390,11 @@ void VulkanCommandList::BindPipeline(IRHIPipeline* pipeline) {
 }
 
 void VulkanCommandList::BindDescriptorSet(IRHIPipeline* pipeline, IRHIDescriptorSet* descriptorSet, uint32_t setIndex) {
-    VkDescriptorSet vkSet = static_cast<VulkanDescriptorSet*>(descriptorSet)->GetVkDescriptorSet();
+    auto* vkDescriptorSet = static_cast<VulkanDescriptorSet*>(descriptorSet);
+    // Writing a set mid-recording could change one an earlier draw of this
+    // frame already bound; the owner commits it before recording starts
+    assert(!vkDescriptorSet->HasPendingUpdates() && "CommitUpdates must be called before binding");
+    VkDescriptorSet vkSet = vkDescriptorSet->GetVkDescriptorSet();
     VkPipelineLayout layout = static_cast<VulkanPipeline*>(pipeline)->GetLayout();
     vkCmdBindDescriptorSets(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, setIndex, 1, &vkSet, 0, nullptr);
 }
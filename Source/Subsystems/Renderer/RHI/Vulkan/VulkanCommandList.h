@@ -39,6 +39,8 @@ public:
     
     // Resource transitions
     void TransitionImageLayout(IRHITexture* texture, int oldLayout, int newLayout) override;
+    void ResourceBarrier(IRHITexture* texture, RHIResourceState before, RHIResourceState after) override;
+    void SetAutomaticLayoutTransitions(bool enabled) override { m_automaticTransitions = enabled; }
 
     // Vulkan specific
     void TransitionImageLayout(VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout, 
@@ -66,6 +68,7 @@ private:
     std::vector<ActiveAttachment> m_activeColorAttachments;
     ActiveAttachment m_activeDepthAttachment;
     bool m_hasActiveDepthAttachment = false;
+    bool m_automaticTransitions = true;
 };
 
 } // namespace AstralEngine
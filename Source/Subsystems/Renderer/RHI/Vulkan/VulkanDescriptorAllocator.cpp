@@ -0,0 +1,213 @@
+#include "VulkanDescriptorAllocator.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace AstralEngine {
+
+namespace {
+
+// Descriptors per set, per type; tuned for material/global sets which are
+// mostly combined image samplers with a uniform buffer or two.
+struct PoolSizeRatio {
+    VkDescriptorType type;
+    float ratio;
+};
+
+constexpr PoolSizeRatio kPoolRatios[] = {
+    {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 6.0f},
+    {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2.0f},
+    {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1.0f},
+    {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1.0f},
+    {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1.0f},
+    {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1.0f},
+    {VK_DESCRIPTOR_TYPE_SAMPLER, 0.5f},
+};
+
+constexpr uint32_t kMaxSetsPerPool = 4096;
+
+} // namespace
+
+VulkanDescriptorAllocator::~VulkanDescriptorAllocator() {
+    Shutdown();
+}
+
+void VulkanDescriptorAllocator::Initialize(VkDevice device, bool freeable, uint32_t framesInFlight, uint32_t setsPerPool) {
+    m_device = device;
+    m_freeable = freeable;
+    m_setsPerPool = setsPerPool;
+    m_pendingFrees.resize(framesInFlight);
+}
+
+void VulkanDescriptorAllocator::Shutdown() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_device) return;
+
+    // Destroying the pools releases every set allocated from them
+    for (auto pool : m_usedPools) {
+        vkDestroyDescriptorPool(m_device, pool, nullptr);
+    }
+    for (auto pool : m_readyPools) {
+        vkDestroyDescriptorPool(m_device, pool, nullptr);
+    }
+    m_usedPools.clear();
+    m_readyPools.clear();
+    m_freedPools.clear();
+    m_poolStates.clear();
+    m_pendingFrees.clear();
+    m_currentPool = VK_NULL_HANDLE;
+    m_device = VK_NULL_HANDLE;
+}
+
+VkDescriptorPool VulkanDescriptorAllocator::CreatePool(uint32_t setCount) {
+    std::vector<VkDescriptorPoolSize> poolSizes;
+    for (const auto& ratio : kPoolRatios) {
+        uint32_t count = std::max(1u, static_cast<uint32_t>(ratio.ratio * setCount));
+        poolSizes.push_back({ratio.type, count});
+    }
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.flags = m_freeable ? VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT : 0;
+    poolInfo.maxSets = setCount;
+    poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+    poolInfo.pPoolSizes = poolSizes.data();
+
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create descriptor pool!");
+    }
+    return pool;
+}
+
+VkDescriptorPool VulkanDescriptorAllocator::GrabPool() {
+    if (!m_readyPools.empty()) {
+        VkDescriptorPool pool = m_readyPools.back();
+        m_readyPools.pop_back();
+        return pool;
+    }
+
+    VkDescriptorPool pool = CreatePool(m_setsPerPool);
+    Logger::Debug("VulkanDescriptorAllocator", "Created descriptor pool #{} ({} sets)",
+                  m_usedPools.size() + 1, m_setsPerPool);
+
+    // Grow geometrically so long sessions settle on a handful of large pools
+    m_setsPerPool = std::min(m_setsPerPool * 2, kMaxSetsPerPool);
+    return pool;
+}
+
+VkResult VulkanDescriptorAllocator::TryAllocate(VkDescriptorPool pool, VkDescriptorSetLayout layout,
+                                                VkDescriptorSet* set) {
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = pool;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &layout;
+    return vkAllocateDescriptorSets(m_device, &allocInfo, set);
+}
+
+VkDescriptorSet VulkanDescriptorAllocator::Allocate(VkDescriptorSetLayout layout, VkDescriptorPool* outPool) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_currentPool) {
+        m_currentPool = GrabPool();
+        m_usedPools.push_back(m_currentPool);
+    }
+
+    auto exhausted = [](VkResult result) {
+        return result == VK_ERROR_OUT_OF_POOL_MEMORY || result == VK_ERROR_FRAGMENTED_POOL;
+    };
+
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    VkResult result = TryAllocate(m_currentPool, layout, &set);
+
+    // Current pool is exhausted; reuse space freed in older pools first.
+    // A pool that still fails is dropped from the list until more is freed.
+    while (exhausted(result) && !m_freedPools.empty()) {
+        VkDescriptorPool pool = m_freedPools.back();
+        m_freedPools.pop_back();
+        m_poolStates[pool].hasFreedSets = false;
+        result = TryAllocate(pool, layout, &set);
+        if (result == VK_SUCCESS) {
+            m_currentPool = pool;
+        }
+    }
+
+    if (exhausted(result)) {
+        // Move on to a fresh pool and retry once
+        m_currentPool = GrabPool();
+        m_usedPools.push_back(m_currentPool);
+        result = TryAllocate(m_currentPool, layout, &set);
+    }
+
+    if (result != VK_SUCCESS) {
+        throw std::runtime_error("failed to allocate descriptor set!");
+    }
+
+    if (m_freeable) {
+        m_poolStates[m_currentPool].liveSets++;
+    }
+    if (outPool) {
+        *outPool = m_currentPool;
+    }
+    return set;
+}
+
+void VulkanDescriptorAllocator::Free(VkDescriptorPool pool, VkDescriptorSet set, uint32_t frameIndex) {
+    if (!m_freeable || !set) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_pendingFrees.empty()) return;
+    m_pendingFrees[frameIndex % m_pendingFrees.size()].emplace_back(pool, set);
+}
+
+void VulkanDescriptorAllocator::ProcessDeferredFrees(uint32_t frameIndex) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_pendingFrees.empty()) return;
+
+    auto& frees = m_pendingFrees[frameIndex % m_pendingFrees.size()];
+    for (const auto& [pool, set] : frees) {
+        vkFreeDescriptorSets(m_device, pool, 1, &set);
+
+        PoolState& state = m_poolStates[pool];
+        state.liveSets--;
+        if (pool == m_currentPool) {
+            continue;
+        }
+
+        if (state.liveSets == 0) {
+            // Empty: reset it and hand it out again as if new
+            vkResetDescriptorPool(m_device, pool, 0);
+            m_usedPools.erase(std::find(m_usedPools.begin(), m_usedPools.end(), pool));
+            if (state.hasFreedSets) {
+                m_freedPools.erase(std::find(m_freedPools.begin(), m_freedPools.end(), pool));
+            }
+            m_poolStates.erase(pool);
+            m_readyPools.push_back(pool);
+        } else if (!state.hasFreedSets) {
+            state.hasFreedSets = true;
+            m_freedPools.push_back(pool);
+        }
+    }
+    frees.clear();
+}
+
+void VulkanDescriptorAllocator::ResetPools() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto pool : m_usedPools) {
+        vkResetDescriptorPool(m_device, pool, 0);
+        m_readyPools.push_back(pool);
+    }
+    m_usedPools.clear();
+    m_freedPools.clear();
+    m_poolStates.clear();
+    m_currentPool = VK_NULL_HANDLE;
+}
+
+size_t VulkanDescriptorAllocator::GetPoolCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_usedPools.size() + m_readyPools.size();
+}
+
+} // namespace AstralEngine
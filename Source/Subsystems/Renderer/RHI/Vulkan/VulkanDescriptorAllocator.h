@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace AstralEngine {
+
+// Growable pool-of-pools descriptor allocator.
+// A new pool is created whenever the current one runs dry, so there is no
+// fixed upper bound on live sets. Persistent allocators support (deferred)
+// freeing of individual sets; transient allocators are reset wholesale.
+// Freed capacity is reused: a pool that sets were freed back into is tried
+// before a new pool is created, and a pool whose last set is freed is reset
+// and recycled, so create/destroy churn does not grow the pool list.
+class VulkanDescriptorAllocator {
+public:
+    VulkanDescriptorAllocator() = default;
+    ~VulkanDescriptorAllocator();
+
+    VulkanDescriptorAllocator(const VulkanDescriptorAllocator&) = delete;
+    VulkanDescriptorAllocator& operator=(const VulkanDescriptorAllocator&) = delete;
+
+    void Initialize(VkDevice device, bool freeable, uint32_t framesInFlight, uint32_t setsPerPool = 256);
+    void Shutdown();
+
+    // Grows the pool list if needed and throws on failure; outPool receives the owning pool
+    VkDescriptorSet Allocate(VkDescriptorSetLayout layout, VkDescriptorPool* outPool = nullptr);
+
+    // Queues a set to be freed once frameIndex comes around again (GPU is done with it)
+    void Free(VkDescriptorPool pool, VkDescriptorSet set, uint32_t frameIndex);
+    void ProcessDeferredFrees(uint32_t frameIndex);
+
+    // Recycles every pool with one vkResetDescriptorPool each (transient use)
+    void ResetPools();
+
+    size_t GetPoolCount() const;
+
+private:
+    VkDescriptorPool GrabPool();
+    VkDescriptorPool CreatePool(uint32_t setCount);
+    VkResult TryAllocate(VkDescriptorPool pool, VkDescriptorSetLayout layout, VkDescriptorSet* set);
+
+    // Freeable allocators only
+    struct PoolState {
+        uint32_t liveSets = 0;
+        bool hasFreedSets = false; // Listed in m_freedPools
+    };
+
+    VkDevice m_device = VK_NULL_HANDLE;
+    bool m_freeable = false;
+    uint32_t m_setsPerPool = 256;
+
+    VkDescriptorPool m_currentPool = VK_NULL_HANDLE;
+    std::vector<VkDescriptorPool> m_usedPools;  // Pools handed out since the last reset
+    std::vector<VkDescriptorPool> m_readyPools; // Reset pools waiting for reuse
+    std::vector<VkDescriptorPool> m_freedPools; // Used pools that sets were freed back into
+    std::unordered_map<VkDescriptorPool, PoolState> m_poolStates;
+
+    std::vector<std::vector<std::pair<VkDescriptorPool, VkDescriptorSet>>> m_pendingFrees;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace AstralEngine
@@ -13,6 +13,9 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <set>
 #include <stdexcept>
@@ -54,7 +57,8 @@ bool VulkanDevice::Initialize() {
     CreateImageViews();
     // CreateRenderPass(); // Removed for Dynamic Rendering
     CreateDepthResources();
-    CreateDescriptorPool();
+    CreateDescriptorAllocators();
+    CreatePipelineCache();
     // CreateFramebuffers(); // Removed for Dynamic Rendering
     CreateCommandPool();
     CreateSyncObjects();
@@ -71,11 +75,16 @@ void VulkanDevice::Shutdown() {
   if (m_device) {
     WaitIdle();
 
-    if (m_descriptorPool) {
-      vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
-      m_descriptorPool = VK_NULL_HANDLE;
+    if (m_pipelineCache) {
+      SavePipelineCache();
+      vkDestroyPipelineCache(m_device, m_pipelineCache, nullptr);
+      m_pipelineCache = VK_NULL_HANDLE;
     }
 
+    m_descriptorAllocator.Shutdown();
+    for (auto &allocator : m_frameDescriptorAllocators)
+      allocator.Shutdown();
+
     for (auto semaphore : m_imageAvailableSemaphores)
       vkDestroySemaphore(m_device, semaphore, nullptr);
     for (auto semaphore : m_renderFinishedSemaphores)
@@ -85,6 +94,8 @@ void VulkanDevice::Shutdown() {
 
     for (auto pool : m_commandPools)
       vkDestroyCommandPool(m_device, pool, nullptr);
+    if (m_uploadCommandPool)
+      vkDestroyCommandPool(m_device, m_uploadCommandPool, nullptr);
     // for (auto framebuffer : m_swapchainFramebuffers)
     // vkDestroyFramebuffer(m_device, framebuffer, nullptr);
     // vkDestroyRenderPass(m_device, m_renderPass, nullptr);
@@ -307,9 +318,14 @@ void VulkanDevice::CreateLogicalDevice() {
   features13.dynamicRendering = VK_TRUE;
   features13.synchronization2 = VK_TRUE;
 
+  VkPhysicalDeviceFeatures supportedFeatures;
+  vkGetPhysicalDeviceFeatures(m_physicalDevice, &supportedFeatures);
+
   VkPhysicalDeviceFeatures2 deviceFeatures2{};
   deviceFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
   deviceFeatures2.features.samplerAnisotropy = VK_TRUE;
+  // Cooked textures are BC-compressed; without it they are rejected at load
+  deviceFeatures2.features.textureCompressionBC = supportedFeatures.textureCompressionBC;
   deviceFeatures2.pNext = &features13;
 
   const std::vector<const char *> deviceExtensions = {
@@ -477,31 +493,200 @@ void VulkanDevice::CreateImageViews() {
 //    ...
 // }
 
-void VulkanDevice::CreateDescriptorPool() {
-  std::vector<VkDescriptorPoolSize> poolSizes = {
-      {VK_DESCRIPTOR_TYPE_SAMPLER, 1000},
-      {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1000},
-      {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1000},
-      {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1000},
-      {VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 1000},
-      {VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, 1000},
-      {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1000},
-      {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1000},
-      {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1000},
-      {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1000},
-      {VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 1000}};
-
-  VkDescriptorPoolCreateInfo poolInfo{};
-  poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-  poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
-  poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
-  poolInfo.pPoolSizes = poolSizes.data();
-  poolInfo.maxSets = 1000 * static_cast<uint32_t>(poolSizes.size());
-
-  if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_descriptorPool) !=
+void VulkanDevice::CreateDescriptorAllocators() {
+  // Persistent sets (materials, global UBO sets) can be freed one by one;
+  // transient pools are only ever reset wholesale, so skip the free bit.
+  m_descriptorAllocator.Initialize(m_device, true, MAX_FRAMES_IN_FLIGHT);
+  for (auto &allocator : m_frameDescriptorAllocators)
+    allocator.Initialize(m_device, false, MAX_FRAMES_IN_FLIGHT, 128);
+}
+
+void VulkanDevice::CreatePipelineCache() {
+  const char *basePath = SDL_GetBasePath();
+  m_pipelineCachePath =
+      (std::filesystem::path(basePath ? basePath : "") / "PipelineCache.bin")
+          .string();
+
+  std::vector<char> cacheData;
+  std::ifstream file(m_pipelineCachePath, std::ios::binary | std::ios::ate);
+  if (file.is_open()) {
+    cacheData.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(cacheData.data(), cacheData.size());
+  }
+
+  // Drivers reject foreign blobs themselves, but some crash on them; validate
+  // the header against this device before handing it over.
+  if (!cacheData.empty()) {
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(m_physicalDevice, &props);
+
+    VkPipelineCacheHeaderVersionOne header{};
+    bool valid = cacheData.size() >= sizeof(header);
+    if (valid) {
+      std::memcpy(&header, cacheData.data(), sizeof(header));
+      valid = header.headerSize >= sizeof(header) &&
+              header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+              header.vendorID == props.vendorID &&
+              header.deviceID == props.deviceID &&
+              std::memcmp(header.pipelineCacheUUID, props.pipelineCacheUUID,
+                     VK_UUID_SIZE) == 0;
+    }
+
+    if (!valid) {
+      Logger::Warning("VulkanDevice",
+                      "Discarding incompatible pipeline cache: {}",
+                      m_pipelineCachePath);
+      cacheData.clear();
+    }
+  }
+
+  VkPipelineCacheCreateInfo cacheInfo{};
+  cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+  cacheInfo.initialDataSize = cacheData.size();
+  cacheInfo.pInitialData = cacheData.empty() ? nullptr : cacheData.data();
+
+  if (vkCreatePipelineCache(m_device, &cacheInfo, nullptr, &m_pipelineCache) !=
       VK_SUCCESS) {
-    throw std::runtime_error("failed to create descriptor pool!");
+    throw std::runtime_error("failed to create pipeline cache!");
+  }
+
+  Logger::Info("VulkanDevice", "Pipeline cache created ({} bytes loaded)",
+               cacheData.size());
+}
+
+void VulkanDevice::SavePipelineCache() {
+  size_t dataSize = 0;
+  if (vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, nullptr) !=
+          VK_SUCCESS ||
+      dataSize == 0) {
+    return;
+  }
+
+  std::vector<char> cacheData(dataSize);
+  if (vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize,
+                             cacheData.data()) != VK_SUCCESS) {
+    Logger::Warning("VulkanDevice", "Failed to read pipeline cache data");
+    return;
+  }
+
+  // Write to a temp file first so a crash mid-write can't leave a torn cache
+  std::string tempPath = m_pipelineCachePath + ".tmp";
+  {
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+      Logger::Warning("VulkanDevice", "Failed to write pipeline cache: {}",
+                      tempPath);
+      return;
+    }
+    file.write(cacheData.data(), dataSize);
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(tempPath, m_pipelineCachePath, ec);
+  if (ec) {
+    Logger::Warning("VulkanDevice", "Failed to save pipeline cache: {}",
+                    ec.message());
+    return;
+  }
+
+  Logger::Info("VulkanDevice",
+               "Pipeline cache saved ({} bytes, {} pipelines created in "
+               "{:.2f} ms, {} dedup hits)",
+               dataSize, m_pipelineCacheMisses, m_pipelineCreateTimeMs,
+               m_pipelineCacheHits);
+}
+
+CacheKey VulkanDevice::SerializePipelineState(
+    const RHIPipelineStateDescriptor &descriptor) const {
+  CacheKey key;
+
+  // Shaders and layouts are keyed by content, not address, so materials that
+  // build their own copies of the same program still share one pipeline.
+  for (IRHIShader *shader : {descriptor.vertexShader, descriptor.fragmentShader}) {
+    static const std::vector<uint8_t> noCode;
+    const auto &code =
+        shader ? static_cast<VulkanShader *>(shader)->GetCode() : noCode;
+    AppendKey(key, code.size());
+    AppendKeyBytes(key, code.data(), code.size());
+  }
+
+  AppendKey(key, descriptor.vertexBindings.size());
+  for (const auto &binding : descriptor.vertexBindings) {
+    AppendKey(key, binding.binding);
+    AppendKey(key, binding.stride);
+    AppendKey(key, binding.isInstanced);
+  }
+
+  AppendKey(key, descriptor.vertexAttributes.size());
+  for (const auto &attr : descriptor.vertexAttributes) {
+    AppendKey(key, attr.location);
+    AppendKey(key, attr.binding);
+    AppendKey(key, attr.format);
+    AppendKey(key, attr.offset);
+  }
+
+  AppendKey(key, descriptor.pushConstants.size());
+  for (const auto &range : descriptor.pushConstants) {
+    AppendKey(key, range.stageFlags);
+    AppendKey(key, range.offset);
+    AppendKey(key, range.size);
+  }
+
+  AppendKey(key, descriptor.descriptorSetLayouts.size());
+  for (auto *layout : descriptor.descriptorSetLayouts) {
+    static const CacheKey noBindings;
+    const CacheKey &bindings =
+        layout ? static_cast<VulkanDescriptorSetLayout *>(layout)->GetBindingsKey()
+               : noBindings;
+    AppendKey(key, bindings.size());
+    AppendKeyBytes(key, bindings.data(), bindings.size());
+  }
+
+  AppendKey(key, descriptor.cullMode);
+  AppendKey(key, descriptor.frontFace);
+  AppendKey(key, descriptor.depthTestEnabled);
+  AppendKey(key, descriptor.depthWriteEnabled);
+  AppendKey(key, descriptor.depthCompareOp);
+
+  AppendKey(key, descriptor.colorFormats.size());
+  for (auto format : descriptor.colorFormats) {
+    AppendKey(key, format);
+  }
+  AppendKey(key, descriptor.depthFormat);
+
+  return key;
+}
+
+template <typename T>
+std::shared_ptr<T> VulkanDevice::FindCached(ObjectCache<T> &cache,
+                                            uint64_t hash,
+                                            const CacheKey &key) {
+  auto it = cache.find(hash);
+  if (it == cache.end()) {
+    return nullptr;
+  }
+  for (const auto &entry : it->second) {
+    if (entry.key == key) {
+      return entry.object.lock();
+    }
   }
+  return nullptr;
+}
+
+template <typename T>
+void VulkanDevice::InsertCached(ObjectCache<T> &cache, uint64_t hash,
+                                CacheKey key,
+                                const std::shared_ptr<T> &object) {
+  auto &bucket = cache[hash];
+  for (auto &entry : bucket) {
+    if (entry.key == key || entry.object.expired()) {
+      entry.key = std::move(key);
+      entry.object = object;
+      return;
+    }
+  }
+  bucket.push_back({std::move(key), object});
 }
 
 // void VulkanDevice::CreateFramebuffers() {
@@ -522,6 +707,12 @@ void VulkanDevice::CreateCommandPool() {
       throw std::runtime_error("failed to create command pool!");
     }
   }
+
+  poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+  if (vkCreateCommandPool(m_device, &poolInfo, nullptr, &m_uploadCommandPool) !=
+      VK_SUCCESS) {
+    throw std::runtime_error("failed to create upload command pool!");
+  }
 }
 
 void VulkanDevice::CreateSyncObjects() {
@@ -732,21 +923,41 @@ VulkanDevice::CreateAndUploadTextureCube(uint32_t width, uint32_t height, RHIFor
 std::shared_ptr<IRHITexture>
 VulkanDevice::CreateAndUploadTexture(uint32_t width, uint32_t height,
                                      RHIFormat format, const void *data) {
-  uint32_t bytesPerPixel = 4;
-  if (format == RHIFormat::R16G16B16A16_FLOAT) bytesPerPixel = 8;
-  if (format == RHIFormat::R32G32B32A32_FLOAT) bytesPerPixel = 16;
+  RHITextureMipData mip{data, GetFormatImageSize(format, width, height), width,
+                        height};
+  return CreateAndUploadTextureMips(format, std::span(&mip, 1));
+}
 
-  uint64_t imageSize = width * height * bytesPerPixel;
+std::shared_ptr<IRHITexture>
+VulkanDevice::CreateAndUploadTextureMips(RHIFormat format,
+                                         std::span<const RHITextureMipData> mips) {
+  if (mips.empty()) {
+    throw std::runtime_error("Texture upload needs at least one mip level");
+  }
+  const uint32_t width = mips[0].width;
+  const uint32_t height = mips[0].height;
+  const uint32_t mipLevels = static_cast<uint32_t>(mips.size());
+
+  // Copy offsets must be a multiple of the texel block size (and of 4)
+  std::vector<uint64_t> offsets(mips.size());
+  uint64_t stagingSize = 0;
+  for (size_t level = 0; level < mips.size(); ++level) {
+    offsets[level] = stagingSize;
+    stagingSize = (stagingSize + mips[level].size + 15) & ~uint64_t(15);
+  }
 
   // 1. Create Staging Buffer
-  auto stagingBuffer = CreateBuffer(imageSize, RHIBufferUsage::TransferSrc,
+  auto stagingBuffer = CreateBuffer(stagingSize, RHIBufferUsage::TransferSrc,
                                     RHIMemoryProperty::HostVisible |
                                         RHIMemoryProperty::HostCoherent);
 
   // 2. Copy data to Staging Buffer
   void *mappedData = stagingBuffer->Map();
   if (mappedData) {
-    std::memcpy(mappedData, data, imageSize);
+    for (size_t level = 0; level < mips.size(); ++level) {
+      std::memcpy(static_cast<uint8_t *>(mappedData) + offsets[level],
+                  mips[level].data, mips[level].size);
+    }
     stagingBuffer->Unmap();
   } else {
     throw std::runtime_error("Failed to map staging buffer memory");
@@ -755,14 +966,19 @@ VulkanDevice::CreateAndUploadTexture(uint32_t width, uint32_t height,
   // 3. Create Texture Image
   auto texture =
       CreateTexture2D(width, height, format,
-                      RHITextureUsage::TransferDst | RHITextureUsage::Sampled);
+                      RHITextureUsage::TransferDst | RHITextureUsage::Sampled,
+                      mipLevels);
   auto vkTexture = std::static_pointer_cast<VulkanTexture>(texture);
 
-  // 4. Begin Command Buffer
+  // 4. Begin Command Buffer; the upload pool is not reset with the frame
+  // slots, since nothing waits for this copy to finish
+  std::lock_guard<std::mutex> lock(m_uploadMutex);
+  RetireUploads();
+
   VkCommandBufferAllocateInfo allocInfo{};
   allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
   allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-  allocInfo.commandPool = m_commandPools[0];
+  allocInfo.commandPool = m_uploadCommandPool;
   allocInfo.commandBufferCount = 1;
 
   VkCommandBuffer commandBuffer;
@@ -784,7 +1000,7 @@ VulkanDevice::CreateAndUploadTexture(uint32_t width, uint32_t height,
   barrier.image = vkTexture->GetImage();
   barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
   barrier.subresourceRange.baseMipLevel = 0;
-  barrier.subresourceRange.levelCount = 1;
+  barrier.subresourceRange.levelCount = mipLevels;
   barrier.subresourceRange.baseArrayLayer = 0;
   barrier.subresourceRange.layerCount = 1;
   barrier.srcStageMask = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT;
@@ -814,22 +1030,26 @@ VulkanDevice::CreateAndUploadTexture(uint32_t width, uint32_t height,
                          nullptr, 1, &legacyBarrier);
   }
 
-  // 6. Copy Buffer to Image
-  VkBufferImageCopy region{};
-  region.bufferOffset = 0;
-  region.bufferRowLength = 0;
-  region.bufferImageHeight = 0;
-  region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-  region.imageSubresource.mipLevel = 0;
-  region.imageSubresource.baseArrayLayer = 0;
-  region.imageSubresource.layerCount = 1;
-  region.imageOffset = {0, 0, 0};
-  region.imageExtent = {width, height, 1};
+  // 6. Copy Buffer to Image, one region per mip
+  std::vector<VkBufferImageCopy> regions(mips.size());
+  for (size_t level = 0; level < mips.size(); ++level) {
+    VkBufferImageCopy &region = regions[level];
+    region.bufferOffset = offsets[level];
+    region.bufferRowLength = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = static_cast<uint32_t>(level);
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageOffset = {0, 0, 0};
+    region.imageExtent = {mips[level].width, mips[level].height, 1};
+  }
 
   auto vkStaging = std::static_pointer_cast<VulkanBuffer>(stagingBuffer);
   vkCmdCopyBufferToImage(commandBuffer, vkStaging->GetBuffer(),
                          vkTexture->GetImage(),
-                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                         static_cast<uint32_t>(regions.size()), regions.data());
 
   // 7. Transition to ShaderReadOnly using Synchronization 2
   barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
@@ -859,7 +1079,17 @@ VulkanDevice::CreateAndUploadTexture(uint32_t width, uint32_t height,
 
   vkEndCommandBuffer(commandBuffer);
 
-  // 8. Submit
+  // 8. Submit without waiting. Later submissions to this queue are ordered
+  // after the copy by the barrier above, so frames can sample the image at
+  // once; the fence only tells RetireUploads when the staging memory is free.
+  VkFenceCreateInfo fenceInfo{};
+  fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+  VkFence fence = VK_NULL_HANDLE;
+  if (vkCreateFence(m_device, &fenceInfo, nullptr, &fence) != VK_SUCCESS) {
+    vkFreeCommandBuffers(m_device, m_uploadCommandPool, 1, &commandBuffer);
+    throw std::runtime_error("Failed to create texture upload fence");
+  }
+
   auto pfnQueueSubmit2 = (PFN_vkQueueSubmit2)vkGetDeviceProcAddr(m_device, "vkQueueSubmit2");
   if (pfnQueueSubmit2) {
       VkCommandBufferSubmitInfo cmdBufferInfo{};
@@ -871,18 +1101,16 @@ VulkanDevice::CreateAndUploadTexture(uint32_t width, uint32_t height,
       submitInfo2.commandBufferInfoCount = 1;
       submitInfo2.pCommandBufferInfos = &cmdBufferInfo;
 
-      pfnQueueSubmit2(m_graphicsQueue, 1, &submitInfo2, VK_NULL_HANDLE);
+      pfnQueueSubmit2(m_graphicsQueue, 1, &submitInfo2, fence);
   } else {
       VkSubmitInfo submitInfo{};
       submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
       submitInfo.commandBufferCount = 1;
       submitInfo.pCommandBuffers = &commandBuffer;
-      vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
+      vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, fence);
   }
-  
-  vkQueueWaitIdle(m_graphicsQueue);
 
-  vkFreeCommandBuffers(m_device, m_commandPools[0], 1, &commandBuffer);
+  m_pendingUploads.push_back({fence, commandBuffer, stagingBuffer, texture});
 
   return texture;
 }
@@ -901,19 +1129,77 @@ VulkanDevice::CreateShader(RHIShaderStage stage,
 
 std::shared_ptr<IRHIPipeline> VulkanDevice::CreateGraphicsPipeline(
     const RHIPipelineStateDescriptor &descriptor) {
-  return std::make_shared<VulkanPipeline>(this, descriptor);
+  CacheKey state = SerializePipelineState(descriptor);
+  const uint64_t key = HashBytes(state.data(), state.size());
+
+  {
+    std::lock_guard<std::mutex> lock(m_pipelineMutex);
+    if (auto existing = FindCached(m_pipelines, key, state)) {
+      m_pipelineCacheHits++;
+      Logger::Trace("VulkanDevice", "Pipeline cache hit ({:016x})", key);
+      return existing;
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto pipeline = std::make_shared<VulkanPipeline>(this, descriptor);
+  auto end = std::chrono::steady_clock::now();
+  double elapsedMs =
+      std::chrono::duration<double, std::milli>(end - start).count();
+
+  std::lock_guard<std::mutex> lock(m_pipelineMutex);
+  // Another thread may have built the same state meanwhile; keep the first
+  if (auto existing = FindCached(m_pipelines, key, state)) {
+    m_pipelineCacheHits++;
+    return existing;
+  }
+  InsertCached<IRHIPipeline>(m_pipelines, key, std::move(state), pipeline);
+  m_pipelineCacheMisses++;
+  m_pipelineCreateTimeMs += elapsedMs;
+
+  Logger::Debug("VulkanDevice", "Pipeline {:016x} created in {:.2f} ms", key,
+                elapsedMs);
+  return pipeline;
 }
 
 std::shared_ptr<IRHIDescriptorSetLayout>
 VulkanDevice::CreateDescriptorSetLayout(
     const std::vector<RHIDescriptorSetLayoutBinding> &bindings) {
-  return std::make_shared<VulkanDescriptorSetLayout>(this, bindings);
+  CacheKey bindingsKey = VulkanDescriptorSetLayout::SerializeBindings(bindings);
+  const uint64_t key = HashBytes(bindingsKey.data(), bindingsKey.size());
+
+  std::lock_guard<std::mutex> lock(m_descriptorLayoutMutex);
+  if (auto existing = FindCached(m_descriptorLayouts, key, bindingsKey)) {
+    return existing;
+  }
+
+  auto layout = std::make_shared<VulkanDescriptorSetLayout>(this, bindings);
+  InsertCached<IRHIDescriptorSetLayout>(m_descriptorLayouts, key,
+                                        std::move(bindingsKey), layout);
+  return layout;
 }
 
 std::shared_ptr<IRHIDescriptorSet>
 VulkanDevice::AllocateDescriptorSet(IRHIDescriptorSetLayout *layout) {
-  return std::make_shared<VulkanDescriptorSet>(
-      this, static_cast<VulkanDescriptorSetLayout *>(layout), m_descriptorPool);
+  VkDescriptorPool pool = VK_NULL_HANDLE;
+  VkDescriptorSet set = m_descriptorAllocator.Allocate(
+      static_cast<VulkanDescriptorSetLayout *>(layout)->GetVkLayout(), &pool);
+  return std::make_shared<VulkanDescriptorSet>(this, set, pool, false);
+}
+
+std::shared_ptr<IRHIDescriptorSet>
+VulkanDevice::AllocateTransientDescriptorSet(IRHIDescriptorSetLayout *layout) {
+  VkDescriptorPool pool = VK_NULL_HANDLE;
+  VkDescriptorSet set = m_frameDescriptorAllocators[m_currentFrame].Allocate(
+      static_cast<VulkanDescriptorSetLayout *>(layout)->GetVkLayout(), &pool);
+  return std::make_shared<VulkanDescriptorSet>(this, set, pool, true);
+}
+
+void VulkanDevice::FreeDescriptorSet(VkDescriptorPool pool,
+                                     VkDescriptorSet set) {
+  // The set may still be referenced by in-flight command buffers; it is
+  // released when this frame slot's fence has been waited on again.
+  m_descriptorAllocator.Free(pool, set, m_currentFrame);
 }
 
 std::shared_ptr<IRHICommandList> VulkanDevice::CreateCommandList() {
@@ -993,6 +1279,15 @@ void VulkanDevice::BeginFrame() {
   vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE,
                   UINT64_MAX);
 
+  // GPU is done with this frame slot: recycle its descriptor memory
+  m_frameDescriptorAllocators[m_currentFrame].ResetPools();
+  m_descriptorAllocator.ProcessDeferredFrees(m_currentFrame);
+  m_deferredReleases[m_currentFrame].clear();
+  {
+    std::lock_guard<std::mutex> lock(m_uploadMutex);
+    RetireUploads();
+  }
+
   VkResult result =
       vkAcquireNextImageKHR(m_device, m_swapchain, UINT64_MAX,
                             m_imageAvailableSemaphores[m_currentFrame],
@@ -1045,7 +1340,43 @@ IRHITexture *VulkanDevice::GetCurrentBackBuffer() {
   return m_swapchainTextures[m_imageIndex].get();
 }
 
-void VulkanDevice::WaitIdle() { vkDeviceWaitIdle(m_device); }
+void VulkanDevice::WaitIdle() {
+  vkDeviceWaitIdle(m_device);
+
+  // Nothing is in flight any more
+  for (auto &releases : m_deferredReleases)
+    releases.clear();
+  std::lock_guard<std::mutex> lock(m_uploadMutex);
+  RetireUploads();
+}
+
+void VulkanDevice::ReleaseDeferred(std::shared_ptr<IRHIResource> resource) {
+  // Same rule as FreeDescriptorSet: dropped when this slot's fence is waited on again
+  m_deferredReleases[m_currentFrame].push_back(std::move(resource));
+}
+
+void VulkanDevice::RetireUploads() {
+  auto finished = [this](PendingUpload &upload) {
+    if (vkGetFenceStatus(m_device, upload.fence) != VK_SUCCESS)
+      return false;
+    vkDestroyFence(m_device, upload.fence, nullptr);
+    vkFreeCommandBuffers(m_device, m_uploadCommandPool, 1, &upload.commandBuffer);
+    return true;
+  };
+  m_pendingUploads.erase(std::remove_if(m_pendingUploads.begin(),
+                                        m_pendingUploads.end(), finished),
+                         m_pendingUploads.end());
+}
+
+bool VulkanDevice::SupportsSampledFormat(RHIFormat format) const {
+  VkFormat vkFormat = GetVkFormat(format);
+  if (vkFormat == VK_FORMAT_UNDEFINED) {
+    return false;
+  }
+  VkFormatProperties properties;
+  vkGetPhysicalDeviceFormatProperties(m_physicalDevice, vkFormat, &properties);
+  return (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != 0;
+}
 
 void VulkanDevice::CleanupSwapchain() {
   // for (auto framebuffer : m_swapchainFramebuffers) {
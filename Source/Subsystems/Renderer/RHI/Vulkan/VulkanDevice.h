@@ -2,11 +2,17 @@
 
 #include "../IRHIDevice.h"
 #include "../IRHIDescriptor.h"
+#include "VulkanDescriptorAllocator.h"
+#include "VulkanResources.h"
 #include <vulkan/vulkan.h>
 #include <vk_mem_alloc.h>
+#include <array>
 #include <vector>
 #include <memory>
 #include <optional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace AstralEngine {
 
@@ -24,6 +30,7 @@ public:
     std::shared_ptr<IRHIBuffer> CreateAndUploadBuffer(uint64_t size, RHIBufferUsage usage, const void* data) override;
     std::shared_ptr<IRHITexture> CreateTexture2D(uint32_t width, uint32_t height, RHIFormat format, RHITextureUsage usage, uint32_t mipLevels = 1) override;
     std::shared_ptr<IRHITexture> CreateAndUploadTexture(uint32_t width, uint32_t height, RHIFormat format, const void* data) override;
+    std::shared_ptr<IRHITexture> CreateAndUploadTextureMips(RHIFormat format, std::span<const RHITextureMipData> mips) override;
     std::shared_ptr<IRHITexture> CreateTextureCube(uint32_t width, uint32_t height, RHIFormat format, RHITextureUsage usage, uint32_t mipLevels = 1) override;
     std::shared_ptr<IRHITexture> CreateAndUploadTextureCube(uint32_t width, uint32_t height, RHIFormat format, const std::vector<const void*>& faceData) override;
     std::shared_ptr<IRHISampler> CreateSampler(const RHISamplerDescriptor& descriptor) override;
@@ -36,6 +43,8 @@ public:
     // Descriptor Set Support
     std::shared_ptr<IRHIDescriptorSetLayout> CreateDescriptorSetLayout(const std::vector<RHIDescriptorSetLayoutBinding>& bindings) override;
     std::shared_ptr<IRHIDescriptorSet> AllocateDescriptorSet(IRHIDescriptorSetLayout* layout) override;
+    std::shared_ptr<IRHIDescriptorSet> AllocateTransientDescriptorSet(IRHIDescriptorSetLayout* layout) override;
+    void FreeDescriptorSet(VkDescriptorPool pool, VkDescriptorSet set);
 
     void BeginFrame() override;
     void Present() override;
@@ -43,6 +52,8 @@ public:
     IRHITexture* GetDepthBuffer() override;
     uint32_t GetCurrentFrameIndex() const override { return m_currentFrame; }
     void WaitIdle() override;
+    void ReleaseDeferred(std::shared_ptr<IRHIResource> resource) override;
+    bool SupportsSampledFormat(RHIFormat format) const override;
 
     // Getters for internal use
     VkDevice GetVkDevice() const { return m_device; }
@@ -59,6 +70,7 @@ public:
     // VkFramebuffer GetFramebuffer(uint32_t index) const { return m_swapchainFramebuffers[index]; } // Removed
     
     VkFormat GetSwapchainImageFormat() const { return m_swapchainImageFormat; }
+    VkPipelineCache GetPipelineCache() const { return m_pipelineCache; }
     VkFormat GetDepthFormat() const { return const_cast<VulkanDevice*>(this)->FindDepthFormat(); } // TODO: Make FindDepthFormat const
 
 
@@ -74,10 +86,15 @@ private:
     // void CreateRenderPass(); // Removed for Dynamic Rendering
     void CreateDepthResources();
     VkFormat FindDepthFormat();
-    void CreateDescriptorPool();
+    void CreateDescriptorAllocators();
+    void CreatePipelineCache();
+    void SavePipelineCache();
+    CacheKey SerializePipelineState(const RHIPipelineStateDescriptor& descriptor) const;
     // void CreateFramebuffers(); // Removed for Dynamic Rendering
     void CreateCommandPool();
     void CreateSyncObjects();
+    // Frees finished texture uploads; never blocks
+    void RetireUploads();
     void CleanupSwapchain();
     void RecreateSwapchain();
 
@@ -106,9 +123,36 @@ private:
     std::shared_ptr<IRHITexture> m_depthTexture;
 
     // VkRenderPass m_renderPass = VK_NULL_HANDLE; // Removed for Dynamic Rendering
-    VkDescriptorPool m_descriptorPool = VK_NULL_HANDLE;
+    // Descriptor set layouts are shared between identical binding lists
+    // Buckets are keyed by the hash of the full key, which each entry keeps to
+    // compare on a hit
+    template <typename T>
+    struct CachedObject {
+        CacheKey key;
+        std::weak_ptr<T> object;
+    };
+    template <typename T>
+    using ObjectCache = std::unordered_map<uint64_t, std::vector<CachedObject<T>>>;
+    // Live object cached under key, or null
+    template <typename T>
+    static std::shared_ptr<T> FindCached(ObjectCache<T>& cache, uint64_t hash, const CacheKey& key);
+    // Reuses an expired entry of the bucket if there is one
+    template <typename T>
+    static void InsertCached(ObjectCache<T>& cache, uint64_t hash, CacheKey key, const std::shared_ptr<T>& object);
+
+    std::mutex m_descriptorLayoutMutex;
+    ObjectCache<IRHIDescriptorSetLayout> m_descriptorLayouts;
     // std::vector<VkFramebuffer> m_swapchainFramebuffers; // Removed for Dynamic Rendering
 
+    // Pipeline cache: driver blob persisted to disk + dedup of identical state
+    VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+    std::string m_pipelineCachePath;
+    std::mutex m_pipelineMutex;
+    ObjectCache<IRHIPipeline> m_pipelines;
+    uint32_t m_pipelineCacheHits = 0;
+    uint32_t m_pipelineCacheMisses = 0;
+    double m_pipelineCreateTimeMs = 0.0;
+
     std::vector<VkCommandPool> m_commandPools; // Per-frame command pools
     VmaAllocator m_allocator = VK_NULL_HANDLE;
 
@@ -120,6 +164,25 @@ private:
     uint32_t m_currentFrame = 0;
     uint32_t m_imageIndex = 0;
     bool m_frameValid = false; // Indicates if the current frame successfully acquired an image
+
+    // Descriptor allocation: long-lived sets + per-frame transient pools
+    VulkanDescriptorAllocator m_descriptorAllocator;
+    std::array<VulkanDescriptorAllocator, MAX_FRAMES_IN_FLIGHT> m_frameDescriptorAllocators;
+
+    // Resources handed to ReleaseDeferred, by the frame slot they were released in
+    std::array<std::vector<std::shared_ptr<IRHIResource>>, MAX_FRAMES_IN_FLIGHT> m_deferredReleases;
+
+    // Texture uploads run without a CPU wait; each keeps its command buffer,
+    // staging buffer and image until its fence signals
+    struct PendingUpload {
+        VkFence fence = VK_NULL_HANDLE;
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        std::shared_ptr<IRHIBuffer> stagingBuffer;
+        std::shared_ptr<IRHITexture> texture;
+    };
+    VkCommandPool m_uploadCommandPool = VK_NULL_HANDLE; // Not reset with a frame slot
+    std::vector<PendingUpload> m_pendingUploads;
+    std::mutex m_uploadMutex; // Guards the upload pool and list
 };
 
 } // namespace AstralEngine
@@ -5,6 +5,17 @@
 
 namespace AstralEngine {
 
+// FNV-1a over raw bytes, used for pipeline/layout cache keys
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
 // Helper to convert RHIFormat to VkFormat
 VkFormat GetVkFormat(RHIFormat format) {
     switch (format) {
@@ -15,6 +26,8 @@ VkFormat GetVkFormat(RHIFormat format) {
         case RHIFormat::B8G8R8A8_UNORM: return VK_FORMAT_B8G8R8A8_UNORM;
         case RHIFormat::B8G8R8A8_SRGB: return VK_FORMAT_B8G8R8A8_SRGB;
         case RHIFormat::R16G16_FLOAT: return VK_FORMAT_R16G16_SFLOAT;
+        case RHIFormat::R16G16_SNORM: return VK_FORMAT_R16G16_SNORM;
+        case RHIFormat::R16G16B16A16_UNORM: return VK_FORMAT_R16G16B16A16_UNORM;
         case RHIFormat::R16G16B16A16_FLOAT: return VK_FORMAT_R16G16B16A16_SFLOAT;
         case RHIFormat::R32_FLOAT: return VK_FORMAT_R32_SFLOAT;
         case RHIFormat::R32G32_FLOAT: return VK_FORMAT_R32G32_SFLOAT;
@@ -23,6 +36,14 @@ VkFormat GetVkFormat(RHIFormat format) {
         case RHIFormat::D32_FLOAT: return VK_FORMAT_D32_SFLOAT;
         case RHIFormat::D24_UNORM_S8_UINT: return VK_FORMAT_D24_UNORM_S8_UINT;
         case RHIFormat::D32_FLOAT_S8_UINT: return VK_FORMAT_D32_SFLOAT_S8_UINT;
+        case RHIFormat::BC1_RGBA_UNORM: return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case RHIFormat::BC1_RGBA_SRGB: return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+        case RHIFormat::BC3_UNORM: return VK_FORMAT_BC3_UNORM_BLOCK;
+        case RHIFormat::BC3_SRGB: return VK_FORMAT_BC3_SRGB_BLOCK;
+        case RHIFormat::BC5_UNORM: return VK_FORMAT_BC5_UNORM_BLOCK;
+        case RHIFormat::BC6H_UFLOAT: return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+        case RHIFormat::BC7_UNORM: return VK_FORMAT_BC7_UNORM_BLOCK;
+        case RHIFormat::BC7_SRGB: return VK_FORMAT_BC7_SRGB_BLOCK;
         default: return VK_FORMAT_UNDEFINED;
     }
 }
@@ -246,6 +267,9 @@ VulkanShader::VulkanShader(VulkanDevice* device, RHIShaderStage stage, const std
     if (vkCreateShaderModule(device->GetVkDevice(), &createInfo, nullptr, &m_module) != VK_SUCCESS) {
         throw std::runtime_error("failed to create shader module!");
     }
+
+    m_code = code;
+    m_codeHash = HashBytes(code.data(), code.size());
     
     // std::cout << "VulkanShader created: " << (int)stage << " size: " << code.size() << std::endl;
 }
@@ -259,6 +283,9 @@ VulkanShader::~VulkanShader() {
 VulkanDescriptorSetLayout::VulkanDescriptorSetLayout(VulkanDevice* device, const std::vector<RHIDescriptorSetLayoutBinding>& bindings)
     : m_device(device) {
     
+    m_bindingsKey = SerializeBindings(bindings);
+    m_bindingsHash = HashBytes(m_bindingsKey.data(), m_bindingsKey.size());
+
     std::vector<VkDescriptorSetLayoutBinding> vkBindings;
     for (const auto& binding : bindings) {
         VkDescriptorSetLayoutBinding vkBinding{};
@@ -280,65 +307,102 @@ VulkanDescriptorSetLayout::VulkanDescriptorSetLayout(VulkanDevice* device, const
     }
 }
 
+CacheKey VulkanDescriptorSetLayout::SerializeBindings(const std::vector<RHIDescriptorSetLayoutBinding>& bindings) {
+    CacheKey key;
+    AppendKey(key, bindings.size());
+    for (const auto& binding : bindings) {
+        AppendKey(key, binding.binding);
+        AppendKey(key, binding.descriptorType);
+        AppendKey(key, binding.descriptorCount);
+        AppendKey(key, binding.stageFlags);
+    }
+    return key;
+}
+
 VulkanDescriptorSetLayout::~VulkanDescriptorSetLayout() {
     vkDestroyDescriptorSetLayout(m_device->GetVkDevice(), m_layout, nullptr);
 }
 
 // --- VulkanDescriptorSet ---
 
-VulkanDescriptorSet::VulkanDescriptorSet(VulkanDevice* device, VulkanDescriptorSetLayout* layout, VkDescriptorPool pool)
-    : m_device(device), m_pool(pool) {
-    
-    VkDescriptorSetAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-    allocInfo.descriptorPool = pool;
-    allocInfo.descriptorSetCount = 1;
-    VkDescriptorSetLayout vkLayout = layout->GetVkLayout();
-    allocInfo.pSetLayouts = &vkLayout;
+VulkanDescriptorSet::VulkanDescriptorSet(VulkanDevice* device, VkDescriptorSet set, VkDescriptorPool pool, bool transient)
+    : m_device(device), m_set(set), m_pool(pool), m_transient(transient) {
+}
 
-    if (vkAllocateDescriptorSets(device->GetVkDevice(), &allocInfo, &m_set) != VK_SUCCESS) {
-        throw std::runtime_error("failed to allocate descriptor set!");
+VulkanDescriptorSet::~VulkanDescriptorSet() {
+    if (!m_transient) {
+        m_device->FreeDescriptorSet(m_pool, m_set);
     }
 }
 
-VulkanDescriptorSet::~VulkanDescriptorSet() {
-    // vkFreeDescriptorSets(m_device->GetVkDevice(), m_pool, 1, &m_set);
+VulkanDescriptorSet::PendingWrite& VulkanDescriptorSet::FindOrAddWrite(uint32_t binding, VkDescriptorType type) {
+    // A binding written twice before commit keeps only the last value
+    for (auto& write : m_pendingWrites) {
+        if (write.binding == binding && write.type == type) {
+            return write;
+        }
+    }
+
+    PendingWrite write{};
+    write.binding = binding;
+    write.type = type;
+    if (type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER) {
+        write.infoIndex = m_bufferInfos.size();
+        m_bufferInfos.emplace_back();
+    } else {
+        write.infoIndex = m_imageInfos.size();
+        m_imageInfos.emplace_back();
+    }
+    m_pendingWrites.push_back(write);
+    return m_pendingWrites.back();
 }
 
 void VulkanDescriptorSet::UpdateUniformBuffer(uint32_t binding, IRHIBuffer* buffer, uint64_t offset, uint64_t range) {
-    VkDescriptorBufferInfo bufferInfo{};
+    auto& write = FindOrAddWrite(binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+
+    VkDescriptorBufferInfo& bufferInfo = m_bufferInfos[write.infoIndex];
     bufferInfo.buffer = static_cast<VulkanBuffer*>(buffer)->GetBuffer();
     bufferInfo.offset = offset;
     bufferInfo.range = range;
-
-    VkWriteDescriptorSet descriptorWrite{};
-    descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    descriptorWrite.dstSet = m_set;
-    descriptorWrite.dstBinding = binding;
-    descriptorWrite.dstArrayElement = 0;
-    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    descriptorWrite.descriptorCount = 1;
-    descriptorWrite.pBufferInfo = &bufferInfo;
-
-    vkUpdateDescriptorSets(m_device->GetVkDevice(), 1, &descriptorWrite, 0, nullptr);
 }
 
 void VulkanDescriptorSet::UpdateCombinedImageSampler(uint32_t binding, IRHITexture* texture, IRHISampler* sampler) {
-    VkDescriptorImageInfo imageInfo{};
+    auto& write = FindOrAddWrite(binding, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+
+    VkDescriptorImageInfo& imageInfo = m_imageInfos[write.infoIndex];
     imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
     imageInfo.imageView = static_cast<VulkanTexture*>(texture)->GetImageView();
     imageInfo.sampler = static_cast<VulkanSampler*>(sampler)->GetVkSampler();
+}
+
+void VulkanDescriptorSet::CommitUpdates() {
+    if (m_pendingWrites.empty()) return;
+
+    std::vector<VkWriteDescriptorSet> descriptorWrites;
+    descriptorWrites.reserve(m_pendingWrites.size());
+
+    for (const auto& pending : m_pendingWrites) {
+        VkWriteDescriptorSet descriptorWrite{};
+        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrite.dstSet = m_set;
+        descriptorWrite.dstBinding = pending.binding;
+        descriptorWrite.dstArrayElement = 0;
+        descriptorWrite.descriptorType = pending.type;
+        descriptorWrite.descriptorCount = 1;
+        if (pending.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER) {
+            descriptorWrite.pBufferInfo = &m_bufferInfos[pending.infoIndex];
+        } else {
+            descriptorWrite.pImageInfo = &m_imageInfos[pending.infoIndex];
+        }
+        descriptorWrites.push_back(descriptorWrite);
+    }
 
-    VkWriteDescriptorSet descriptorWrite{};
-    descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    descriptorWrite.dstSet = m_set;
-    descriptorWrite.dstBinding = binding;
-    descriptorWrite.dstArrayElement = 0;
-    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    descriptorWrite.descriptorCount = 1;
-    descriptorWrite.pImageInfo = &imageInfo;
+    vkUpdateDescriptorSets(m_device->GetVkDevice(), static_cast<uint32_t>(descriptorWrites.size()),
+                           descriptorWrites.data(), 0, nullptr);
 
-    vkUpdateDescriptorSets(m_device->GetVkDevice(), 1, &descriptorWrite, 0, nullptr);
+    m_pendingWrites.clear();
+    m_bufferInfos.clear();
+    m_imageInfos.clear();
 }
 
 // --- VulkanSampler ---
@@ -379,7 +443,7 @@ VulkanSampler::VulkanSampler(VulkanDevice* device, const RHISamplerDescriptor& d
     samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
     samplerInfo.mipLodBias = 0.0f;
     samplerInfo.minLod = 0.0f;
-    samplerInfo.maxLod = 0.0f;
+    samplerInfo.maxLod = descriptor.maxLod;
 
     if (vkCreateSampler(device->GetVkDevice(), &samplerInfo, nullptr, &m_sampler) != VK_SUCCESS) {
         throw std::runtime_error("failed to create texture sampler!");
@@ -402,14 +466,17 @@ VulkanPipeline::VulkanPipeline(VulkanDevice* device, const RHIPipelineStateDescr
     vertShaderStageInfo.module = static_cast<VulkanShader*>(descriptor.vertexShader)->GetModule();
     vertShaderStageInfo.pName = "main"; // Entry point fixed to main for now, or use specialization
 
-    // Fragment Shader
-    VkPipelineShaderStageCreateInfo fragShaderStageInfo{};
-    fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    fragShaderStageInfo.module = static_cast<VulkanShader*>(descriptor.fragmentShader)->GetModule();
-    fragShaderStageInfo.pName = "main";
+    std::vector<VkPipelineShaderStageCreateInfo> shaderStages = {vertShaderStageInfo};
 
-    std::vector<VkPipelineShaderStageCreateInfo> shaderStages = {vertShaderStageInfo, fragShaderStageInfo};
+    // Fragment Shader (optional, depth-only pipelines have none)
+    if (descriptor.fragmentShader) {
+        VkPipelineShaderStageCreateInfo fragShaderStageInfo{};
+        fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        fragShaderStageInfo.module = static_cast<VulkanShader*>(descriptor.fragmentShader)->GetModule();
+        fragShaderStageInfo.pName = "main";
+        shaderStages.push_back(fragShaderStageInfo);
+    }
 
     // Vertex Input
     VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
@@ -601,7 +668,7 @@ VulkanPipeline::VulkanPipeline(VulkanDevice* device, const RHIPipelineStateDescr
 
     VkGraphicsPipelineCreateInfo pipelineInfo{};
     pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipelineInfo.stageCount = 2;
+    pipelineInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
     pipelineInfo.pStages = shaderStages.data();
     pipelineInfo.pVertexInputState = &vertexInputInfo;
     pipelineInfo.pInputAssemblyState = &inputAssembly;
@@ -633,7 +700,7 @@ VulkanPipeline::VulkanPipeline(VulkanDevice* device, const RHIPipelineStateDescr
     
     pipelineInfo.pNext = &renderingInfo;
 
-    if (vkCreateGraphicsPipelines(device->GetVkDevice(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_pipeline) != VK_SUCCESS) {
+    if (vkCreateGraphicsPipelines(device->GetVkDevice(), device->GetPipelineCache(), 1, &pipelineInfo, nullptr, &m_pipeline) != VK_SUCCESS) {
         throw std::runtime_error("failed to create graphics pipeline!");
     }
 }
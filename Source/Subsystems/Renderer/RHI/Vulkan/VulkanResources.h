@@ -7,11 +7,30 @@
 #include <vk_mem_alloc.h>
 #include <vector>
 #include <map>
+#include <type_traits>
 
 namespace AstralEngine {
 
 class VulkanDevice;
 
+// FNV-1a hash over raw bytes; pass a previous result as seed to chain
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 14695981039346656037ull);
+
+// Canonical bytes of a cache key. Caches index by HashBytes of the key and
+// compare the bytes on a hit, so a hash collision never returns the wrong object.
+using CacheKey = std::vector<uint8_t>;
+inline void AppendKeyBytes(CacheKey& key, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    key.insert(key.end(), bytes, bytes + size);
+}
+template <typename T>
+void AppendKey(CacheKey& key, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    AppendKeyBytes(key, &value, sizeof(value));
+}
+
+VkFormat GetVkFormat(RHIFormat format);
+
 class VulkanBuffer : public IRHIBuffer {
 public:
     VulkanBuffer(VulkanDevice* device, uint64_t size, RHIBufferUsage usage, RHIMemoryProperty memoryProperties);
@@ -77,11 +96,17 @@ public:
 
     RHIShaderStage GetStage() const override { return m_stage; }
     VkShaderModule GetModule() const { return m_module; }
+    // Content hash of the SPIR-V, used as part of the pipeline cache key
+    uint64_t GetCodeHash() const { return m_codeHash; }
+    // Kept so pipeline cache hits can compare the code, not just its hash
+    const std::vector<uint8_t>& GetCode() const { return m_code; }
 
 private:
     VulkanDevice* m_device;
     RHIShaderStage m_stage;
     VkShaderModule m_module = VK_NULL_HANDLE;
+    std::vector<uint8_t> m_code;
+    uint64_t m_codeHash = 0;
 };
 
 class VulkanDescriptorSetLayout : public IRHIDescriptorSetLayout {
@@ -90,26 +115,49 @@ public:
     ~VulkanDescriptorSetLayout() override;
 
     VkDescriptorSetLayout GetVkLayout() const { return m_layout; }
+    static CacheKey SerializeBindings(const std::vector<RHIDescriptorSetLayoutBinding>& bindings);
+    // Identically defined layouts are compatible, so pipelines are keyed on this
+    const CacheKey& GetBindingsKey() const { return m_bindingsKey; }
+    uint64_t GetBindingsHash() const { return m_bindingsHash; }
 
 private:
     VulkanDevice* m_device;
     VkDescriptorSetLayout m_layout = VK_NULL_HANDLE;
+    CacheKey m_bindingsKey;
+    uint64_t m_bindingsHash = 0;
 };
 
 class VulkanDescriptorSet : public IRHIDescriptorSet {
 public:
-    VulkanDescriptorSet(VulkanDevice* device, VulkanDescriptorSetLayout* layout, VkDescriptorPool pool);
+    // The set is allocated by the device's descriptor allocator; transient sets are never freed individually
+    VulkanDescriptorSet(VulkanDevice* device, VkDescriptorSet set, VkDescriptorPool pool, bool transient);
     ~VulkanDescriptorSet() override;
 
     void UpdateUniformBuffer(uint32_t binding, IRHIBuffer* buffer, uint64_t offset, uint64_t range) override;
     void UpdateCombinedImageSampler(uint32_t binding, IRHITexture* texture, IRHISampler* sampler) override;
+    void CommitUpdates() override;
 
+    bool HasPendingUpdates() const { return !m_pendingWrites.empty(); }
     VkDescriptorSet GetVkDescriptorSet() const { return m_set; }
 
 private:
+    // Info structs live in separate arrays; pointers are patched at commit time
+    struct PendingWrite {
+        uint32_t binding;
+        VkDescriptorType type;
+        size_t infoIndex;
+    };
+
+    PendingWrite& FindOrAddWrite(uint32_t binding, VkDescriptorType type);
+
     VulkanDevice* m_device;
     VkDescriptorSet m_set = VK_NULL_HANDLE;
     VkDescriptorPool m_pool;
+    bool m_transient = false;
+
+    std::vector<PendingWrite> m_pendingWrites;
+    std::vector<VkDescriptorBufferInfo> m_bufferInfos;
+    std::vector<VkDescriptorImageInfo> m_imageInfos;
 };
 
 class VulkanSampler : public IRHISampler {
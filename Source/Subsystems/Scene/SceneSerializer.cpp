@@ -57,7 +57,16 @@ void SceneSerializer::Serialize(const std::string &filepath) {
       entityJson["Render"] = {{"MaterialID", rc.materialHandle.GetID()},
                               {"ModelID", rc.modelHandle.GetID()},
                               {"Visible", rc.visible},
-                              {"CastsShadows", rc.castsShadows}};
+                              {"CastsShadows", rc.castsShadows},
+                              {"LodBias", rc.lodBias},
+                              {"ForcedLod", rc.forcedLod}};
+      if (!rc.materialSlots.empty()) {
+        auto slots = json::array();
+        for (const auto &slot : rc.materialSlots) {
+          slots.push_back(slot.GetID());
+        }
+        entityJson["Render"]["MaterialSlots"] = slots;
+      }
     }
 
     // 5. Light Component
@@ -142,12 +151,18 @@ bool SceneSerializer::Deserialize(const std::string &filepath) {
     if (entityJson.contains("Render")) {
       auto &rc = entity.AddComponent<RenderComponent>();
       auto &r = entityJson["Render"];
-      rc.materialHandle = AssetHandle(r["MaterialID"].get<uint64_t>(),
-                                      AssetHandle::Type::Material);
-      rc.modelHandle =
-          AssetHandle(r["ModelID"].get<uint64_t>(), AssetHandle::Type::Model);
+      // IDs are stable and carry the asset type, so they resolve as saved
+      rc.materialHandle = AssetHandle(r["MaterialID"].get<uint64_t>());
+      rc.modelHandle = AssetHandle(r["ModelID"].get<uint64_t>());
       rc.visible = r.value("Visible", true);
       rc.castsShadows = r.value("CastsShadows", true);
+      rc.lodBias = r.value("LodBias", 1.0f);
+      rc.forcedLod = r.value("ForcedLod", -1);
+      if (r.contains("MaterialSlots")) {
+        for (const auto &slot : r["MaterialSlots"]) {
+          rc.materialSlots.emplace_back(slot.get<uint64_t>());
+        }
+      }
     }
 
     if (entityJson.contains("Light")) {
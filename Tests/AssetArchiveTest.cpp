@@ -0,0 +1,180 @@
+#include <catch2/catch_test_macros.hpp>
+#include "Subsystems/Asset/AssetArchive.h"
+#include "Core/MappedFile.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace AstralEngine;
+
+namespace {
+
+std::string GetTestPath(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() / "AstralTests";
+    std::filesystem::create_directories(path);
+    return (path / name).string();
+}
+
+std::vector<uint8_t> ReadBytes(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), {});
+}
+
+void WriteBytes(const std::string& path, const std::vector<uint8_t>& bytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+// Two entries stored as is; returns the archive's path
+std::string WriteArchive(const std::string& name, ArchiveCompression compression = ArchiveCompression::None) {
+    std::string path = GetTestPath(name);
+    std::vector<uint8_t> large(4096, 'a');
+    std::vector<uint8_t> small = { 1, 2, 3, 4, 5 };
+
+    AssetArchiveWriter writer(path, compression);
+    REQUIRE(writer.IsOpen());
+    REQUIRE(writer.Add("Textures/Large.bin", large.data(), large.size(), { 1, 2, 3 }));
+    REQUIRE(writer.Add("Models/small.bin", small.data(), small.size(), {}));
+    REQUIRE(writer.Finish());
+    return path;
+}
+
+// Rewrites the first entry of a valid archive and tries to open the result
+bool OpenWithPatchedEntry(const std::string& source, void (*patch)(AssetArchive::Entry&)) {
+    auto bytes = ReadBytes(source);
+    uint64_t entryTableOffset = 0;
+    std::memcpy(&entryTableOffset, bytes.data() + 16, sizeof(entryTableOffset));
+
+    AssetArchive::Entry entry;
+    std::memcpy(&entry, bytes.data() + entryTableOffset, sizeof(entry));
+    patch(entry);
+    std::memcpy(bytes.data() + entryTableOffset, &entry, sizeof(entry));
+
+    std::string path = GetTestPath("patched.apak");
+    WriteBytes(path, bytes);
+    return AssetArchive::Open(path) != nullptr;
+}
+
+} // namespace
+
+TEST_CASE("Archive entries round-trip", "[AssetArchive]") {
+    auto archive = AssetArchive::Open(WriteArchive("roundtrip.apak"));
+    REQUIRE(archive);
+    REQUIRE(archive->GetEntryCount() == 2);
+
+    // Lookups use the normalized path
+    REQUIRE(archive->Find("textures/large.bin"));
+    REQUIRE_FALSE(archive->Find("Textures/Large.bin"));
+    REQUIRE_FALSE(archive->Find("missing.bin"));
+    REQUIRE(AssetArchive::NormalizePath("Models/./Sub/../small.BIN") == "models/small.bin");
+
+    const AssetArchive::Entry* entry = archive->Find("textures/large.bin");
+    REQUIRE(entry->assetType == 1);
+    REQUIRE(entry->importerVersion == 2);
+    REQUIRE(entry->settingsHash == 3);
+    REQUIRE(entry->offset % AssetArchive::ENTRY_ALIGNMENT == 0);
+    REQUIRE(archive->GetPath(*entry) == "textures/large.bin");
+
+    auto data = archive->Read(*entry);
+    REQUIRE(data);
+    REQUIRE(data->GetSize() == 4096);
+    REQUIRE(data->GetData()[4095] == 'a');
+
+    auto small = archive->Read(*archive->Find("models/small.bin"));
+    REQUIRE(small);
+    REQUIRE(small->GetSize() == 5);
+    REQUIRE(small->GetData()[4] == 5);
+}
+
+TEST_CASE("Compressed archive entries round-trip", "[AssetArchive]") {
+    for (ArchiveCompression compression : { ArchiveCompression::LZ4, ArchiveCompression::Zstd }) {
+        if (!AssetArchive::IsCompressionSupported(compression)) {
+            continue;
+        }
+        auto archive = AssetArchive::Open(WriteArchive("compressed.apak", compression));
+        REQUIRE(archive);
+
+        const AssetArchive::Entry* entry = archive->Find("textures/large.bin");
+        REQUIRE(entry);
+        REQUIRE(entry->compression == static_cast<uint32_t>(compression));
+        REQUIRE(entry->storedSize < entry->size);
+
+        auto data = archive->Read(*entry);
+        REQUIRE(data);
+        REQUIRE(data->GetSize() == 4096);
+        REQUIRE(data->GetData()[0] == 'a');
+        REQUIRE(data->GetData()[4095] == 'a');
+    }
+}
+
+TEST_CASE("Adding a path twice fails the archive", "[AssetArchive]") {
+    std::vector<uint8_t> data(16, 0);
+    AssetArchiveWriter writer(GetTestPath("duplicate.apak"), ArchiveCompression::None);
+    REQUIRE(writer.Add("a.bin", data.data(), data.size(), {}));
+    REQUIRE(writer.Add("A.bin", data.data(), data.size(), {}));
+    REQUIRE_FALSE(writer.Finish());
+}
+
+TEST_CASE("Archives with a bad header are rejected", "[AssetArchive]") {
+    std::string source = WriteArchive("header_source.apak");
+    auto bytes = ReadBytes(source);
+    std::string path = GetTestPath("bad_header.apak");
+
+    REQUIRE_FALSE(AssetArchive::Open(GetTestPath("does_not_exist.apak")));
+
+    auto badMagic = bytes;
+    badMagic[0] ^= 0xFF;
+    WriteBytes(path, badMagic);
+    REQUIRE_FALSE(AssetArchive::Open(path));
+
+    auto truncated = bytes;
+    truncated.resize(32);
+    WriteBytes(path, truncated);
+    REQUIRE_FALSE(AssetArchive::Open(path));
+
+    // The entry table must lie inside the file
+    auto tableCut = bytes;
+    tableCut.resize(tableCut.size() - 8);
+    uint64_t pathTableOffset = tableCut.size();
+    std::memcpy(tableCut.data() + 24, &pathTableOffset, sizeof(pathTableOffset));
+    WriteBytes(path, tableCut);
+    REQUIRE_FALSE(AssetArchive::Open(path));
+
+    auto hugeTable = bytes;
+    uint64_t entryTableOffset = ~uint64_t(0) - 7;
+    std::memcpy(hugeTable.data() + 16, &entryTableOffset, sizeof(entryTableOffset));
+    WriteBytes(path, hugeTable);
+    REQUIRE_FALSE(AssetArchive::Open(path));
+}
+
+TEST_CASE("Archives with a corrupt entry are rejected", "[AssetArchive]") {
+    std::string source = WriteArchive("entry_source.apak");
+    REQUIRE(OpenWithPatchedEntry(source, [](AssetArchive::Entry&) {}));
+
+    // Importers read stored entries in place and rely on their alignment
+    REQUIRE_FALSE(OpenWithPatchedEntry(source, [](AssetArchive::Entry& entry) { entry.offset += 4; }));
+    REQUIRE_FALSE(OpenWithPatchedEntry(source, [](AssetArchive::Entry& entry) { entry.offset = uint64_t(1) << 40; }));
+    REQUIRE_FALSE(OpenWithPatchedEntry(source, [](AssetArchive::Entry& entry) { entry.storedSize = ~uint64_t(0); }));
+    REQUIRE_FALSE(OpenWithPatchedEntry(source, [](AssetArchive::Entry& entry) { entry.pathOffset = 0xFFFFFFF0u; }));
+    REQUIRE_FALSE(OpenWithPatchedEntry(source, [](AssetArchive::Entry& entry) { entry.compression = 7; }));
+    REQUIRE_FALSE(OpenWithPatchedEntry(source, [](AssetArchive::Entry& entry) {
+        entry.compression = static_cast<uint32_t>(ArchiveCompression::Zstd);
+        entry.size = AssetArchive::MAX_DECOMPRESSED_SIZE + 1;
+    }));
+}
+
+TEST_CASE("Archives using a codec this build lacks are rejected", "[AssetArchive]") {
+    std::string source = WriteArchive("codec_source.apak");
+    if (!AssetArchive::IsCompressionSupported(ArchiveCompression::LZ4)) {
+        REQUIRE_FALSE(OpenWithPatchedEntry(source, [](AssetArchive::Entry& entry) {
+            entry.compression = static_cast<uint32_t>(ArchiveCompression::LZ4);
+        }));
+    }
+    if (!AssetArchive::IsCompressionSupported(ArchiveCompression::Zstd)) {
+        REQUIRE_FALSE(OpenWithPatchedEntry(source, [](AssetArchive::Entry& entry) {
+            entry.compression = static_cast<uint32_t>(ArchiveCompression::Zstd);
+        }));
+    }
+}
@@ -0,0 +1,210 @@
+#include <catch2/catch_test_macros.hpp>
+#include "Subsystems/Asset/AssetLoadScheduler.h"
+#include "Core/ThreadPool.h"
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace AstralEngine;
+
+namespace {
+
+AssetHandle MakeHandle(const std::string& name) {
+    return AssetHandle("Textures/" + name + ".png", AssetHandle::Type::Texture);
+}
+
+// Records the order loads start in
+struct LoadLog {
+    std::mutex mutex;
+    std::vector<std::string> order;
+
+    std::function<void()> Run(const std::string& name) {
+        return [this, name]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(name);
+        };
+    }
+};
+
+size_t QueuedCount(const AssetLoadScheduler& scheduler) {
+    size_t count = 0;
+    for (uint32_t queued : scheduler.GetStats().queued) count += queued;
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("Queued loads start by priority, then in request order", "[AssetLoadScheduler]") {
+    ThreadPool pool(2);
+    AssetLoadScheduler scheduler(&pool);
+    scheduler.SetConcurrency(1, 1);
+
+    // Holds the only CPU slot until everything else is queued
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    REQUIRE(scheduler.Enqueue(MakeHandle("blocker"), AssetLoadPriority::Visible, AssetLoadKind::CPU,
+                              [opened]() { opened.wait(); }, nullptr));
+
+    LoadLog log;
+    REQUIRE(scheduler.Enqueue(MakeHandle("a"), AssetLoadPriority::Prefetch, AssetLoadKind::CPU, log.Run("a"), nullptr));
+    REQUIRE(scheduler.Enqueue(MakeHandle("b"), AssetLoadPriority::Visible, AssetLoadKind::CPU, log.Run("b"), nullptr));
+    REQUIRE(scheduler.Enqueue(MakeHandle("c"), AssetLoadPriority::Nearby, AssetLoadKind::CPU, log.Run("c"), nullptr));
+    REQUIRE(scheduler.Enqueue(MakeHandle("d"), AssetLoadPriority::Visible, AssetLoadKind::CPU, log.Run("d"), nullptr));
+    REQUIRE(QueuedCount(scheduler) == 4);
+
+    gate.set_value();
+    scheduler.WaitForIdle();
+
+    const std::vector<std::string> expected = { "b", "d", "c", "a" };
+    REQUIRE(log.order == expected);
+    REQUIRE(scheduler.GetStats().completed == 5);
+    REQUIRE_FALSE(scheduler.IsPending(MakeHandle("a")));
+}
+
+TEST_CASE("Queued loads can be reprioritized", "[AssetLoadScheduler]") {
+    ThreadPool pool(2);
+    AssetLoadScheduler scheduler(&pool);
+    scheduler.SetConcurrency(1, 1);
+
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    scheduler.Enqueue(MakeHandle("blocker"), AssetLoadPriority::Visible, AssetLoadKind::CPU,
+                      [opened]() { opened.wait(); }, nullptr);
+
+    LoadLog log;
+    scheduler.Enqueue(MakeHandle("a"), AssetLoadPriority::Nearby, AssetLoadKind::CPU, log.Run("a"), nullptr);
+    scheduler.Enqueue(MakeHandle("b"), AssetLoadPriority::Prefetch, AssetLoadKind::CPU, log.Run("b"), nullptr);
+    scheduler.Enqueue(MakeHandle("c"), AssetLoadPriority::Visible, AssetLoadKind::CPU, log.Run("c"), nullptr);
+
+    // Raise never lowers; SetPriority does
+    REQUIRE(scheduler.Raise(MakeHandle("c"), AssetLoadPriority::Prefetch));
+    REQUIRE(scheduler.SetPriority(MakeHandle("c"), AssetLoadPriority::Prefetch));
+    REQUIRE(scheduler.Raise(MakeHandle("b"), AssetLoadPriority::Visible));
+
+    // A repeated request only raises the queued one
+    REQUIRE_FALSE(scheduler.Enqueue(MakeHandle("a"), AssetLoadPriority::Visible, AssetLoadKind::CPU, log.Run("a2"), nullptr));
+
+    REQUIRE_FALSE(scheduler.SetPriority(MakeHandle("missing"), AssetLoadPriority::Visible));
+    // Running loads keep their slot and priority
+    REQUIRE_FALSE(scheduler.SetPriority(MakeHandle("blocker"), AssetLoadPriority::Prefetch));
+
+    gate.set_value();
+    scheduler.WaitForIdle();
+
+    // a and b are both Visible now and keep their request order
+    const std::vector<std::string> expected = { "a", "b", "c" };
+    REQUIRE(log.order == expected);
+}
+
+TEST_CASE("Cancelled loads run their cancel callback instead", "[AssetLoadScheduler]") {
+    ThreadPool pool(2);
+    AssetLoadScheduler scheduler(&pool);
+    scheduler.SetConcurrency(1, 1);
+
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    scheduler.Enqueue(MakeHandle("blocker"), AssetLoadPriority::Visible, AssetLoadKind::CPU,
+                      [opened]() { opened.wait(); }, nullptr);
+
+    std::atomic<int> runs{0};
+    std::atomic<int> cancels{0};
+    scheduler.Enqueue(MakeHandle("a"), AssetLoadPriority::Visible, AssetLoadKind::CPU,
+                      [&]() { ++runs; }, [&]() { ++cancels; });
+    REQUIRE(scheduler.IsPending(MakeHandle("a")));
+
+    REQUIRE(scheduler.Cancel(MakeHandle("a")));
+    REQUIRE_FALSE(scheduler.IsPending(MakeHandle("a")));
+    REQUIRE_FALSE(scheduler.Cancel(MakeHandle("a")));
+    REQUIRE_FALSE(scheduler.Cancel(MakeHandle("blocker")));
+    REQUIRE(cancels == 1);
+
+    gate.set_value();
+    scheduler.WaitForIdle();
+    REQUIRE(runs == 0);
+    REQUIRE(scheduler.GetStats().cancelled == 1);
+}
+
+TEST_CASE("Each kind of load has its own lane", "[AssetLoadScheduler]") {
+    ThreadPool pool(2);
+    AssetLoadScheduler scheduler(&pool);
+    scheduler.SetConcurrency(1, 1);
+
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    scheduler.Enqueue(MakeHandle("decode"), AssetLoadPriority::Visible, AssetLoadKind::CPU,
+                      [opened]() { opened.wait(); }, nullptr);
+
+    // A busy CPU lane must not hold back reads
+    std::promise<void> readDone;
+    scheduler.Enqueue(MakeHandle("read"), AssetLoadPriority::Prefetch, AssetLoadKind::IO,
+                      [&]() { readDone.set_value(); }, nullptr);
+    readDone.get_future().wait();
+
+    gate.set_value();
+    scheduler.WaitForIdle();
+    REQUIRE(scheduler.GetStats().completed == 2);
+}
+
+TEST_CASE("Asynchronous loads hold their slot until they finish", "[AssetLoadScheduler]") {
+    ThreadPool pool(2);
+    AssetLoadScheduler scheduler(&pool);
+    scheduler.SetConcurrency(1, 1);
+
+    std::promise<std::function<void()>> started;
+    REQUIRE(scheduler.EnqueueAsync(MakeHandle("async"), AssetLoadPriority::Visible, AssetLoadKind::IO,
+                                   [&](std::function<void()> finish) { started.set_value(finish); }, nullptr));
+    std::function<void()> finish = started.get_future().get();
+
+    std::atomic<bool> secondRan{false};
+    scheduler.Enqueue(MakeHandle("second"), AssetLoadPriority::Visible, AssetLoadKind::IO,
+                      [&]() { secondRan = true; }, nullptr);
+
+    // run has returned, but the load is still in flight
+    REQUIRE(scheduler.IsPending(MakeHandle("async")));
+    REQUIRE(scheduler.GetStats().running[static_cast<size_t>(AssetLoadKind::IO)] == 1);
+    REQUIRE(QueuedCount(scheduler) == 1);
+    REQUIRE_FALSE(secondRan);
+
+    finish();
+    finish(); // Counted once
+    scheduler.WaitForIdle();
+    REQUIRE(secondRan);
+    REQUIRE(scheduler.GetStats().completed == 2);
+}
+
+TEST_CASE("Shutdown cancels queued loads and refuses new ones", "[AssetLoadScheduler]") {
+    // Without a pool nothing is dispatched, so everything stays queued
+    AssetLoadScheduler scheduler(nullptr);
+    std::atomic<int> cancels{0};
+    scheduler.Enqueue(MakeHandle("a"), AssetLoadPriority::Visible, AssetLoadKind::CPU, nullptr, [&]() { ++cancels; });
+    scheduler.Enqueue(MakeHandle("b"), AssetLoadPriority::Nearby, AssetLoadKind::IO, nullptr, [&]() { ++cancels; });
+
+    auto stats = scheduler.GetStats();
+    REQUIRE(stats.queued[static_cast<size_t>(AssetLoadPriority::Visible)] == 1);
+    REQUIRE(stats.queued[static_cast<size_t>(AssetLoadPriority::Nearby)] == 1);
+
+    scheduler.Shutdown();
+    REQUIRE(cancels == 2);
+    REQUIRE(QueuedCount(scheduler) == 0);
+    REQUIRE_FALSE(scheduler.Enqueue(MakeHandle("c"), AssetLoadPriority::Visible, AssetLoadKind::CPU, nullptr, nullptr));
+    REQUIRE_FALSE(scheduler.IsPending(MakeHandle("c")));
+}
+
+TEST_CASE("Load histograms bucket by powers of two", "[AssetLoadScheduler]") {
+    LoadHistogram histogram;
+    REQUIRE(histogram.Percentile(0.5) == 0.0);
+
+    for (int i = 0; i < 90; ++i) histogram.Record(3.0); // [2, 4)
+    for (int i = 0; i < 10; ++i) histogram.Record(100.0); // [64, 128)
+    histogram.Record(1e12); // Open-ended last bucket
+
+    REQUIRE(histogram.total == 101);
+    REQUIRE(histogram.counts[2] == 90);
+    REQUIRE(histogram.counts[LoadHistogram::BUCKET_COUNT - 1] == 1);
+    REQUIRE(histogram.Percentile(0.5) == 4.0);
+    REQUIRE(histogram.Percentile(0.95) == 128.0);
+    REQUIRE(histogram.Percentile(1.0) == std::ldexp(1.0, LoadHistogram::BUCKET_COUNT - 2));
+}
@@ -0,0 +1,147 @@
+#include <catch2/catch_test_macros.hpp>
+#include "Subsystems/Asset/AssetRegistry.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace AstralEngine;
+
+namespace {
+
+AssetHandle MakeHandle(int index) {
+    return AssetHandle("Textures/" + std::to_string(index) + ".png", AssetHandle::Type::Texture);
+}
+
+} // namespace
+
+TEST_CASE("Assets are registered once", "[AssetRegistry]") {
+    AssetRegistry registry;
+    AssetHandle handle = MakeHandle(0);
+
+    REQUIRE_FALSE(registry.IsAssetRegistered(handle));
+    REQUIRE(registry.GetMetadata(handle) == nullptr);
+    REQUIRE(registry.GetAssetPath(handle).empty());
+
+    REQUIRE(registry.RegisterAsset(handle, "Textures/0.png", AssetHandle::Type::Texture));
+    REQUIRE_FALSE(registry.RegisterAsset(handle, "Textures/0.png", AssetHandle::Type::Texture));
+    REQUIRE_FALSE(registry.RegisterAsset(AssetHandle(), "", AssetHandle::Type::Texture));
+
+    REQUIRE(registry.IsAssetRegistered(handle));
+    REQUIRE(registry.GetTotalAssetCount() == 1);
+    REQUIRE(registry.GetAssetPath(handle) == "Textures/0.png");
+    REQUIRE(registry.GetAssetState(handle) == AssetLoadState::NotLoaded);
+
+    const AssetMetadata* metadata = registry.GetMetadata(handle);
+    REQUIRE(metadata);
+    REQUIRE(metadata->handle == handle);
+    REQUIRE(metadata->type == AssetHandle::Type::Texture);
+}
+
+TEST_CASE("Unregistered assets can be registered again", "[AssetRegistry]") {
+    AssetRegistry registry;
+    AssetHandle handle = MakeHandle(1);
+    registry.RegisterAsset(handle, "Textures/1.png", AssetHandle::Type::Texture);
+    AssetMetadata* original = registry.GetMetadata(handle);
+    registry.SetAssetState(handle, AssetLoadState::Loaded_CPU);
+
+    REQUIRE(registry.UnregisterAsset(handle));
+    REQUIRE_FALSE(registry.UnregisterAsset(handle));
+    REQUIRE_FALSE(registry.IsAssetRegistered(handle));
+    REQUIRE(registry.GetMetadata(handle) == nullptr);
+    REQUIRE(registry.GetTotalAssetCount() == 0);
+    REQUIRE(registry.GetAllAssets().empty());
+
+    // Revived in place, since lock-free readers may still hold the old pointer
+    REQUIRE(registry.RegisterAsset(handle, "Textures/1.png", AssetHandle::Type::Texture));
+    REQUIRE(registry.GetMetadata(handle) == original);
+    REQUIRE(registry.GetAssetState(handle) == AssetLoadState::NotLoaded);
+    REQUIRE(registry.GetTotalAssetCount() == 1);
+    REQUIRE_FALSE(registry.RegisterAsset(handle, "Textures/1.png", AssetHandle::Type::Texture));
+}
+
+TEST_CASE("The index grows past its initial capacity", "[AssetRegistry]") {
+    AssetRegistry registry;
+    const int count = 2000;
+    for (int i = 0; i < count; ++i) {
+        REQUIRE(registry.RegisterAsset(MakeHandle(i), "Textures/" + std::to_string(i) + ".png", AssetHandle::Type::Texture));
+    }
+    REQUIRE(registry.GetTotalAssetCount() == count);
+    for (int i = 0; i < count; ++i) {
+        const AssetMetadata* metadata = registry.GetMetadata(MakeHandle(i));
+        REQUIRE(metadata);
+        REQUIRE(metadata->handle == MakeHandle(i));
+    }
+
+    // Unregistered entries still occupy their slot, so later probes pass over them
+    for (int i = 0; i < count; i += 2) {
+        REQUIRE(registry.UnregisterAsset(MakeHandle(i)));
+    }
+    REQUIRE(registry.GetTotalAssetCount() == count / 2);
+    for (int i = 1; i < count; i += 2) {
+        REQUIRE(registry.IsAssetRegistered(MakeHandle(i)));
+    }
+    REQUIRE(registry.RegisterAsset(MakeHandle(0), "Textures/0.png", AssetHandle::Type::Texture));
+    REQUIRE(registry.GetTotalAssetCount() == count / 2 + 1);
+
+    registry.ClearAll();
+    REQUIRE(registry.GetTotalAssetCount() == 0);
+    REQUIRE(registry.GetMetadata(MakeHandle(1)) == nullptr);
+}
+
+TEST_CASE("Lookups run alongside registration", "[AssetRegistry]") {
+    AssetRegistry registry;
+    const int count = 1000;
+    std::atomic<bool> done{false};
+    std::atomic<bool> mismatch{false};
+
+    // Growth swaps the index under the reader; every entry it finds must be the right one
+    std::thread reader([&]() {
+        while (!done) {
+            for (int i = 0; i < count; ++i) {
+                const AssetMetadata* metadata = registry.GetMetadata(MakeHandle(i));
+                if (metadata && !(metadata->handle == MakeHandle(i))) {
+                    mismatch = true;
+                }
+            }
+        }
+    });
+    for (int i = 0; i < count; ++i) {
+        registry.RegisterAsset(MakeHandle(i), "Textures/" + std::to_string(i) + ".png", AssetHandle::Type::Texture);
+    }
+    done = true;
+    reader.join();
+
+    REQUIRE_FALSE(mismatch);
+    REQUIRE(registry.GetTotalAssetCount() == count);
+}
+
+TEST_CASE("Per-asset state and counters", "[AssetRegistry]") {
+    AssetRegistry registry;
+    AssetHandle handle = MakeHandle(2);
+    registry.RegisterAsset(handle, "Textures/2.png", AssetHandle::Type::Texture);
+
+    REQUIRE(registry.IncrementRefCount(handle) == 1);
+    REQUIRE(registry.IncrementRefCount(handle) == 2);
+    REQUIRE(registry.DecrementRefCount(handle) == 1);
+    REQUIRE(registry.GetUnusedAssets().empty());
+    REQUIRE(registry.DecrementRefCount(handle) == 0);
+
+    REQUIRE(registry.SetMemorySize(handle, 4096));
+    REQUIRE(registry.GetTotalMemoryUsage() == 4096);
+    REQUIRE(registry.GetMemoryUsageByType(AssetHandle::Type::Texture) == 4096);
+    REQUIRE(registry.GetMemoryUsageByType(AssetHandle::Type::Model) == 0);
+
+    REQUIRE(registry.SetAssetState(handle, AssetLoadState::Failed));
+    REQUIRE(registry.SetAssetError(handle, "decode failed"));
+    REQUIRE(registry.GetAssetError(handle) == "decode failed");
+    REQUIRE(registry.GetAssetCountByState(AssetLoadState::Failed) == 1);
+    REQUIRE(registry.GetAssetsByState(AssetLoadState::Failed).size() == 1);
+    REQUIRE(registry.GetAssetsByType(AssetHandle::Type::Texture).size() == 1);
+
+    // Calls for unknown assets fail instead of creating entries
+    AssetHandle unknown = MakeHandle(3);
+    REQUIRE_FALSE(registry.SetAssetState(unknown, AssetLoadState::Loaded));
+    REQUIRE(registry.GetAssetState(unknown) == AssetLoadState::NotLoaded);
+    REQUIRE(registry.GetTotalAssetCount() == 1);
+}
@@ -0,0 +1,276 @@
+#include <catch2/catch_test_macros.hpp>
+#include "Subsystems/Asset/BlockCompressor.h"
+#include "Core/ThreadPool.h"
+#include <glm/gtc/packing.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace AstralEngine;
+
+namespace {
+
+// Reference decoders, written from the format specifications so they share
+// nothing with the encoder
+
+constexpr int WEIGHTS4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+class BitReader {
+public:
+    explicit BitReader(const uint8_t* data) : m_data(data) {}
+
+    uint32_t Read(uint32_t bits) {
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < bits; ++i, ++m_position) {
+            value |= ((m_data[m_position >> 3] >> (m_position & 7)) & 1u) << i;
+        }
+        return value;
+    }
+
+private:
+    const uint8_t* m_data;
+    uint32_t m_position = 0;
+};
+
+void Expand565(uint16_t color, int* rgb) {
+    rgb[0] = ((color >> 11) & 31) * 255 / 31;
+    rgb[1] = ((color >> 5) & 63) * 255 / 63;
+    rgb[2] = (color & 31) * 255 / 31;
+}
+
+// Writes RGB into channels 0-2 of 16 RGBA texels
+void DecodeBC1(const uint8_t* block, uint8_t* rgba) {
+    uint16_t c0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+    uint16_t c1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+    int palette[4][3];
+    Expand565(c0, palette[0]);
+    Expand565(c1, palette[1]);
+    for (int c = 0; c < 3; ++c) {
+        if (c0 > c1) {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        } else {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+    uint32_t bits = block[4] | (block[5] << 8) | (block[6] << 16) | (static_cast<uint32_t>(block[7]) << 24);
+    for (int i = 0; i < 16; ++i) {
+        int index = (bits >> (i * 2)) & 3;
+        for (int c = 0; c < 3; ++c) rgba[i * 4 + c] = static_cast<uint8_t>(palette[index][c]);
+    }
+}
+
+void DecodeBC4(const uint8_t* block, uint8_t* rgba, int channel) {
+    int palette[8] = { block[0], block[1] };
+    for (int p = 2; p < 8; ++p) {
+        palette[p] = block[0] > block[1] ? ((8 - p) * block[0] + (p - 1) * block[1]) / 7
+                   : p < 6 ? ((6 - p) * block[0] + (p - 1) * block[1]) / 5
+                   : (p == 6 ? 0 : 255);
+    }
+    uint64_t bits = 0;
+    for (int b = 0; b < 6; ++b) bits |= static_cast<uint64_t>(block[2 + b]) << (b * 8);
+    for (int i = 0; i < 16; ++i) {
+        rgba[i * 4 + channel] = static_cast<uint8_t>(palette[(bits >> (i * 3)) & 7]);
+    }
+}
+
+// Only mode 6, the one the encoder emits; false for any other mode
+bool DecodeBC7(const uint8_t* block, uint8_t* rgba) {
+    BitReader reader(block);
+    if (reader.Read(7) != (1u << 6)) {
+        return false;
+    }
+    int endpoints[2][4];
+    for (int c = 0; c < 4; ++c) {
+        endpoints[0][c] = static_cast<int>(reader.Read(7));
+        endpoints[1][c] = static_cast<int>(reader.Read(7));
+    }
+    int p0 = static_cast<int>(reader.Read(1));
+    int p1 = static_cast<int>(reader.Read(1));
+    for (int c = 0; c < 4; ++c) {
+        endpoints[0][c] = (endpoints[0][c] << 1) | p0;
+        endpoints[1][c] = (endpoints[1][c] << 1) | p1;
+    }
+    for (int i = 0; i < 16; ++i) {
+        int weight = WEIGHTS4[reader.Read(i == 0 ? 3 : 4)];
+        for (int c = 0; c < 4; ++c) {
+            rgba[i * 4 + c] = static_cast<uint8_t>(((64 - weight) * endpoints[0][c] + weight * endpoints[1][c] + 32) >> 6);
+        }
+    }
+    return true;
+}
+
+// Only mode 11 (unsigned); writes RGB floats
+bool DecodeBC6H(const uint8_t* block, float* rgb) {
+    BitReader reader(block);
+    if (reader.Read(5) != 0x03) {
+        return false;
+    }
+    int endpoints[2][3];
+    for (auto& endpoint : endpoints) {
+        for (int c = 0; c < 3; ++c) {
+            int value = static_cast<int>(reader.Read(10));
+            endpoint[c] = value == 0 ? 0 : value == 1023 ? 0xFFFF : ((value << 16) + 0x8000) >> 10;
+        }
+    }
+    for (int i = 0; i < 16; ++i) {
+        int weight = WEIGHTS4[reader.Read(i == 0 ? 3 : 4)];
+        for (int c = 0; c < 3; ++c) {
+            int interpolated = ((64 - weight) * endpoints[0][c] + weight * endpoints[1][c] + 32) >> 6;
+            rgb[i * 3 + c] = glm::unpackHalf1x16(static_cast<uint16_t>((interpolated * 31) >> 6));
+        }
+    }
+    return true;
+}
+
+// A ramp along one line in RGBA space, which single-partition modes represent
+// well. Every channel spans 150-180 values, so the bounds below are about half
+// a palette step: 4 colors for BC1, 8 values for BC4, 16 for BC7.
+std::vector<uint8_t> MakeGradientBlock() {
+    std::vector<uint8_t> rgba(64);
+    for (int i = 0; i < 16; ++i) {
+        rgba[i * 4 + 0] = static_cast<uint8_t>(40 + i * 12);
+        rgba[i * 4 + 1] = static_cast<uint8_t>(200 - i * 10);
+        rgba[i * 4 + 2] = static_cast<uint8_t>(30 + i * 8);
+        rgba[i * 4 + 3] = static_cast<uint8_t>(255 - i * 12);
+    }
+    return rgba;
+}
+
+int MaxError(const std::vector<uint8_t>& a, const uint8_t* b, int firstChannel, int channelCount) {
+    int error = 0;
+    for (int i = 0; i < 16; ++i) {
+        for (int c = firstChannel; c < firstChannel + channelCount; ++c) {
+            error = std::max(error, std::abs(a[i * 4 + c] - b[i * 4 + c]));
+        }
+    }
+    return error;
+}
+
+} // namespace
+
+TEST_CASE("Compressed sizes round partial blocks up", "[BlockCompressor]") {
+    REQUIRE(BlockCompressor::GetBlockSize(TextureCompression::BC1) == 8);
+    REQUIRE(BlockCompressor::GetBlockSize(TextureCompression::BC7) == 16);
+    REQUIRE(BlockCompressor::GetBlockSize(TextureCompression::None) == 0);
+    REQUIRE(BlockCompressor::GetCompressedSize(TextureCompression::BC1, 4, 4) == 8);
+    REQUIRE(BlockCompressor::GetCompressedSize(TextureCompression::BC7, 130, 66) == 33 * 17 * 16);
+    REQUIRE(BlockCompressor::GetCompressedSize(TextureCompression::BC3, 1, 1) == 16);
+
+    // Must not wrap for dimensions near the 32-bit limit
+    REQUIRE(BlockCompressor::GetCompressedSize(TextureCompression::BC1, 0xFFFFFFFFu, 4) == (uint64_t(1) << 30) * 8);
+}
+
+TEST_CASE("BC1 round-trips within its precision", "[BlockCompressor]") {
+    // A color 5:6:5 represents exactly comes back unchanged
+    std::vector<uint8_t> solid(64);
+    for (int i = 0; i < 16; ++i) {
+        solid[i * 4 + 0] = 255;
+        solid[i * 4 + 1] = 0;
+        solid[i * 4 + 2] = 255;
+        solid[i * 4 + 3] = 255;
+    }
+    uint8_t block[8];
+    uint8_t decoded[64] = {};
+    BlockCompressor::EncodeBC1(solid.data(), block);
+    DecodeBC1(block, decoded);
+    REQUIRE(MaxError(solid, decoded, 0, 3) == 0);
+
+    auto gradient = MakeGradientBlock();
+    BlockCompressor::EncodeBC1(gradient.data(), block);
+    DecodeBC1(block, decoded);
+    REQUIRE(MaxError(gradient, decoded, 0, 3) <= 32);
+
+    // Four-color mode; three-color mode would turn some texels black
+    REQUIRE((block[0] | (block[1] << 8)) > (block[2] | (block[3] << 8)));
+}
+
+TEST_CASE("BC3 and BC5 round-trip within their precision", "[BlockCompressor]") {
+    auto gradient = MakeGradientBlock();
+    uint8_t block[16];
+    uint8_t decoded[64] = {};
+
+    BlockCompressor::EncodeBC3(gradient.data(), block);
+    DecodeBC4(block, decoded, 3);
+    DecodeBC1(block + 8, decoded);
+    REQUIRE(MaxError(gradient, decoded, 3, 1) <= 14);
+    REQUIRE(MaxError(gradient, decoded, 0, 3) <= 32);
+
+    BlockCompressor::EncodeBC5(gradient.data(), block);
+    DecodeBC4(block, decoded, 0);
+    DecodeBC4(block + 8, decoded, 1);
+    REQUIRE(MaxError(gradient, decoded, 0, 2) <= 14);
+}
+
+TEST_CASE("BC7 round-trips within its precision", "[BlockCompressor]") {
+    auto gradient = MakeGradientBlock();
+    uint8_t block[16];
+    uint8_t decoded[64] = {};
+
+    BlockCompressor::EncodeBC7(gradient.data(), block);
+    REQUIRE(DecodeBC7(block, decoded));
+    REQUIRE(MaxError(gradient, decoded, 0, 4) <= 6);
+
+    std::vector<uint8_t> solid(64, 77);
+    BlockCompressor::EncodeBC7(solid.data(), block);
+    REQUIRE(DecodeBC7(block, decoded));
+    REQUIRE(MaxError(solid, decoded, 0, 4) <= 1);
+}
+
+TEST_CASE("BC6H round-trips HDR values", "[BlockCompressor]") {
+    float rgba[64];
+    for (int i = 0; i < 16; ++i) {
+        // Interpolation is on half-float bits, so keep each channel within one exponent
+        rgba[i * 4 + 0] = 2.0f + i * 0.1f;
+        rgba[i * 4 + 1] = 1.0f;
+        rgba[i * 4 + 2] = 1.0f + i * 0.05f;
+        rgba[i * 4 + 3] = 1.0f;
+    }
+    uint8_t block[16];
+    float decoded[48];
+    BlockCompressor::EncodeBC6H(rgba, block);
+    REQUIRE(DecodeBC6H(block, decoded));
+
+    float maxRelativeError = 0.0f;
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            float expected = rgba[i * 4 + c];
+            maxRelativeError = std::max(maxRelativeError, std::abs(decoded[i * 3 + c] - expected) / expected);
+        }
+    }
+    REQUIRE(maxRelativeError < 0.1f);
+
+    // Negative and NaN inputs clamp to zero rather than producing garbage
+    float invalid[64];
+    for (int i = 0; i < 64; ++i) invalid[i] = (i % 2) ? -4.0f : NAN;
+    BlockCompressor::EncodeBC6H(invalid, block);
+    REQUIRE(DecodeBC6H(block, decoded));
+    for (float value : decoded) REQUIRE(value == 0.0f);
+}
+
+TEST_CASE("Images compress the same with and without a pool", "[BlockCompressor]") {
+    // 10x9 leaves partial blocks on both edges
+    const uint32_t width = 10, height = 9;
+    std::vector<uint8_t> pixels(width * height * 4);
+    for (size_t i = 0; i < pixels.size(); ++i) pixels[i] = static_cast<uint8_t>(i * 7);
+
+    size_t size = BlockCompressor::GetCompressedSize(TextureCompression::BC7, width, height);
+    std::vector<uint8_t> serial(size), parallel(size);
+    BlockCompressor::Compress(TextureCompression::BC7, pixels.data(), width, height, serial.data());
+    ThreadPool pool(4);
+    BlockCompressor::Compress(TextureCompression::BC7, pixels.data(), width, height, parallel.data(), &pool);
+    REQUIRE(serial == parallel);
+
+    // The last block repeats the final row and column, matching an explicit copy
+    uint8_t edge[64];
+    for (uint32_t i = 0; i < 16; ++i) {
+        uint32_t x = std::min(8 + (i & 3), width - 1);
+        uint32_t y = std::min(8 + (i >> 2), height - 1);
+        std::copy_n(&pixels[(y * width + x) * 4], 4, &edge[i * 4]);
+    }
+    uint8_t expected[16];
+    BlockCompressor::EncodeBC7(edge, expected);
+    REQUIRE(std::equal(expected, expected + 16, serial.end() - 16));
+}
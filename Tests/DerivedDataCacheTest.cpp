@@ -0,0 +1,156 @@
+#include <catch2/catch_test_macros.hpp>
+#include "Subsystems/Asset/DerivedDataCache.h"
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace AstralEngine;
+
+namespace {
+
+// A fresh, empty directory per test
+std::string MakeTestDirectory(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() / "AstralTests" / name;
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+    return path.string();
+}
+
+void WriteText(const std::string& path, const std::string& text) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << text;
+}
+
+std::string ReadText(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), {});
+}
+
+bool StoreText(DerivedDataCache& cache, uint64_t key, const std::string& text) {
+    return cache.Store(key, [&](const std::string& path) {
+        WriteText(path, text);
+        return true;
+    });
+}
+
+} // namespace
+
+TEST_CASE("Cache keys follow the source contents and importer identity", "[DerivedDataCache]") {
+    std::string directory = MakeTestDirectory("DDC_Keys");
+    std::string source = directory + "/mesh.obj";
+    WriteText(source, "v 0 0 0");
+
+    uint64_t key = DerivedDataCache::ComputeKey({ source }, 1, 3, "{}");
+    REQUIRE(DerivedDataCache::ComputeKey({ source }, 1, 3, "{}") == key);
+
+    REQUIRE(DerivedDataCache::ComputeKey({ source }, 2, 3, "{}") != key);
+    REQUIRE(DerivedDataCache::ComputeKey({ source }, 1, 4, "{}") != key);
+    REQUIRE(DerivedDataCache::ComputeKey({ source }, 1, 3, "{\"lods\":2}") != key);
+
+    WriteText(source, "v 0 0 1");
+    REQUIRE(DerivedDataCache::ComputeKey({ source }, 1, 3, "{}") != key);
+}
+
+TEST_CASE("Creating an import sidecar changes the key", "[DerivedDataCache]") {
+    std::string directory = MakeTestDirectory("DDC_Sidecar");
+    std::string source = directory + "/albedo.png";
+    WriteText(source, "png");
+    std::string sidecar = DerivedDataCache::GetImportSettingsPath(source);
+    REQUIRE(sidecar == source + ".import.json");
+
+    uint64_t withoutSidecar = DerivedDataCache::ComputeKey({ source, sidecar }, 1, 1, "{}");
+    WriteText(sidecar, "{}");
+    REQUIRE(DerivedDataCache::ComputeKey({ source, sidecar }, 1, 1, "{}") != withoutSidecar);
+}
+
+TEST_CASE("Import settings are read from the sidecar", "[DerivedDataCache]") {
+    std::string directory = MakeTestDirectory("DDC_Settings");
+    std::string source = directory + "/albedo.png";
+
+    REQUIRE(DerivedDataCache::ReadImportSettings(source).empty());
+
+    WriteText(DerivedDataCache::GetImportSettingsPath(source), "{ \"compression\": \"BC7\" }");
+    nlohmann::json settings = DerivedDataCache::ReadImportSettings(source);
+    REQUIRE(settings.value("compression", "") == "BC7");
+
+    // Malformed files and non-objects fall back to the defaults
+    WriteText(DerivedDataCache::GetImportSettingsPath(source), "{ \"compression\": ");
+    REQUIRE(DerivedDataCache::ReadImportSettings(source).empty());
+    WriteText(DerivedDataCache::GetImportSettingsPath(source), "[1, 2]");
+    REQUIRE(DerivedDataCache::ReadImportSettings(source).is_object());
+}
+
+TEST_CASE("Stored entries are found until removed", "[DerivedDataCache]") {
+    DerivedDataCache cache;
+    REQUIRE_FALSE(cache.Find(1));
+    REQUIRE_FALSE(StoreText(cache, 1, "disabled"));
+
+    REQUIRE(cache.Initialize(MakeTestDirectory("DDC_Store")));
+    REQUIRE(cache.IsEnabled());
+    REQUIRE_FALSE(cache.Find(1));
+
+    REQUIRE(StoreText(cache, 1, "cooked"));
+    auto path = cache.Find(1);
+    REQUIRE(path);
+    REQUIRE(ReadText(*path) == "cooked");
+
+    // A failed writer leaves no entry behind
+    REQUIRE_FALSE(cache.Store(2, [](const std::string& path) {
+        WriteText(path, "partial");
+        return false;
+    }));
+    REQUIRE_FALSE(cache.Find(2));
+
+    cache.Remove(1);
+    REQUIRE_FALSE(cache.Find(1));
+    REQUIRE_FALSE(std::filesystem::exists(*path));
+
+    auto stats = cache.GetStats();
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.misses == 3);
+    REQUIRE(stats.entryCount == 0);
+    REQUIRE(stats.sizeBytes == 0);
+}
+
+TEST_CASE("Entries survive a restart", "[DerivedDataCache]") {
+    std::string directory = MakeTestDirectory("DDC_Restart");
+    {
+        DerivedDataCache cache;
+        REQUIRE(cache.Initialize(directory));
+        REQUIRE(StoreText(cache, 0xABCDEF, "cooked"));
+    }
+    // Left over from a write that never finished
+    WriteText(directory + "/0000000000abcdef.ddc.1.tmp", "partial");
+
+    DerivedDataCache cache;
+    REQUIRE(cache.Initialize(directory));
+    REQUIRE(cache.GetStats().entryCount == 1);
+    REQUIRE(cache.GetStats().sizeBytes == 6);
+    REQUIRE(cache.Find(0xABCDEF));
+    REQUIRE_FALSE(std::filesystem::exists(directory + "/0000000000abcdef.ddc.1.tmp"));
+}
+
+TEST_CASE("The least recently used entries are evicted first", "[DerivedDataCache]") {
+    DerivedDataCache cache;
+    REQUIRE(cache.Initialize(MakeTestDirectory("DDC_Evict"), 100));
+
+    std::string blob(40, 'x');
+    REQUIRE(StoreText(cache, 1, blob));
+    REQUIRE(StoreText(cache, 2, blob));
+    REQUIRE(cache.Find(1)); // 2 is now the oldest
+
+    REQUIRE(StoreText(cache, 3, blob));
+    REQUIRE(cache.Find(1));
+    REQUIRE_FALSE(cache.Find(2));
+    REQUIRE(cache.Find(3));
+
+    auto stats = cache.GetStats();
+    REQUIRE(stats.evictions == 1);
+    REQUIRE(stats.sizeBytes == 80);
+
+    // Shrinking the limit evicts right away
+    cache.SetMaxSize(40);
+    REQUIRE(cache.GetStats().entryCount == 1);
+    REQUIRE(cache.Find(3));
+}
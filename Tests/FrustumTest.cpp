@@ -0,0 +1,31 @@
+#include <catch2/catch_test_macros.hpp>
+#include "Core/Math/Frustum.h"
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace AstralEngine;
+
+TEST_CASE("Frustum near plane matches the camera projection", "[Frustum]") {
+    // Same projection as Camera and CameraComponent
+    const float nearPlane = 1.0f;
+    const float farPlane = 100.0f;
+    glm::mat4 proj = glm::perspective(glm::radians(60.0f), 1.0f, nearPlane, farPlane);
+    Frustum frustum = Frustum::FromMatrix(proj);
+
+    // The camera looks down -Z
+    REQUIRE(frustum.IntersectsSphere(glm::vec3(0.0f, 0.0f, -1.05f), 0.01f));
+    REQUIRE_FALSE(frustum.IntersectsSphere(glm::vec3(0.0f, 0.0f, -0.9f), 0.01f));
+
+    AABB justPastNear(glm::vec3(-0.01f, -0.01f, -1.06f), glm::vec3(0.01f, 0.01f, -1.04f));
+    REQUIRE(frustum.IntersectsAABB(justPastNear));
+
+    AABB behindNear(glm::vec3(-0.01f, -0.01f, -0.95f), glm::vec3(0.01f, 0.01f, -0.9f));
+    REQUIRE_FALSE(frustum.IntersectsAABB(behindNear));
+}
+
+TEST_CASE("Frustum far plane", "[Frustum]") {
+    glm::mat4 proj = glm::perspective(glm::radians(60.0f), 1.0f, 1.0f, 100.0f);
+    Frustum frustum = Frustum::FromMatrix(proj);
+
+    REQUIRE(frustum.IntersectsSphere(glm::vec3(0.0f, 0.0f, -99.0f), 0.01f));
+    REQUIRE_FALSE(frustum.IntersectsSphere(glm::vec3(0.0f, 0.0f, -101.0f), 0.01f));
+}
@@ -0,0 +1,150 @@
+#include <catch2/catch_test_macros.hpp>
+#include "Subsystems/Asset/MeshCooker.h"
+#include "Subsystems/Asset/MeshOptimizer.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace AstralEngine;
+
+namespace {
+
+std::string GetTestPath(const std::string& name) {
+    auto path = std::filesystem::temp_directory_path() / "AstralTests";
+    std::filesystem::create_directories(path);
+    return (path / name).string();
+}
+
+std::vector<uint8_t> ReadBytes(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), {});
+}
+
+void WriteBytes(const std::string& path, const std::vector<uint8_t>& bytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+// Flat size x size quad grid on the XZ plane
+ModelData MakeGrid(uint32_t size) {
+    ModelData model("grid.obj");
+    model.name = "grid";
+    for (uint32_t z = 0; z <= size; ++z) {
+        for (uint32_t x = 0; x <= size; ++x) {
+            glm::vec3 position(static_cast<float>(x), 0.0f, static_cast<float>(z));
+            model.vertices.emplace_back(position, glm::vec3(0.0f, 1.0f, 0.0f),
+                                        glm::vec2(x / float(size), z / float(size)));
+            model.boundingBox.Extend(position);
+        }
+    }
+    for (uint32_t z = 0; z < size; ++z) {
+        for (uint32_t x = 0; x < size; ++x) {
+            uint32_t i = z * (size + 1) + x;
+            model.indices.insert(model.indices.end(), { i, i + size + 1, i + 1, i + 1, i + size + 1, i + size + 2 });
+        }
+    }
+    model.isValid = true;
+    return model;
+}
+
+std::string WriteCookedGrid(const std::string& name) {
+    ModelData model = MakeGrid(8);
+    MeshOptimizer::Optimize(model);
+    std::string path = GetTestPath(name);
+    REQUIRE(MeshCooker::Write(model, path));
+    return path;
+}
+
+// Loads a copy of a cooked mesh whose header was changed
+bool LoadWithPatchedHeader(const std::string& source, void (*patch)(CookedMeshHeader&)) {
+    auto bytes = ReadBytes(source);
+    CookedMeshHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    patch(header);
+    std::memcpy(bytes.data(), &header, sizeof(header));
+
+    std::string path = GetTestPath("patched.amesh");
+    WriteBytes(path, bytes);
+    return MeshCooker::Load(path) != nullptr;
+}
+
+} // namespace
+
+TEST_CASE("Cooked meshes round-trip", "[MeshCooker]") {
+    ModelData model = MakeGrid(8);
+    MeshOptimizer::Optimize(model);
+    std::string path = GetTestPath("roundtrip.amesh");
+    REQUIRE(MeshCooker::Write(model, path));
+
+    auto loaded = MeshCooker::Load(path);
+    REQUIRE(loaded);
+    REQUIRE(loaded->IsValid());
+    REQUIRE(loaded->name == "roundtrip");
+    REQUIRE(loaded->vertexFormat == VertexFormat::Standard);
+
+    // Loaded data is the mapped file, not a copy
+    REQUIRE(loaded->mappedStorage);
+    REQUIRE(loaded->vertices.empty());
+
+    auto vertices = loaded->GetVertices();
+    auto indices = loaded->GetIndices();
+    REQUIRE(vertices.size() == model.vertices.size());
+    REQUIRE(indices.size() == model.indices.size());
+    REQUIRE(std::memcmp(vertices.data(), model.vertices.data(), vertices.size_bytes()) == 0);
+    REQUIRE(std::memcmp(indices.data(), model.indices.data(), indices.size_bytes()) == 0);
+    REQUIRE(loaded->GetMeshlets().size() == model.meshlets.size());
+    REQUIRE(loaded->GetLodCount() == model.GetLodCount());
+    REQUIRE(loaded->GetSubmeshes().size() == model.submeshes.size());
+    REQUIRE(loaded->boundingBox.min == model.boundingBox.min);
+    REQUIRE(loaded->boundingBox.max == model.boundingBox.max);
+
+    // Blobs are mapped in place, so they keep their alignment
+    REQUIRE(reinterpret_cast<uintptr_t>(vertices.data()) % MeshCooker::BLOB_ALIGNMENT == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(indices.data()) % MeshCooker::BLOB_ALIGNMENT == 0);
+}
+
+TEST_CASE("Empty meshes are not cooked", "[MeshCooker]") {
+    ModelData model("empty.obj");
+    REQUIRE_FALSE(MeshCooker::Write(model, GetTestPath("empty.amesh")));
+}
+
+TEST_CASE("Missing, truncated and foreign files are rejected", "[MeshCooker]") {
+    std::string source = WriteCookedGrid("reject_source.amesh");
+    auto bytes = ReadBytes(source);
+    std::string path = GetTestPath("rejected.amesh");
+
+    REQUIRE_FALSE(MeshCooker::Load(GetTestPath("does_not_exist.amesh")));
+
+    auto headerOnly = bytes;
+    headerOnly.resize(sizeof(CookedMeshHeader) - 1);
+    WriteBytes(path, headerOnly);
+    REQUIRE_FALSE(MeshCooker::Load(path));
+
+    // Header intact, but the blobs it points to are cut off
+    auto truncated = bytes;
+    truncated.resize(bytes.size() - 64);
+    WriteBytes(path, truncated);
+    REQUIRE_FALSE(MeshCooker::Load(path));
+
+    REQUIRE_FALSE(LoadWithPatchedHeader(source, [](CookedMeshHeader& header) { header.magic = 0; }));
+    REQUIRE_FALSE(LoadWithPatchedHeader(source, [](CookedMeshHeader& header) { header.version += 1; }));
+    REQUIRE_FALSE(LoadWithPatchedHeader(source, [](CookedMeshHeader& header) {
+        header.flags |= MeshCooker::FLAG_PACKED_VERTICES;
+    }));
+}
+
+TEST_CASE("Cooked meshes with corrupt tables are rejected", "[MeshCooker]") {
+    std::string source = WriteCookedGrid("corrupt_source.amesh");
+    REQUIRE(LoadWithPatchedHeader(source, [](CookedMeshHeader&) {}));
+
+    REQUIRE_FALSE(LoadWithPatchedHeader(source, [](CookedMeshHeader& header) { header.vertexDataOffset += 4; }));
+    REQUIRE_FALSE(LoadWithPatchedHeader(source, [](CookedMeshHeader& header) { header.indexCount = ~uint64_t(0) / 2; }));
+    REQUIRE_FALSE(LoadWithPatchedHeader(source, [](CookedMeshHeader& header) { header.vertexCount += 1u << 20; }));
+    REQUIRE_FALSE(LoadWithPatchedHeader(source, [](CookedMeshHeader& header) { header.lodCount = MAX_MESH_LODS + 1; }));
+    REQUIRE_FALSE(LoadWithPatchedHeader(source, [](CookedMeshHeader& header) { header.submeshCount = 0xFFFFFFFFu; }));
+
+    // Shrinking the index blob leaves the meshlet and LOD ranges pointing past it
+    REQUIRE_FALSE(LoadWithPatchedHeader(source, [](CookedMeshHeader& header) { header.indexCount = 3; }));
+}
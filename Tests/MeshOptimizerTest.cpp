@@ -0,0 +1,180 @@
+#include <catch2/catch_test_macros.hpp>
+#include "Subsystems/Asset/MeshOptimizer.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace AstralEngine;
+
+namespace {
+
+// Closed UV sphere; rings share vertices, so every edge has two triangles
+ModelData MakeSphere(uint32_t rings, uint32_t segments) {
+    ModelData model("sphere.obj");
+    model.name = "sphere";
+    auto addVertex = [&](float theta, float phi) {
+        glm::vec3 position(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+        model.vertices.emplace_back(position, position);
+        model.boundingBox.Extend(position);
+    };
+
+    addVertex(0.0f, 0.0f); // North pole
+    for (uint32_t ring = 1; ring < rings; ++ring) {
+        for (uint32_t segment = 0; segment < segments; ++segment) {
+            addVertex(3.14159265f * ring / rings, 6.28318531f * segment / segments);
+        }
+    }
+    addVertex(3.14159265f, 0.0f); // South pole
+    const uint32_t south = static_cast<uint32_t>(model.vertices.size() - 1);
+
+    auto ringVertex = [&](uint32_t ring, uint32_t segment) { return 1 + (ring - 1) * segments + segment % segments; };
+    for (uint32_t segment = 0; segment < segments; ++segment) {
+        model.indices.insert(model.indices.end(), { 0, ringVertex(1, segment + 1), ringVertex(1, segment) });
+        model.indices.insert(model.indices.end(), { south, ringVertex(rings - 1, segment), ringVertex(rings - 1, segment + 1) });
+    }
+    for (uint32_t ring = 1; ring + 1 < rings; ++ring) {
+        for (uint32_t segment = 0; segment < segments; ++segment) {
+            uint32_t a = ringVertex(ring, segment), b = ringVertex(ring, segment + 1);
+            uint32_t c = ringVertex(ring + 1, segment), d = ringVertex(ring + 1, segment + 1);
+            model.indices.insert(model.indices.end(), { a, b, c, b, d, c });
+        }
+    }
+    model.isValid = true;
+    return model;
+}
+
+void ShuffleTriangles(std::vector<uint32_t>& indices) {
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (size_t i = 0; i < indices.size(); i += 3) triangles.push_back({ indices[i], indices[i + 1], indices[i + 2] });
+    std::shuffle(triangles.begin(), triangles.end(), std::mt19937(42));
+    for (size_t t = 0; t < triangles.size(); ++t) std::copy(triangles[t].begin(), triangles[t].end(), indices.begin() + t * 3);
+}
+
+// Each triangle rotated to start at its smallest index (winding kept), then sorted
+std::vector<std::array<uint32_t, 3>> CanonicalTriangles(std::span<const uint32_t> indices) {
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        std::array<uint32_t, 3> triangle = { indices[i], indices[i + 1], indices[i + 2] };
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+} // namespace
+
+TEST_CASE("Vertex cache analysis", "[MeshOptimizer]") {
+    // Two triangles sharing an edge: 4 misses for 2 triangles and 4 vertices
+    std::vector<uint32_t> quad = { 0, 1, 2, 2, 1, 3 };
+    VertexCacheStats stats = MeshOptimizer::AnalyzeVertexCache(quad, 4);
+    REQUIRE(stats.acmr == 2.0f);
+    REQUIRE(stats.atvr == 1.0f);
+
+    REQUIRE(MeshOptimizer::AnalyzeVertexCache({}, 0).acmr == 0.0f);
+}
+
+TEST_CASE("Vertex cache ordering keeps the triangles and cuts misses", "[MeshOptimizer]") {
+    ModelData sphere = MakeSphere(24, 32);
+    std::vector<uint32_t> indices = sphere.indices;
+    ShuffleTriangles(indices);
+    auto before = MeshOptimizer::AnalyzeVertexCache(indices, sphere.vertices.size());
+
+    MeshOptimizer::OptimizeVertexCache(indices, sphere.vertices.size());
+    auto after = MeshOptimizer::AnalyzeVertexCache(indices, sphere.vertices.size());
+
+    REQUIRE(CanonicalTriangles(indices) == CanonicalTriangles(sphere.indices));
+    REQUIRE(after.acmr < before.acmr * 0.5f);
+    REQUIRE(after.acmr < 1.0f);
+}
+
+TEST_CASE("Overdraw ordering keeps the triangles", "[MeshOptimizer]") {
+    ModelData sphere = MakeSphere(16, 24);
+    std::vector<uint32_t> indices = sphere.indices;
+    MeshOptimizer::OptimizeVertexCache(indices, sphere.vertices.size());
+    auto cached = MeshOptimizer::AnalyzeVertexCache(indices, sphere.vertices.size());
+
+    const float threshold = 1.05f;
+    MeshOptimizer::OptimizeOverdraw(indices, sphere.vertices, threshold);
+    auto after = MeshOptimizer::AnalyzeVertexCache(indices, sphere.vertices.size());
+
+    REQUIRE(CanonicalTriangles(indices) == CanonicalTriangles(sphere.indices));
+    REQUIRE(after.acmr <= cached.acmr * threshold + 1e-4f);
+}
+
+TEST_CASE("Vertex fetch ordering renumbers in first-use order", "[MeshOptimizer]") {
+    std::vector<Vertex> vertices;
+    for (int i = 0; i < 6; ++i) vertices.emplace_back(glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+    // Vertex 1 is never used
+    std::vector<uint32_t> indices = { 5, 3, 0, 0, 3, 4, 2, 4, 3 };
+    std::vector<uint32_t> original = indices;
+    std::vector<Vertex> originalVertices = vertices;
+
+    MeshOptimizer::OptimizeVertexFetch(vertices, indices);
+
+    REQUIRE(vertices.size() == 5);
+    const std::vector<uint32_t> expected = { 0, 1, 2, 2, 1, 3, 4, 3, 1 };
+    REQUIRE(indices == expected);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        REQUIRE(vertices[indices[i]].position == originalVertices[original[i]].position);
+    }
+}
+
+TEST_CASE("Optimize builds consistent LOD, submesh and meshlet ranges", "[MeshOptimizer]") {
+    ModelData model = MakeSphere(32, 48);
+    ShuffleTriangles(model.indices);
+    const size_t sourceTriangles = model.indices.size() / 3;
+
+    MeshOptimizationReport report = MeshOptimizer::Optimize(model);
+    REQUIRE(report.after.acmr < report.before.acmr);
+    REQUIRE(report.lodCount > 1);
+    REQUIRE(report.lodCount == model.lods.size());
+    REQUIRE(model.submeshes.size() == 1);
+    REQUIRE(model.lods[0].indexCount / 3 == sourceTriangles);
+
+    for (size_t level = 0; level < model.lods.size(); ++level) {
+        const MeshLod& lod = model.lods[level];
+        const MeshLod& submeshLod = model.submeshes[0].lods[level];
+        REQUIRE(submeshLod.indexOffset == lod.indexOffset);
+        REQUIRE(submeshLod.indexCount == lod.indexCount);
+        if (level > 0) {
+            REQUIRE(lod.indexOffset == model.lods[level - 1].indexOffset + model.lods[level - 1].indexCount);
+            REQUIRE(lod.indexCount < model.lods[level - 1].indexCount);
+        }
+
+        // The level's meshlets tile its index range in order
+        uint32_t next = lod.indexOffset;
+        for (uint32_t m = lod.meshletOffset; m < lod.meshletOffset + lod.meshletCount; ++m) {
+            REQUIRE(model.meshlets[m].indexOffset == next);
+            next += model.meshlets[m].triangleCount * 3;
+        }
+        REQUIRE(next == lod.indexOffset + lod.indexCount);
+    }
+
+    // Vertex fetch ran last: everything is referenced and in range
+    std::vector<bool> used(model.vertices.size(), false);
+    for (uint32_t index : model.indices) {
+        REQUIRE(index < model.vertices.size());
+        used[index] = true;
+    }
+    REQUIRE(std::find(used.begin(), used.end(), false) == used.end());
+
+    // Re-running starts again from LOD0 instead of simplifying the chain
+    const size_t lod0Count = model.lods[0].indexCount;
+    MeshOptimizer::Optimize(model);
+    REQUIRE(model.lods[0].indexCount == lod0Count);
+    REQUIRE(model.lods.size() == report.lodCount);
+}
+
+TEST_CASE("Optimize leaves packed models alone", "[MeshOptimizer]") {
+    ModelData model = MakeSphere(8, 8);
+    model.vertexFormat = VertexFormat::Packed;
+    const std::vector<uint32_t> indices = model.indices;
+
+    MeshOptimizationReport report = MeshOptimizer::Optimize(model);
+    REQUIRE(report.lodCount == 0);
+    REQUIRE(model.indices == indices);
+    REQUIRE(model.submeshes.empty());
+}
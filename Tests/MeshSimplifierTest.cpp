@@ -0,0 +1,176 @@
+#include <catch2/catch_test_macros.hpp>
+#include "Subsystems/Asset/MeshOptimizer.h"
+#include "Subsystems/Asset/MeshSimplifier.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace AstralEngine;
+
+namespace {
+
+// Flat size x size quad grid on the XZ plane; its border is an open edge
+ModelData MakeGrid(uint32_t size) {
+    ModelData model("grid.obj");
+    for (uint32_t z = 0; z <= size; ++z) {
+        for (uint32_t x = 0; x <= size; ++x) {
+            glm::vec3 position(static_cast<float>(x), 0.0f, static_cast<float>(z));
+            model.vertices.emplace_back(position, glm::vec3(0.0f, 1.0f, 0.0f));
+            model.boundingBox.Extend(position);
+        }
+    }
+    for (uint32_t z = 0; z < size; ++z) {
+        for (uint32_t x = 0; x < size; ++x) {
+            uint32_t i = z * (size + 1) + x;
+            model.indices.insert(model.indices.end(), { i, i + size + 1, i + 1, i + 1, i + size + 1, i + size + 2 });
+        }
+    }
+    return model;
+}
+
+// Closed UV sphere of radius 1
+ModelData MakeSphere(uint32_t rings, uint32_t segments) {
+    ModelData model("sphere.obj");
+    auto addVertex = [&](float theta, float phi) {
+        glm::vec3 position(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+        model.vertices.emplace_back(position, position);
+        model.boundingBox.Extend(position);
+    };
+
+    addVertex(0.0f, 0.0f);
+    for (uint32_t ring = 1; ring < rings; ++ring) {
+        for (uint32_t segment = 0; segment < segments; ++segment) {
+            addVertex(3.14159265f * ring / rings, 6.28318531f * segment / segments);
+        }
+    }
+    addVertex(3.14159265f, 0.0f);
+    const uint32_t south = static_cast<uint32_t>(model.vertices.size() - 1);
+
+    auto ringVertex = [&](uint32_t ring, uint32_t segment) { return 1 + (ring - 1) * segments + segment % segments; };
+    for (uint32_t segment = 0; segment < segments; ++segment) {
+        model.indices.insert(model.indices.end(), { 0, ringVertex(1, segment + 1), ringVertex(1, segment) });
+        model.indices.insert(model.indices.end(), { south, ringVertex(rings - 1, segment), ringVertex(rings - 1, segment + 1) });
+    }
+    for (uint32_t ring = 1; ring + 1 < rings; ++ring) {
+        for (uint32_t segment = 0; segment < segments; ++segment) {
+            uint32_t a = ringVertex(ring, segment), b = ringVertex(ring, segment + 1);
+            uint32_t c = ringVertex(ring + 1, segment), d = ringVertex(ring + 1, segment + 1);
+            model.indices.insert(model.indices.end(), { a, b, c, b, d, c });
+        }
+    }
+    return model;
+}
+
+// No index out of range and no triangle that repeats a vertex
+bool IsWellFormed(const std::vector<uint32_t>& indices, size_t vertexCount) {
+    if (indices.size() % 3 != 0) return false;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        uint32_t a = indices[i], b = indices[i + 1], c = indices[i + 2];
+        if (a >= vertexCount || b >= vertexCount || c >= vertexCount || a == b || b == c || a == c) return false;
+    }
+    return true;
+}
+
+float SurfaceArea(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
+    float area = 0.0f;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        glm::vec3 a = vertices[indices[i]].position;
+        glm::vec3 b = vertices[indices[i + 1]].position;
+        glm::vec3 c = vertices[indices[i + 2]].position;
+        area += 0.5f * glm::length(glm::cross(b - a, c - a));
+    }
+    return area;
+}
+
+} // namespace
+
+TEST_CASE("Flat regions collapse without error", "[MeshSimplifier]") {
+    ModelData grid = MakeGrid(16);
+    float error = -1.0f;
+    std::vector<uint32_t> simplified =
+        MeshSimplifier::Simplify(grid.vertices, grid.indices, grid.indices.size() / 4, 0.01f, &error);
+
+    REQUIRE(IsWellFormed(simplified, grid.vertices.size()));
+    REQUIRE(simplified.size() <= grid.indices.size() / 4);
+    REQUIRE(error >= 0.0f);
+    REQUIRE(error < 1e-4f);
+    // Same plane, same outline: the area is unchanged
+    REQUIRE(std::abs(SurfaceArea(grid.vertices, simplified) - 256.0f) < 1e-2f);
+}
+
+TEST_CASE("Open borders are locked", "[MeshSimplifier]") {
+    const uint32_t size = 16;
+    ModelData grid = MakeGrid(size);
+    std::vector<uint32_t> simplified = MeshSimplifier::Simplify(grid.vertices, grid.indices, 0, 1.0f);
+
+    std::vector<bool> used(grid.vertices.size(), false);
+    for (uint32_t index : simplified) used[index] = true;
+    for (uint32_t z = 0; z <= size; ++z) {
+        for (uint32_t x = 0; x <= size; ++x) {
+            if (x == 0 || z == 0 || x == size || z == size) {
+                REQUIRE(used[z * (size + 1) + x]);
+            }
+        }
+    }
+}
+
+TEST_CASE("The error limit bounds simplification", "[MeshSimplifier]") {
+    ModelData sphere = MakeSphere(24, 32);
+
+    // Every collapse on a sphere moves the surface, so nothing may go
+    std::vector<uint32_t> exact = MeshSimplifier::Simplify(sphere.vertices, sphere.indices, 0, 0.0f);
+    REQUIRE(exact.size() == sphere.indices.size());
+
+    float looseError = 0.0f;
+    std::vector<uint32_t> loose =
+        MeshSimplifier::Simplify(sphere.vertices, sphere.indices, sphere.indices.size() / 4, 0.05f, &looseError);
+    REQUIRE(IsWellFormed(loose, sphere.vertices.size()));
+    REQUIRE(loose.size() < sphere.indices.size() / 2);
+    REQUIRE(looseError > 0.0f);
+    REQUIRE(looseError <= 0.05f);
+
+    // A closed surface keeps roughly its area
+    float area = SurfaceArea(sphere.vertices, sphere.indices);
+    REQUIRE(std::abs(SurfaceArea(sphere.vertices, loose) - area) < area * 0.1f);
+
+    // A target the mesh already meets changes nothing
+    std::vector<uint32_t> unchanged =
+        MeshSimplifier::Simplify(sphere.vertices, sphere.indices, sphere.indices.size(), 1.0f);
+    REQUIRE(unchanged.size() == sphere.indices.size());
+}
+
+TEST_CASE("LOD chains shrink with growing error", "[MeshSimplifier]") {
+    ModelData sphere = MakeSphere(32, 48);
+    const uint32_t sourceCount = static_cast<uint32_t>(sphere.indices.size());
+    MeshOptimizer::GenerateLods(sphere, 4, 0.5f, 0.05f);
+
+    REQUIRE(sphere.lods.size() > 1);
+    REQUIRE(sphere.lods.size() <= 4);
+    REQUIRE(sphere.lods[0].indexOffset == 0);
+    REQUIRE(sphere.lods[0].indexCount == sourceCount);
+    REQUIRE(sphere.lods[0].error == 0.0f);
+
+    for (size_t level = 1; level < sphere.lods.size(); ++level) {
+        const MeshLod& lod = sphere.lods[level];
+        const MeshLod& previous = sphere.lods[level - 1];
+        REQUIRE(lod.indexOffset == previous.indexOffset + previous.indexCount);
+        REQUIRE(lod.indexCount < previous.indexCount);
+        REQUIRE(lod.error >= previous.error);
+        REQUIRE(lod.error <= 0.05f);
+
+        // Each level draws from the shared vertex buffer
+        std::vector<uint32_t> range(sphere.indices.begin() + lod.indexOffset,
+                                    sphere.indices.begin() + lod.indexOffset + lod.indexCount);
+        REQUIRE(IsWellFormed(range, sphere.vertices.size()));
+    }
+    REQUIRE(sphere.indices.size() == sphere.lods.back().indexOffset + sphere.lods.back().indexCount);
+}
+
+TEST_CASE("LOD generation stops when the mesh cannot shrink", "[MeshSimplifier]") {
+    // A single quad is all border, so no edge may collapse
+    ModelData quad = MakeGrid(1);
+    MeshOptimizer::GenerateLods(quad, 4, 0.5f, 1.0f);
+    REQUIRE(quad.lods.size() == 1);
+    REQUIRE(quad.GetLodCount() == 1);
+    REQUIRE(quad.indices.size() == 6);
+}
@@ -3,6 +3,8 @@
 #include "Subsystems/Scene/SceneSerializer.h"
 #include "Subsystems/Scene/Entity.h"
 #include "ECS/Components.h"
+#include "Subsystems/Asset/AssetArchive.h"
+#include "Subsystems/Asset/AssetHandle.h"
 #include <filesystem>
 #include <fstream>
 
@@ -87,3 +89,72 @@ TEST_CASE("Scene Serialization and Deserialization", "[SceneSerializer]") {
     // Cleanup
     std::filesystem::remove(filepath);
 }
+
+TEST_CASE("Asset handles survive scene serialization", "[SceneSerializer]") {
+    Scene scene;
+
+    AssetHandle material("materials/brick.amat", AssetHandle::Type::Material);
+    AssetHandle model("models/wall.gltf", AssetHandle::Type::Model);
+    AssetHandle slotMaterial("materials/trim.amat", AssetHandle::Type::Material);
+
+    Entity entity = scene.CreateEntity("Wall");
+    auto& rc = entity.AddComponent<RenderComponent>(material, model);
+    rc.materialSlots = { AssetHandle(), slotMaterial };
+
+    std::string filepath = "test_scene_handles.json";
+    SceneSerializer serializer(&scene);
+    serializer.Serialize(filepath);
+
+    Scene newScene;
+    SceneSerializer newSerializer(&newScene);
+    REQUIRE(newSerializer.Deserialize(filepath));
+
+    auto view = newScene.Reg().view<RenderComponent>();
+    REQUIRE(view.size() == 1);
+    Entity newEntity = { *view.begin(), &newScene };
+    auto& newRc = newEntity.GetComponent<RenderComponent>();
+
+    // IDs are written as is, so the type and validity come back with them
+    REQUIRE(newRc.materialHandle == material);
+    REQUIRE(newRc.modelHandle == model);
+    REQUIRE(newRc.materialHandle.GetType() == AssetHandle::Type::Material);
+    REQUIRE(newRc.modelHandle.GetType() == AssetHandle::Type::Model);
+    REQUIRE(newRc.HasValidHandles());
+
+    REQUIRE(newRc.materialSlots.size() == 2);
+    REQUIRE_FALSE(newRc.materialSlots[0].IsValid());
+    REQUIRE(newRc.materialSlots[1] == slotMaterial);
+    REQUIRE(newRc.GetMaterialHandle(0) == material);
+    REQUIRE(newRc.GetMaterialHandle(1) == slotMaterial);
+
+    std::filesystem::remove(filepath);
+}
+
+TEST_CASE("Asset handles are derived from the path", "[AssetHandle]") {
+    AssetHandle a("textures/a.png", AssetHandle::Type::Texture);
+    AssetHandle b("textures/a.png", AssetHandle::Type::Texture);
+    REQUIRE(a.IsValid());
+    REQUIRE(a == b);
+    REQUIRE(a.GetType() == AssetHandle::Type::Texture);
+
+    // Scene files store the ID, so it must not change between runs or builds
+    REQUIRE(a.GetID() == 0x01b05134683c9f8eull);
+    REQUIRE(AssetHandle(a.GetID()) == a);
+
+    REQUIRE(AssetHandle("textures/b.png", AssetHandle::Type::Texture) != a);
+    // Same path, different type: the type byte keeps them apart
+    REQUIRE(AssetHandle("textures/a.png", AssetHandle::Type::Material) != a);
+
+    REQUIRE_FALSE(AssetHandle().IsValid());
+    REQUIRE_FALSE(AssetHandle("", AssetHandle::Type::Texture).IsValid());
+}
+
+TEST_CASE("Asset paths normalize case-insensitively", "[AssetHandle]") {
+    REQUIRE(AssetArchive::NormalizePath("Textures/./Foo.png") == "textures/foo.png");
+    REQUIRE(AssetArchive::NormalizePath("textures/sub/../FOO.PNG") == "textures/foo.png");
+
+    // Deliberate: files that differ only in case share one ID, on every platform
+    AssetHandle upper(AssetArchive::NormalizePath("Foo.png"), AssetHandle::Type::Texture);
+    AssetHandle lower(AssetArchive::NormalizePath("foo.png"), AssetHandle::Type::Texture);
+    REQUIRE(upper == lower);
+}
@@ -0,0 +1,216 @@
+#include <catch2/catch_test_macros.hpp>
+#include "Subsystems/Asset/TextureContainer.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace AstralEngine;
+
+namespace {
+
+// VkFormat / DXGI_FORMAT values the loader maps
+constexpr uint32_t VK_FORMAT_R8G8B8A8_UNORM = 37;
+constexpr uint32_t VK_FORMAT_BC1_RGBA_UNORM_BLOCK = 133;
+constexpr uint32_t DXGI_FORMAT_BC7_UNORM = 98;
+
+struct KTX2Level {
+    uint64_t offset;
+    uint64_t length;
+};
+
+template<typename T>
+void Put(std::vector<uint8_t>& bytes, size_t offset, const T& value) {
+    if (bytes.size() < offset + sizeof(T)) {
+        bytes.resize(offset + sizeof(T));
+    }
+    std::memcpy(bytes.data() + offset, &value, sizeof(T));
+}
+
+std::string WriteFile(const std::string& name, const std::vector<uint8_t>& bytes) {
+    auto path = std::filesystem::temp_directory_path() / "AstralTests";
+    std::filesystem::create_directories(path);
+    path /= name;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return path.string();
+}
+
+// Header, then the level index at 80, then the levels' data
+std::vector<uint8_t> MakeKTX2(uint32_t vkFormat, uint32_t width, uint32_t height, uint32_t levelCount,
+                              const std::vector<KTX2Level>& levels, uint32_t supercompression = 0) {
+    const uint8_t identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+    std::vector<uint8_t> bytes(80, 0);
+    std::memcpy(bytes.data(), identifier, sizeof(identifier));
+    Put(bytes, 12, vkFormat);
+    Put(bytes, 16, uint32_t(1)); // typeSize
+    Put(bytes, 20, width);
+    Put(bytes, 24, height);
+    Put(bytes, 28, uint32_t(0)); // pixelDepth
+    Put(bytes, 32, uint32_t(0)); // layerCount
+    Put(bytes, 36, uint32_t(1)); // faceCount
+    Put(bytes, 40, levelCount);
+    Put(bytes, 44, supercompression);
+    for (size_t i = 0; i < levels.size(); ++i) {
+        Put(bytes, 80 + i * 24, levels[i].offset);
+        Put(bytes, 80 + i * 24 + 8, levels[i].length);
+        Put(bytes, 80 + i * 24 + 16, levels[i].length);
+    }
+    return bytes;
+}
+
+// "DDS " + 124-byte header + DX10 extension, levels tightly packed after it
+std::vector<uint8_t> MakeDDS(uint32_t width, uint32_t height, uint32_t mipCount, uint32_t dxgiFormat,
+                             size_t dataSize, uint32_t caps2 = 0) {
+    std::vector<uint8_t> bytes(4 + 124 + 20 + dataSize, 0);
+    Put(bytes, 0, uint32_t(0x20534444));
+    Put(bytes, 4, uint32_t(124));
+    Put(bytes, 8, uint32_t(0x1007 | 0x20000)); // caps, height, width, pixel format, mip count
+    Put(bytes, 12, height);
+    Put(bytes, 16, width);
+    Put(bytes, 28, mipCount);
+    Put(bytes, 76, uint32_t(32));              // pixel format size
+    Put(bytes, 80, uint32_t(0x4));             // DDPF_FOURCC
+    Put(bytes, 84, uint32_t(0x30315844));      // "DX10"
+    Put(bytes, 112, caps2);
+    Put(bytes, 128, dxgiFormat);
+    Put(bytes, 132, uint32_t(3));              // Texture2D
+    Put(bytes, 140, uint32_t(1));              // arraySize
+    return bytes;
+}
+
+} // namespace
+
+TEST_CASE("KTX2 levels are mapped in place", "[TextureContainer]") {
+    // 8x8 RGBA8 with its full chain: 256 + 64 + 16 + 4 bytes
+    std::vector<KTX2Level> levels = { { 176, 256 }, { 432, 64 }, { 496, 16 }, { 512, 4 } };
+    auto bytes = MakeKTX2(VK_FORMAT_R8G8B8A8_UNORM, 8, 8, 4, levels);
+    bytes.resize(516, 0x7F);
+
+    auto texture = TextureContainer::Load(WriteFile("valid.ktx2", bytes));
+    REQUIRE(texture);
+    REQUIRE(texture->width == 8);
+    REQUIRE(texture->height == 8);
+    REQUIRE(texture->compression == TextureCompression::None);
+    REQUIRE(texture->mips.size() == 4);
+    REQUIRE(texture->mips[1].offset == 432);
+    REQUIRE(texture->mips[3].width == 1);
+    REQUIRE(texture->mips[3].size == 4);
+}
+
+TEST_CASE("KTX2 BC1 texture loads", "[TextureContainer]") {
+    auto bytes = MakeKTX2(VK_FORMAT_BC1_RGBA_UNORM_BLOCK, 4, 4, 1, { { 104, 8 } });
+    bytes.resize(112, 0);
+
+    auto texture = TextureContainer::Load(WriteFile("bc1.ktx2", bytes));
+    REQUIRE(texture);
+    REQUIRE(texture->compression == TextureCompression::BC1);
+    REQUIRE(texture->mips.size() == 1);
+}
+
+TEST_CASE("Malformed KTX2 files are rejected", "[TextureContainer]") {
+    auto valid = MakeKTX2(VK_FORMAT_BC1_RGBA_UNORM_BLOCK, 4, 4, 1, { { 104, 8 } });
+    valid.resize(112, 0);
+
+    auto badIdentifier = valid;
+    badIdentifier[1] = 'X';
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("bad_identifier.ktx2", badIdentifier)));
+
+    auto truncatedHeader = valid;
+    truncatedHeader.resize(60);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("truncated_header.ktx2", truncatedHeader)));
+
+    // Level index for two levels does not fit in the file
+    auto truncatedIndex = MakeKTX2(VK_FORMAT_BC1_RGBA_UNORM_BLOCK, 8, 8, 2, {});
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("truncated_index.ktx2", truncatedIndex)));
+
+    auto pastEnd = MakeKTX2(VK_FORMAT_BC1_RGBA_UNORM_BLOCK, 4, 4, 1, { { 108, 8 } });
+    pastEnd.resize(112, 0);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("past_end.ktx2", pastEnd)));
+
+    // An offset near 2^64 must not wrap around the range check
+    auto wrapping = MakeKTX2(VK_FORMAT_BC1_RGBA_UNORM_BLOCK, 4, 4, 1, { { ~uint64_t(0) - 3, 8 } });
+    wrapping.resize(112, 0);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("wrapping.ktx2", wrapping)));
+
+    auto wrongSize = MakeKTX2(VK_FORMAT_BC1_RGBA_UNORM_BLOCK, 4, 4, 1, { { 104, 4 } });
+    wrongSize.resize(112, 0);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("wrong_size.ktx2", wrongSize)));
+
+    auto unknownFormat = MakeKTX2(9999, 4, 4, 1, { { 104, 8 } });
+    unknownFormat.resize(112, 0);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("unknown_format.ktx2", unknownFormat)));
+
+    auto supercompressed = MakeKTX2(VK_FORMAT_BC1_RGBA_UNORM_BLOCK, 4, 4, 1, { { 104, 8 } }, 2);
+    supercompressed.resize(112, 0);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("supercompressed.ktx2", supercompressed)));
+}
+
+TEST_CASE("KTX2 dimensions and level counts are bounded", "[TextureContainer]") {
+    auto tooWide = MakeKTX2(VK_FORMAT_R8G8B8A8_UNORM, MAX_TEXTURE_DIMENSION + 1, 1, 1, { { 104, 4 } });
+    tooWide.resize(112, 0);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("too_wide.ktx2", tooWide)));
+
+    auto tooTall = MakeKTX2(VK_FORMAT_R8G8B8A8_UNORM, 1, 0xFFFFFFFFu, 1, { { 104, 4 } });
+    tooTall.resize(112, 0);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("too_tall.ktx2", tooTall)));
+
+    auto tooManyLevels = MakeKTX2(VK_FORMAT_R8G8B8A8_UNORM, 1, 1, MAX_TEXTURE_MIPS + 1, {});
+    tooManyLevels.resize(80 + 24 * (MAX_TEXTURE_MIPS + 1) + 4, 0);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("too_many_levels.ktx2", tooManyLevels)));
+}
+
+TEST_CASE("DDS levels follow the header", "[TextureContainer]") {
+    // 8x8 BC7: 64 bytes, then 4x4: 16 bytes
+    auto bytes = MakeDDS(8, 8, 2, DXGI_FORMAT_BC7_UNORM, 80);
+
+    auto texture = TextureContainer::Load(WriteFile("valid.dds", bytes));
+    REQUIRE(texture);
+    REQUIRE(texture->compression == TextureCompression::BC7);
+    REQUIRE(texture->mips.size() == 2);
+    REQUIRE(texture->mips[0].offset == 148);
+    REQUIRE(texture->mips[0].size == 64);
+    REQUIRE(texture->mips[1].offset == 212);
+    REQUIRE(texture->mips[1].size == 16);
+}
+
+TEST_CASE("Legacy DXT1 DDS loads without the DX10 header", "[TextureContainer]") {
+    auto bytes = MakeDDS(4, 4, 1, 0, 0);
+    Put(bytes, 84, uint32_t(0x31545844)); // "DXT1"
+    bytes.resize(128 + 8, 0);
+
+    auto texture = TextureContainer::Load(WriteFile("legacy.dds", bytes));
+    REQUIRE(texture);
+    REQUIRE(texture->compression == TextureCompression::BC1);
+    REQUIRE(texture->mips[0].offset == 128);
+}
+
+TEST_CASE("Malformed DDS files are rejected", "[TextureContainer]") {
+    auto truncated = MakeDDS(8, 8, 2, DXGI_FORMAT_BC7_UNORM, 79);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("truncated.dds", truncated)));
+
+    auto badMagic = MakeDDS(8, 8, 2, DXGI_FORMAT_BC7_UNORM, 80);
+    badMagic[0] = 'X';
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("bad_magic.dds", badMagic)));
+
+    std::vector<uint8_t> tiny = { 'D', 'D', 'S', ' ' };
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("tiny.dds", tiny)));
+
+    auto cubemap = MakeDDS(8, 8, 1, DXGI_FORMAT_BC7_UNORM, 64, 0x200);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("cubemap.dds", cubemap)));
+
+    auto unknownFormat = MakeDDS(8, 8, 1, 1234, 64);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("unknown_format.dds", unknownFormat)));
+
+    auto empty = MakeDDS(0, 8, 1, DXGI_FORMAT_BC7_UNORM, 64);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("empty.dds", empty)));
+}
+
+TEST_CASE("DDS dimensions and level counts are bounded", "[TextureContainer]") {
+    // Would need far more data than present, but must be refused before any size math
+    auto huge = MakeDDS(0xFFFFFFFFu, 0xFFFFFFFFu, 1, DXGI_FORMAT_BC7_UNORM, 64);
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("huge.dds", huge)));
+
+    auto tooManyLevels = MakeDDS(4, 4, MAX_TEXTURE_MIPS + 1, DXGI_FORMAT_BC7_UNORM, 16 * (MAX_TEXTURE_MIPS + 1));
+    REQUIRE_FALSE(TextureContainer::Load(WriteFile("too_many_levels.dds", tooManyLevels)));
+}
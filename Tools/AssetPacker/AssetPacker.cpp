@@ -0,0 +1,67 @@
+// Packs every asset under a directory into one archive, cooked the way the
+// engine loads it.
+// Usage: AssetPacker <asset directory> [archive] [--compress none|lz4|zstd]
+//   The archive defaults to "<asset directory>.apak" next to the directory,
+//   which AssetManager mounts on its own at startup.
+
+#include "Core/Logger.h"
+#include "Subsystems/Asset/AssetArchive.h"
+#include "Subsystems/Asset/AssetManager.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace AstralEngine;
+
+int main(int argc, char* argv[]) {
+    std::string assetDirectory;
+    std::string archivePath;
+    ArchiveCompression compression = ArchiveCompression::None;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--compress") == 0 && i + 1 < argc) {
+            std::string codec = argv[++i];
+            if (codec == "lz4") {
+                compression = ArchiveCompression::LZ4;
+            } else if (codec == "zstd") {
+                compression = ArchiveCompression::Zstd;
+            } else if (codec != "none") {
+                std::printf("Unknown compression: %s\n", codec.c_str());
+                return 1;
+            }
+        } else if (assetDirectory.empty()) {
+            assetDirectory = argv[i];
+        } else if (archivePath.empty()) {
+            archivePath = argv[i];
+        }
+    }
+    if (assetDirectory.empty()) {
+        std::printf("Usage: AssetPacker <asset directory> [archive] [--compress none|lz4|zstd]\n");
+        return 1;
+    }
+    if (!AssetArchive::IsCompressionSupported(compression)) {
+        std::printf("This build has no %s support\n", compression == ArchiveCompression::LZ4 ? "LZ4" : "Zstd");
+        return 1;
+    }
+
+    Logger::SetLogLevel(Logger::LogLevel::Warning);
+    AssetManager assetManager;
+    if (!assetManager.Initialize(assetDirectory)) {
+        return 1;
+    }
+    if (archivePath.empty()) {
+        archivePath = assetManager.GetDefaultArchivePath();
+    }
+
+    bool packed = assetManager.BuildArchive(archivePath, compression);
+    assetManager.Shutdown();
+    if (!packed) {
+        std::printf("Failed to pack %s\n", assetDirectory.c_str());
+        return 1;
+    }
+
+    auto archive = AssetArchive::Open(archivePath);
+    std::printf("%s: %zu assets\n", archivePath.c_str(), archive ? archive->GetEntryCount() : 0);
+    return archive ? 0 : 1;
+}